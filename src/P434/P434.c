@@ -73,7 +73,10 @@ const uint64_t Montgomery_one[NWORDS64_FIELD]    = { 0x000000000000742C, 0x00000
                                                      0xD801A4FB559FACD4, 0xE93254545F77410C, 0x0000ECEEA7BD2EDA };
 
 
-// Fixed parameters for isogeny tree computation
+// Fixed parameters for isogeny tree computation, or the memory-bounded ones selected with SIKE_MAX_STORED_POINTS
+#if defined(SIKE_MAX_STORED_POINTS)
+#include "P434_strategies.c"
+#else
 const unsigned int strat_Alice[MAX_Alice-1] = { 
 48, 28, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 13, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 
 1, 1, 5, 4, 2, 1, 1, 2, 1, 1, 2, 1, 1, 1, 21, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 
@@ -83,6 +86,7 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 66, 33, 17, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 1, 
 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 32, 16, 8, 4, 3, 1, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 
 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1 };
+#endif
            
 // Setting up macro defines and including GF(p), GF(p^2), curve, isogeny and kex functions
 #define fpcopy                        fpcopy434
@@ -94,6 +98,7 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define fpcorrection                  fpcorrection434
 #define fpmul                         fpmul434
 #define fpmul_mont                    fpmul434_mont
+#define fpsqr                         fpsqr434
 #define fpsqr_mont                    fpsqr434_mont
 #define fpinv_mont                    fpinv434_mont
 #define fpinv_chain_mont              fpinv434_chain_mont
@@ -123,6 +128,21 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp434
 #define crypto_kem_enc                crypto_kem_enc_SIKEp434
 #define crypto_kem_dec                crypto_kem_dec_SIKEp434
+#define crypto_kem_keypair_derand     crypto_kem_keypair_derand_SIKEp434
+#define crypto_kem_enc_derand         crypto_kem_enc_derand_SIKEp434
+#define crypto_kem_expand_pk          crypto_kem_expand_pk_SIKEp434
+#define crypto_kem_enc_expanded       crypto_kem_enc_expanded_SIKEp434
+#define crypto_kem_keystore_write     crypto_kem_keystore_write_SIKEp434
+#define crypto_kem_keystore_open      crypto_kem_keystore_open_SIKEp434
+#define crypto_kem_keystore_take      crypto_kem_keystore_take_SIKEp434
+#define crypto_kem_keystore_remaining crypto_kem_keystore_remaining_SIKEp434
+#define crypto_kem_keystore_close     crypto_kem_keystore_close_SIKEp434
+#define kem_scheme                    sike_scheme_SIKEp434
+#define opcount_get                   opcount_get_SIKEp434
+#define opcount_reset                 opcount_reset_SIKEp434
+#define sike_stats_enable             sike_stats_enable_SIKEp434
+#define sike_stats_snapshot           sike_stats_snapshot_SIKEp434
+#define sike_stats_reset              sike_stats_reset_SIKEp434
 #define random_mod_order_A            random_mod_order_A_SIDHp434
 #define random_mod_order_B            random_mod_order_B_SIDHp434
 #define EphemeralKeyGeneration_A      EphemeralKeyGeneration_A_SIDHp434
@@ -133,4 +153,5 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #include "../fpx.c"
 #include "../ec_isogeny.c"
 #include "../sidh.c"    
-#include "../sike.c"
\ No newline at end of file
+#include "../sike.c"
+#include "../keystore.c"
\ No newline at end of file
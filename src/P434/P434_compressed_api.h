@@ -10,6 +10,10 @@
 
 #ifndef P434_COMPRESSED_API_H
 #define P434_COMPRESSED_API_H
+
+#include <stddef.h>
+#include "../opcount.h"
+#include "../sike_stats.h"
     
 
 /*********************** Key encapsulation mechanism API ***********************/
@@ -18,6 +22,9 @@
 #define CRYPTO_PUBLICKEYBYTES     197      // 3*ORDER_B_ENCODED_BYTES + FP2_ENCODED_BYTES + 3 bytes for shared elligator 
 #define CRYPTO_BYTES               16
 #define CRYPTO_CIPHERTEXTBYTES    236      // PARTIALLY_COMPRESSED_CHUNK_CT + MSG_BYTES bytes
+#define CRYPTO_KEYPAIRCOINBYTES    43      // MSG_BYTES + SECRETKEY_A_BYTES bytes
+#define CRYPTO_ENCCOINBYTES        16      // MSG_BYTES bytes
+#define CRYPTO_PUBLICKEYBYTES_UNCOMPRESSED  330    // 3*FP2_ENCODED_BYTES bytes
 
 // Algorithm name
 #define CRYPTO_ALGNAME "SIKEp434_compressed"  
@@ -40,6 +47,72 @@ int crypto_kem_enc_SIKEp434_compressed(unsigned char *ct, unsigned char *ss, con
 // Outputs: shared secret ss      (CRYPTO_BYTES = 16 bytes)
 int crypto_kem_dec_SIKEp434_compressed(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
 
+// Size in bytes of the workspace of the functions below
+size_t crypto_kem_workspace_size_SIKEp434_compressed(void);
+
+// Key generation, encapsulation and decapsulation as above, with their large scratch arrays in a workspace of
+// crypto_kem_workspace_size_SIKEp434_compressed() bytes provided by the caller (at any alignment) instead of on the stack. The workspace can be
+// reused by later calls but not shared by concurrent ones, and the part of it used by a call is erased before returning.
+int crypto_kem_keypair_ws_SIKEp434_compressed(unsigned char *pk, unsigned char *sk, void *workspace);
+int crypto_kem_enc_ws_SIKEp434_compressed(unsigned char *ct, unsigned char *ss, const unsigned char *pk, void *workspace);
+int crypto_kem_dec_ws_SIKEp434_compressed(unsigned char *ss, const unsigned char *ct, const unsigned char *sk, void *workspace);
+
+// SIKE's key generation and encapsulation as above, with their random bytes ("coins") given by the caller, e.g., to generate them in batches.
+// The coins are the secret values s||SK (CRYPTO_KEYPAIRCOINBYTES = 43 bytes), the first and last bytes of SK being masked as in the key
+// generation, and the message m (CRYPTO_ENCCOINBYTES = 16 bytes). With the bytes read from randombytes by crypto_kem_keypair_SIKEp434_compressed
+// and crypto_kem_enc_SIKEp434_compressed, in that order, they give the same outputs. The coins must be secret and never be reused.
+int crypto_kem_keypair_derand_SIKEp434_compressed(unsigned char *pk, unsigned char *sk, const unsigned char *coins);
+int crypto_kem_enc_derand_SIKEp434_compressed(unsigned char *ct, unsigned char *ss, const unsigned char *pk, const unsigned char *coins);
+
+// Conversion of the public key from the compressed encoding (CRYPTO_PUBLICKEYBYTES = 197 bytes) to the uncompressed one
+// (CRYPTO_PUBLICKEYBYTES_UNCOMPRESSED = 330 bytes), and compressed public key of the secret key sk (CRYPTO_SECRETKEYBYTES = 350 bytes), which
+// is stored in sk. The uncompressed key only saves the decompression in crypto_kem_enc_uncompressed_SIKEp434_compressed below.
+int crypto_kem_decompress_pk_SIKEp434_compressed(unsigned char *pk_uncomp, const unsigned char *pk);
+int crypto_kem_compress_pk_SIKEp434_compressed(unsigned char *pk, const unsigned char *sk);
+
+// SIKE's encapsulation as crypto_kem_enc_SIKEp434_compressed, with the uncompressed public key pk_uncomp of pk, which saves its decompression.
+// The compressed key pk is needed as well, since G(m||pk) hashes the compressed encoding: a peer given only pk_uncomp cannot encapsulate,
+// so that peers are served pk, or pk and pk_uncomp. Decapsulation is unchanged.
+int crypto_kem_enc_uncompressed_SIKEp434_compressed(unsigned char *ct, unsigned char *ss, const unsigned char *pk, const unsigned char *pk_uncomp);
+
+// Field operation counts of the calling thread (see opcount.h), for libraries built with OPCOUNT=TRUE.
+// Writes to ops the operations executed by the calls "call" (an opcount_call) since the last opcount_reset_SIKEp434_compressed().
+// Returns 0 on success, 1 if "call" is invalid or the library was built without OPCOUNT=TRUE.
+int opcount_get_SIKEp434_compressed(unsigned int call, opcount_t *ops);
+
+// Clear the operation counts of the calling thread
+void opcount_reset_SIKEp434_compressed(void);
+
+// Phase timers (see sike_stats.h). Enable (enable != 0) or disable the timers of all threads
+void sike_stats_enable_SIKEp434_compressed(int enable);
+
+// Writes to stats the phases timed by the calling thread since the last sike_stats_reset_SIKEp434_compressed()
+void sike_stats_snapshot_SIKEp434_compressed(sike_stats_t *stats);
+
+// Clear the phase timers of the calling thread
+void sike_stats_reset_SIKEp434_compressed(void);
+
+// Stop and join the threads solving the discrete logarithms of the key generation with PARALLEL_DLOG=TRUE, e.g., before unloading the library.
+// Calls running meanwhile finish on their own thread, and the next call starts the threads again. Does nothing without PARALLEL_DLOG=TRUE.
+void sike_threads_shutdown_SIKEp434_compressed(void);
+
+// Copy the precomputed compression tables to memory backed by huge pages and use them from then on (Linux only).
+// Optional; call it once before any other function of this API. Returns 0 on success, 1 if huge pages are not available.
+int tables_hugepages_SIKEp434_compressed(void);
+
+// Set up the compression tables. In builds with RUNTIME_TABLES=TRUE, the tables are computed at startup, or mapped from cache_path if it
+// holds the tables written by an earlier call (POSIX only; cache_path can be NULL). Without this call, they are computed on first use.
+// In the default build the tables are compiled in and this function does nothing. Returns 0 on success.
+int tables_init_SIKEp434_compressed(const char *cache_path);
+
+// Map the precomputed compression tables read-only and shared from a table store written by tables_write_SIKEp434_compressed() or
+// "make tables_store_p434", so that all the processes using it share one copy (POSIX only). Call it once before any other function of
+// this API. Returns 0 on success, 1 if the store is missing, damaged or was written for another build configuration.
+int tables_map_SIKEp434_compressed(const char *path);
+
+// Write the compression tables in use to a table store (POSIX only). Returns 0 on success.
+int tables_write_SIKEp434_compressed(const char *path);
+
 
 // Encoding of keys for KEM-based isogeny system "SIKEp434_compressed" (wire format):
 // ---------------------------------------------------------------------------------
@@ -60,6 +133,8 @@ int crypto_kem_dec_SIKEp434_compressed(unsigned char *ss, const unsigned char *c
 #define SIDH_SECRETKEYBYTES_B    28
 #define SIDH_PUBLICKEYBYTES     197
 #define SIDH_BYTES              110
+#define SIDH_PUBLICKEYBYTES_UNCOMPRESSED   330
+#define SIDH_BASISHINTBYTES                  3
 
 // SECURITY NOTE: SIDH supports ephemeral Diffie-Hellman key exchange. It is NOT secure to use it with static keys.
 // See "On the Security of Supersingular Isogeny Cryptosystems", S.D. Galbraith, C. Petit, B. Shani and Y.B. Ti, in ASIACRYPT 2016, 2016.
@@ -84,6 +159,11 @@ int EphemeralKeyGeneration_A_SIDHp434_Compressed(const unsigned char* PrivateKey
 // The public key consists of 3 values of length OALICE_BITS, one element in GF(p434^2) and 2 bytes encoded in 197 bytes.
 int EphemeralKeyGeneration_B_SIDHp434_Compressed(const unsigned char* PrivateKeyB, unsigned char* PublicKeyB);
 
+// Alice's and Bob's ephemeral public key generation as above, with the scratch memory in a workspace of
+// crypto_kem_workspace_size_SIKEp434_compressed() bytes provided by the caller (see crypto_kem_keypair_ws_SIKEp434_compressed)
+int EphemeralKeyGeneration_A_ws_SIDHp434_Compressed(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA, void *workspace);
+int EphemeralKeyGeneration_B_ws_SIDHp434_Compressed(const unsigned char* PrivateKeyB, unsigned char* PublicKeyB, void *workspace);
+
 // Alice's ephemeral shared secret computation
 // It produces a shared secret key SharedSecretA using her secret key PrivateKeyA and Bob's public key PublicKeyB
 // Inputs: Alice's PrivateKeyA is an integer in the range [0, 2^216 - 1], stored in 27 bytes. 
@@ -98,6 +178,22 @@ int EphemeralSecretAgreement_A_SIDHp434_Compressed(const unsigned char* PrivateK
 // Output: a shared secret SharedSecretB that consists of one element in GF(p434^2) encoded in 110 bytes.
 int EphemeralSecretAgreement_B_SIDHp434_Compressed(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, unsigned char* SharedSecretB);
 
+// Alice's and Bob's ephemeral shared secret computation as above, with the scratch memory in a workspace of
+// crypto_kem_workspace_size_SIKEp434_compressed() bytes provided by the caller (see crypto_kem_keypair_ws_SIKEp434_compressed)
+int EphemeralSecretAgreement_A_ws_SIDHp434_Compressed(const unsigned char* PrivateKeyA, const unsigned char* PublicKeyB, unsigned char* SharedSecretA, void *workspace);
+int EphemeralSecretAgreement_B_ws_SIDHp434_Compressed(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, unsigned char* SharedSecretB, void *workspace);
+
+// Conversion of Alice's public key between the compressed encoding and the uncompressed one, so that a key generated once can be served in both.
+// The uncompressed public key consists of 3 elements in GF(p434^2), the x-coordinates of the images P and Q of Bob's basis and of P-Q up to a common
+// scalar, encoded in 330 bytes. The decompression needs the compressed key only. The compression needs the SIDH_BASISHINTBYTES = 3 last bytes
+// of the compressed key ("basis hint"), to be recorded with the secret key, and costs a fraction of the key generation.
+int PublicKeyDecompression_A_SIDHp434_Compressed(const unsigned char* CompressedPublicKeyA, unsigned char* PublicKeyA);
+int PublicKeyCompression_A_SIDHp434_Compressed(const unsigned char* PublicKeyA, const unsigned char* BasisHint, unsigned char* CompressedPublicKeyA);
+
+// Bob's ephemeral shared secret computation as above, from Alice's uncompressed public key (SIDH_PUBLICKEYBYTES_UNCOMPRESSED = 330 bytes).
+// It skips the decompression of the key and gives the same shared secret.
+int EphemeralSecretAgreement_B_Uncompressed_SIDHp434_Compressed(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, unsigned char* SharedSecretB);
+
 
 // Encoding of keys for KEX-based isogeny system "SIDHp434" (wire format):
 // ----------------------------------------------------------------------
@@ -14,7 +14,7 @@
 // x23 and x2p3 are the product and sum of the x-coordinates of the intermediate double and the tripled point. The last Miller iteration only needs four 
 // precomputed values.
 
-const uint64_t T_tate3[(6 * (OBOB_EXPON - 1) + 4) * NWORDS64_FIELD] = { 
+CACHE_ALIGN const uint64_t T_tate3[(6 * (OBOB_EXPON - 1) + 4) * NWORDS64_FIELD] = { 
 0x87CF42AB4DB902F, 0x2DC7847A25C2D0BB, 0x2EA717C1089170B, 0xD648387AF59D578F, 
 0x16EC71A5BDA7D98B, 0xC02025B1BDE6B5F1, 0x482FED00DCBB, 0x8AD7A8F0578700AE, 
 0xB317427ECCC5FA27, 0x43EE31091EAF92, 0x2D317292BB029F77, 0xFBBB529BB4CBB2B4, 
@@ -1525,7 +1525,7 @@ const uint64_t T_tate3[(6 * (OBOB_EXPON - 1) + 4) * NWORDS64_FIELD] = {
 // 2^eA-torsion of E0: y^2 = x^3 + x. Contains a triple (x,y,l1), there the 
 // coordinates x and y of the double of P are in Fp, the slope l1 is in Fp2.
 
-const uint64_t T_tate2_firststep_P[4 * NWORDS64_FIELD] = { 
+CACHE_ALIGN const uint64_t T_tate2_firststep_P[4 * NWORDS64_FIELD] = { 
 0x16747C943533BF87, 0xB4497C90231C8CF6, 0x5ABB26BC14FB0710, 0x457A7E552E14B4D2, 
 0x6E92EEF549069079, 0x565AB7E75A1BA5C, 0x21F0CABC7F726, 0x39645C6B7CF4AD82, 
 0x72CA8B9E5285631B, 0xB778021E0CE0E39B, 0x1255EAC0AC0F8ABA, 0x6A43AE42E0830B36, 
@@ -1538,7 +1538,7 @@ const uint64_t T_tate2_firststep_P[4 * NWORDS64_FIELD] = {
 
 // From here on all values are in Fp. The table contains eA-2 triples (x,y,l1).
 
-const uint64_t T_tate2_P[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = { 
+CACHE_ALIGN const uint64_t T_tate2_P[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = { 
 0xEC805BF7BF3C44F4, 0x9544F219309FD605, 0x57266A162ABDBD16, 0x19BB58DC7DB2C684, 
 0x94AC03F73CAF41E7, 0xE74ACBA50EDF2704, 0xC3C8774EB007, 0x8D6C83984DF44C50, 
 0xE0465877BEE21C8, 0x84AF8716D3A72CA4, 0xB24BA37D544FF41A, 0x55AE1D1FDDE2CF50, 
@@ -2828,7 +2828,7 @@ const uint64_t T_tate2_P[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = {
 // 2^eA-torsion of E0: y^2 = x^3 + x. Contains a triple (x,y,l1), there the 
 // coordinates x and y of the double of Q are in Fp, the slope l1 is in Fp2.
 
-const uint64_t T_tate2_firststep_Q[4 * NWORDS64_FIELD] = { 
+CACHE_ALIGN const uint64_t T_tate2_firststep_Q[4 * NWORDS64_FIELD] = { 
 0x6448CB5BD9770D67, 0x3092CF8C8803D8B4, 0x2542331C81C2C2F8, 0x8066DFBFF024AA32, 
 0x5F4E163CD158E1A, 0x87C8B0AC7FF6B89F, 0x18466971777FB, 0x414795F6A70D543E, 
 0xDC7D2E0B9229A814, 0x679CD711C5B2AC8E, 0xCC92A943030F0D18, 0xC2BB3CDA074E0076, 
@@ -2841,7 +2841,7 @@ const uint64_t T_tate2_firststep_Q[4 * NWORDS64_FIELD] = {
 
 // From here on all values are in Fp. The table contains eA-2 triples (x,y,l1).
 
-const uint64_t T_tate2_Q[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = { 
+CACHE_ALIGN const uint64_t T_tate2_Q[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = { 
 0x750FCD24D96F498D, 0xE74B7652658B6360, 0x54FB85D2945C71AD, 0xA530239B59D34B1A, 
 0x5E729DB52488A584, 0x8EF15300FCCB833, 0xCF9B1759A390, 0xB751C3B1450C3CFB, 
 0xFCD2CDCDC975A71C, 0xB205AE03102DA534, 0x2A92457AFE850487, 0x11C5DE0150BB9277, 
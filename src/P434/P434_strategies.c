@@ -0,0 +1,88 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/PQCrypto-SIDH
+* Released under MIT license
+*
+* Abstract: isogeny tree traversal strategies storing at most SIKE_MAX_STORED_POINTS points
+*           Generated by strategies-p434, do not edit
+*********************************************************************************************/ 
+
+// Strategies with the fewest operations for the bound, with their number of operations relative to the default strategies
+// (multiplications in GF(p) of the doublings or triplings and isogeny evaluations)
+
+#if (SIKE_MAX_STORED_POINTS == 3)
+
+// At most 3 points, +20.4% operations
+const unsigned int strat_Alice[MAX_Alice-1] = {
+    72, 28, 7, 6, 5, 4, 3, 2, 1, 21, 6, 5, 4, 3, 2, 1, 15, 5, 4, 3, 2, 1, 10, 4, 3, 2, 1, 6, 3, 2, 
+    1, 3, 2, 1, 1, 1, 44, 21, 6, 5, 4, 3, 2, 1, 15, 5, 4, 3, 2, 1, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 
+    2, 1, 1, 1, 26, 12, 5, 4, 3, 2, 1, 7, 4, 3, 2, 1, 4, 2, 1, 2, 1, 1, 15, 7, 3, 2, 1, 4, 2, 1, 
+    2, 1, 1, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1 };
+
+// At most 3 points, +30.1% operations
+const unsigned int strat_Bob[MAX_Bob-1] = {
+    93, 35, 8, 7, 6, 5, 4, 3, 2, 1, 27, 7, 6, 5, 4, 3, 2, 1, 20, 6, 5, 4, 3, 2, 1, 14, 5, 4, 3, 2, 
+    1, 9, 4, 3, 2, 1, 5, 3, 2, 1, 2, 2, 1, 1, 64, 22, 6, 5, 4, 3, 2, 1, 16, 5, 4, 3, 2, 1, 11, 4, 
+    3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 42, 16, 5, 4, 3, 2, 1, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 
+    2, 1, 2, 1, 1, 26, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 15, 7, 3, 2, 1, 4, 2, 1, 2, 
+    1, 1, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1 };
+
+#elif (SIKE_MAX_STORED_POINTS == 4)
+
+// At most 4 points, +6.1% operations
+const unsigned int strat_Alice[MAX_Alice-1] = {
+    57, 30, 15, 5, 4, 3, 2, 1, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 15, 10, 4, 3, 2, 1, 6, 3, 
+    2, 1, 3, 2, 1, 1, 1, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 31, 15, 7, 3, 2, 1, 4, 2, 1, 
+    2, 1, 1, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 
+    1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1 };
+
+// At most 4 points, +9.6% operations
+const unsigned int strat_Bob[MAX_Bob-1] = {
+    77, 38, 16, 5, 4, 3, 2, 1, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 22, 11, 4, 3, 2, 1, 7, 
+    3, 2, 1, 4, 2, 1, 2, 1, 1, 11, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 
+    41, 21, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 11, 6, 3, 2, 1, 3, 2, 1, 1, 1, 5, 3, 2, 1, 
+    1, 1, 2, 1, 1, 1, 20, 11, 6, 3, 2, 1, 3, 2, 1, 1, 1, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 
+    2, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1 };
+
+#elif (SIKE_MAX_STORED_POINTS == 5)
+
+// At most 5 points, +1.4% operations
+const unsigned int strat_Alice[MAX_Alice-1] = {
+    52, 30, 15, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 15, 8, 4, 
+    2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 22, 15, 8, 4, 
+    2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 9, 5, 4, 2, 
+    1, 1, 2, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1 };
+
+// At most 5 points, +2.5% operations
+const unsigned int strat_Bob[MAX_Bob-1] = {
+    61, 40, 21, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 11, 6, 3, 2, 1, 3, 2, 1, 1, 1, 5, 3, 2, 
+    1, 1, 1, 2, 1, 1, 1, 19, 11, 6, 3, 2, 1, 3, 2, 1, 1, 1, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 8, 5, 
+    3, 2, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 27, 15, 9, 6, 3, 2, 1, 3, 2, 1, 1, 1, 4, 2, 
+    2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 
+    2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1 };
+
+#elif (SIKE_MAX_STORED_POINTS == 6)
+
+// At most 6 points, +0.2% operations
+const unsigned int strat_Alice[MAX_Alice-1] = {
+    48, 29, 16, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 
+    1, 1, 13, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 5, 4, 2, 1, 1, 2, 1, 1, 2, 1, 1, 1, 
+    21, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 
+    2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1 };
+
+// At most 6 points, -0.4% operations
+const unsigned int strat_Bob[MAX_Bob-1] = {
+    60, 36, 20, 11, 6, 3, 2, 1, 3, 2, 1, 1, 1, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 
+    2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 16, 9, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 
+    1, 1, 7, 4, 2, 1, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 24, 16, 9, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 
+    4, 2, 1, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 9, 6, 4, 2, 1, 1, 1, 
+    2, 1, 1, 2, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1 };
+
+#else
+
+// Strategies for other bounds, written by "make strategies_p434 SIKE_MAX_STORED_POINTS=k"
+#include "P434_strategies_generated.c"
+
+#endif
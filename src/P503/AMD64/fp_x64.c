@@ -62,6 +62,7 @@ inline void fpadd503(const digit_t* a, const digit_t* b, digit_t* c)
 { // Modular addition, c = a+b mod p503.
   // Inputs: a, b in [0, 2*p503-1] 
   // Output: c in [0, 2*p503-1] 
+    OPCOUNT(fp_add);
     
 #if (OS_TARGET == OS_WIN)
     unsigned int i, carry = 0;
@@ -94,6 +95,7 @@ inline void fpsub503(const digit_t* a, const digit_t* b, digit_t* c)
 { // Modular subtraction, c = a-b mod p503.
   // Inputs: a, b in [0, 2*p503-1] 
   // Output: c in [0, 2*p503-1] 
+    OPCOUNT(fp_sub);
     
 #if (OS_TARGET == OS_WIN)
     unsigned int i, borrow = 0;
@@ -191,10 +193,17 @@ void fpmul503(const digit_t* a, const digit_t* b, digit_t* c)
     fpmul503_asm(a, b, c);
 }
 
+
+void fpsqr503(const digit_t* a, digit_t* c)
+{
+    fpsqr503_asm(a, c);
+}
+
 #else
 
 void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int nwords)
 { // Multiprecision multiply, c = a*b, where lng(a) = lng(b) = nwords.
+    OPCOUNT(mp_mul);
         
     UNREFERENCED_PARAMETER(nwords);
     digit_t t = 0;
@@ -402,6 +411,12 @@ void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int n
 }
 
 
+void mp_sqr(const digit_t* a, digit_t* c, const unsigned int nwords)
+{ // Multiprecision squaring, c = a^2, where lng(a) = nwords.
+    mp_mul(a, a, c, nwords);
+}
+
+
 void rdc_mont(digit_t* ma, digit_t* mc)
 { // Montgomery reduction exploiting special form of the prime.
   // mc = ma*R^-1 mod p503x2, where R = 2^512.
@@ -411,6 +426,7 @@ void rdc_mont(digit_t* ma, digit_t* mc)
     digit_t t = 0;
     uint128_t uv = {0};
     
+    OPCOUNT(rdc);
     mc[0] = ma[0];
     mc[1] = ma[1];
     mc[2] = ma[2];
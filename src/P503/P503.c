@@ -73,7 +73,10 @@ const uint64_t Montgomery_one[NWORDS64_FIELD]    = { 0x00000000000003F9, 0x00000
                                                      0x63CB1A6EA6DED2B4, 0x51689D8D667EB37D, 0x8ACD77C71AB24142, 0x0026FBAEC60F5953 };
 
 
-// Fixed parameters for isogeny tree computation
+// Fixed parameters for isogeny tree computation, or the memory-bounded ones selected with SIKE_MAX_STORED_POINTS
+#if defined(SIKE_MAX_STORED_POINTS)
+#include "P503_strategies.c"
+#else
 const unsigned int strat_Alice[MAX_Alice-1] = { 
 61, 32, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 
 4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 
@@ -88,6 +91,7 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 1, 4, 2, 1, 1, 2, 1, 1, 33, 17, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 
 2, 1, 1, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 1, 2, 
 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1 };
+#endif
            
 // Setting up macro defines and including GF(p), GF(p^2), curve, isogeny and kex functions
 #define fpcopy                        fpcopy503
@@ -99,6 +103,7 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define fpcorrection                  fpcorrection503
 #define fpmul                         fpmul503
 #define fpmul_mont                    fpmul503_mont
+#define fpsqr                         fpsqr503
 #define fpsqr_mont                    fpsqr503_mont
 #define fpinv_mont                    fpinv503_mont
 #define fpinv_chain_mont              fpinv503_chain_mont
@@ -128,6 +133,21 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp503
 #define crypto_kem_enc                crypto_kem_enc_SIKEp503
 #define crypto_kem_dec                crypto_kem_dec_SIKEp503
+#define crypto_kem_keypair_derand     crypto_kem_keypair_derand_SIKEp503
+#define crypto_kem_enc_derand         crypto_kem_enc_derand_SIKEp503
+#define crypto_kem_expand_pk          crypto_kem_expand_pk_SIKEp503
+#define crypto_kem_enc_expanded       crypto_kem_enc_expanded_SIKEp503
+#define crypto_kem_keystore_write     crypto_kem_keystore_write_SIKEp503
+#define crypto_kem_keystore_open      crypto_kem_keystore_open_SIKEp503
+#define crypto_kem_keystore_take      crypto_kem_keystore_take_SIKEp503
+#define crypto_kem_keystore_remaining crypto_kem_keystore_remaining_SIKEp503
+#define crypto_kem_keystore_close     crypto_kem_keystore_close_SIKEp503
+#define kem_scheme                    sike_scheme_SIKEp503
+#define opcount_get                   opcount_get_SIKEp503
+#define opcount_reset                 opcount_reset_SIKEp503
+#define sike_stats_enable             sike_stats_enable_SIKEp503
+#define sike_stats_snapshot           sike_stats_snapshot_SIKEp503
+#define sike_stats_reset              sike_stats_reset_SIKEp503
 #define random_mod_order_A            random_mod_order_A_SIDHp503
 #define random_mod_order_B            random_mod_order_B_SIDHp503
 #define EphemeralKeyGeneration_A      EphemeralKeyGeneration_A_SIDHp503
@@ -138,4 +158,5 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #include "../fpx.c"
 #include "../ec_isogeny.c"
 #include "../sidh.c"    
-#include "../sike.c"
\ No newline at end of file
+#include "../sike.c"
+#include "../keystore.c"
\ No newline at end of file
@@ -10,6 +10,10 @@
 
 #ifndef P503_API_H
 #define P503_API_H
+
+#include "../opcount.h"
+#include "../sike_stats.h"
+#include "../keystore.h"
     
 
 /*********************** Key encapsulation mechanism API ***********************/
@@ -18,6 +22,9 @@
 #define CRYPTO_PUBLICKEYBYTES     378
 #define CRYPTO_BYTES               24
 #define CRYPTO_CIPHERTEXTBYTES    402    // CRYPTO_PUBLICKEYBYTES + MSG_BYTES bytes  
+#define CRYPTO_KEYPAIRCOINBYTES    56    // MSG_BYTES + SECRETKEY_B_BYTES bytes
+#define CRYPTO_ENCCOINBYTES        24    // MSG_BYTES bytes
+#define CRYPTO_EXPANDEDPKBYTES    512    // 4 elements of GF(p^2) in the internal representation
 
 // Algorithm name
 #define CRYPTO_ALGNAME "SIKEp503"  
@@ -40,6 +47,51 @@ int crypto_kem_enc_SIKEp503(unsigned char *ct, unsigned char *ss, const unsigned
 // Outputs: shared secret ss      (CRYPTO_BYTES = 24 bytes)
 int crypto_kem_dec_SIKEp503(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
 
+// SIKE's key generation and encapsulation as above, with their random bytes ("coins") given by the caller, e.g., to generate them in batches.
+// The coins are the secret values s||SK (CRYPTO_KEYPAIRCOINBYTES = 56 bytes), the last byte of SK being masked as in the key
+// generation, and the message m (CRYPTO_ENCCOINBYTES = 24 bytes). With the bytes read from randombytes by crypto_kem_keypair_SIKEp503
+// and crypto_kem_enc_SIKEp503, in that order, they give the same outputs. The coins must be secret and never be reused.
+int crypto_kem_keypair_derand_SIKEp503(unsigned char *pk, unsigned char *sk, const unsigned char *coins);
+int crypto_kem_enc_derand_SIKEp503(unsigned char *ct, unsigned char *ss, const unsigned char *pk, const unsigned char *coins);
+
+// SIKE's encapsulation with an expanded public key, which saves the decoding of pk and the computation of the coefficient A of its curve
+// when several encapsulations use the same public key. crypto_kem_expand_pk_SIKEp503 writes to epk (CRYPTO_EXPANDEDPKBYTES = 512 bytes)
+// the expanded public key of pk, in a representation that is only valid for this library build. crypto_kem_enc_expanded_SIKEp503 gives
+// the outputs of crypto_kem_enc_SIKEp503(ct, ss, pk) for the epk of pk.
+int crypto_kem_expand_pk_SIKEp503(unsigned char *epk, const unsigned char *pk);
+int crypto_kem_enc_expanded_SIKEp503(unsigned char *ct, unsigned char *ss, const unsigned char *pk, const unsigned char *epk);
+
+// Key store (POSIX only): a file of key pairs generated in advance, encrypted with a key of SIKE_KEYSTORE_KEYBYTES = 32 bytes and
+// mapped at start-up, each of which is taken once together with its expanded public key.
+// crypto_kem_keystore_write_SIKEp503 writes "count" key pairs, given by their secret keys sks (count*CRYPTO_SECRETKEYBYTES bytes), to the store "path".
+// crypto_kem_keystore_open_SIKEp503 maps the store "path" after checking its integrity and key, crypto_kem_keystore_take_SIKEp503 takes the next
+// key pair pk, sk and its expanded public key epk (if not NULL), which are erased from the file, and crypto_kem_keystore_close_SIKEp503 unmaps it.
+// They return 0 on success and 1 on errors. crypto_kem_keystore_take_SIKEp503 returns SIKE_KEYSTORE_EMPTY if no key pair is left and
+// SIKE_KEYSTORE_CORRUPT if the slot of the next key pair fails its integrity check. crypto_kem_keystore_remaining_SIKEp503 returns the number
+// of key pairs left.
+int crypto_kem_keystore_write_SIKEp503(const char *path, const unsigned char *key, const unsigned char *sks, unsigned int count);
+int crypto_kem_keystore_open_SIKEp503(sike_keystore *store, const char *path, const unsigned char *key);
+int crypto_kem_keystore_take_SIKEp503(sike_keystore *store, unsigned char *pk, unsigned char *sk, unsigned char *epk);
+unsigned int crypto_kem_keystore_remaining_SIKEp503(const sike_keystore *store);
+void crypto_kem_keystore_close_SIKEp503(sike_keystore *store);
+
+// Field operation counts of the calling thread (see opcount.h), for libraries built with OPCOUNT=TRUE.
+// Writes to ops the operations executed by the calls "call" (an opcount_call) since the last opcount_reset_SIKEp503().
+// Returns 0 on success, 1 if "call" is invalid or the library was built without OPCOUNT=TRUE.
+int opcount_get_SIKEp503(unsigned int call, opcount_t *ops);
+
+// Clear the operation counts of the calling thread
+void opcount_reset_SIKEp503(void);
+
+// Phase timers (see sike_stats.h). Enable (enable != 0) or disable the timers of all threads
+void sike_stats_enable_SIKEp503(int enable);
+
+// Writes to stats the phases timed by the calling thread since the last sike_stats_reset_SIKEp503()
+void sike_stats_snapshot_SIKEp503(sike_stats_t *stats);
+
+// Clear the phase timers of the calling thread
+void sike_stats_reset_SIKEp503(void);
+
 
 // Encoding of keys for KEM-based isogeny system "SIKEp503" (wire format):
 // ----------------------------------------------------------------------
@@ -14,7 +14,7 @@
 // x23 and x2p3 are the product and sum of the x-coordinates of the intermediate double and the tripled point. The last Miller iteration only needs four 
 // precomputed values.
 
-const uint64_t T_tate3[(6 * (OBOB_EXPON - 1) + 4) * NWORDS64_FIELD] = { 
+CACHE_ALIGN const uint64_t T_tate3[(6 * (OBOB_EXPON - 1) + 4) * NWORDS64_FIELD] = { 
 0xC8958D5CEAEE9961, 0x15656BE866831334, 0x3DBF0E58FFD1403F, 0x2A2E6D76A5BD8030, 
 0xCB8B87470EB10976, 0xBF2B2AC3FF0E5842, 0xAA01464195495DC7, 0x3301FE417ADEE4, 
 0x1774317C1AE747D8, 0xF622B72338E21067, 0x66B109C419F65B51, 0x3D8711EDC6BBD998, 
@@ -1926,7 +1926,7 @@ const uint64_t T_tate3[(6 * (OBOB_EXPON - 1) + 4) * NWORDS64_FIELD] = {
 // 2^eA-torsion of E0: y^2 = x^3 + x. Contains a triple (x,y,l1), there the 
 // coordinates x and y of the double of P are in Fp, the slope l1 is in Fp2.
 
-const uint64_t T_tate2_firststep_P[4 * NWORDS64_FIELD] = { 
+CACHE_ALIGN const uint64_t T_tate2_firststep_P[4 * NWORDS64_FIELD] = { 
 0xAEC40A3D269C8FEF, 0xC901D47D0A3E4250, 0xF92DBCF459BDCB5F, 0xD1FCEC504243AC4E, 
 0x35513B7F3D8DA9E, 0x4BCF1E8DFB823BE0, 0xB644A35C2747C746, 0x1387681059CD8F, 
 0x6A2A72A338B50096, 0x8060F6343072AE2B, 0xA41CAE35AE87535E, 0xD1B133E259ECD08F, 
@@ -1940,7 +1940,7 @@ const uint64_t T_tate2_firststep_P[4 * NWORDS64_FIELD] = {
 
 // From here on all values are in Fp. The table contains eA-2 triples (x,y,l1). 
 
-const uint64_t T_tate2_P[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = { 
+CACHE_ALIGN const uint64_t T_tate2_P[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = { 
 0xE15E54C7E1BF6AE1, 0xBBE023A52C58B9BD, 0x4773C7868E2AECDF, 0xD0F31194C4F0F0A6, 
 0x9B6996444464D978, 0x65E876D83C354F, 0xDA6CBD8E40EF5ACF, 0x15CCA1A19B1051, 
 0xEFDF6E4E6C0536E5, 0x649BB3639B1EAC0C, 0xC18DB1639A6E0FA3, 0x6162920D5DF367D2, 
@@ -3435,7 +3435,7 @@ const uint64_t T_tate2_P[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = {
 // 2^eA-torsion of E0: y^2 = x^3 + x. Contains a triple (x,y,l1), there the 
 // coordinates x and y of the double of Q are in Fp, the slope l1 is in Fp2.
 
-const uint64_t T_tate2_firststep_Q[4 * NWORDS64_FIELD] = { 
+CACHE_ALIGN const uint64_t T_tate2_firststep_Q[4 * NWORDS64_FIELD] = { 
 0x273F6C464CB9B30E, 0x83722DBAE9836B36, 0x7236DD158D1A1BBF, 0xCE84ED2FD6FC9B11, 
 0x96804584C42BBFDC, 0xE3D6BF4D45241A13, 0xC4D8AF04CC4F6BEE, 0x653193B290C00, 
 0x3E3209393CB32A2, 0x689964CCAB348A84, 0x74471EFFCED8819B, 0x661D7240B28E2790, 
@@ -3449,7 +3449,7 @@ const uint64_t T_tate2_firststep_Q[4 * NWORDS64_FIELD] = {
 
 // From here on all values are in Fp. The table contains eA-2 triples (x,y,l1). 
 
-const uint64_t T_tate2_Q[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = { 
+CACHE_ALIGN const uint64_t T_tate2_Q[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = { 
 0x85C7CA3E9EADB8EE, 0x97873829844CF9A5, 0x96510E240E86B156, 0xEEDE7282E40EE2EA, 
 0x834790477C5D787E, 0x3B30922B819FBB12, 0x503CBCFF9F6EEA85, 0x310DB49979557B, 
 0xB19D04E98B392C8E, 0xD2E39BFF2A5E96F1, 0x1360F52AE4A91741, 0xABE9E841F06BD82F, 
@@ -0,0 +1,96 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/PQCrypto-SIDH
+* Released under MIT license
+*
+* Abstract: isogeny tree traversal strategies storing at most SIKE_MAX_STORED_POINTS points
+*           Generated by strategies-p503, do not edit
+*********************************************************************************************/ 
+
+// Strategies with the fewest operations for the bound, with their number of operations relative to the default strategies
+// (multiplications in GF(p) of the doublings or triplings and isogeny evaluations)
+
+#if (SIKE_MAX_STORED_POINTS == 3)
+
+// At most 3 points, +21.7% operations
+const unsigned int strat_Alice[MAX_Alice-1] = {
+    88, 29, 7, 6, 5, 4, 3, 2, 1, 22, 6, 5, 4, 3, 2, 1, 16, 5, 4, 3, 2, 1, 11, 4, 3, 2, 1, 7, 3, 2, 
+    1, 4, 2, 1, 2, 1, 1, 59, 22, 6, 5, 4, 3, 2, 1, 16, 5, 4, 3, 2, 1, 11, 4, 3, 2, 1, 7, 3, 2, 1, 
+    4, 2, 1, 2, 1, 1, 37, 16, 5, 4, 3, 2, 1, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 21, 11, 
+    4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 11, 6, 3, 2, 1, 3, 2, 1, 1, 1, 5, 3, 2, 1, 1, 1, 
+    2, 1, 1, 1 };
+
+// At most 3 points, +34.1% operations
+const unsigned int strat_Bob[MAX_Bob-1] = {
+    114, 36, 8, 7, 6, 5, 4, 3, 2, 1, 28, 7, 6, 5, 4, 3, 2, 1, 21, 6, 5, 4, 3, 2, 1, 15, 5, 4, 3, 2, 
+    1, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 78, 28, 7, 6, 5, 4, 3, 2, 1, 21, 6, 5, 4, 3, 2, 
+    1, 15, 5, 4, 3, 2, 1, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 50, 21, 6, 5, 4, 3, 2, 1, 15, 
+    5, 4, 3, 2, 1, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 29, 15, 5, 4, 3, 2, 1, 10, 4, 3, 2, 
+    1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 15, 9, 4, 3, 2, 1, 5, 3, 2, 1, 2, 2, 1, 1, 8, 4, 2, 1, 2, 1, 
+    1, 4, 2, 1, 1, 2, 1, 1 };
+
+#elif (SIKE_MAX_STORED_POINTS == 4)
+
+// At most 4 points, +6.6% operations
+const unsigned int strat_Alice[MAX_Alice-1] = {
+    68, 36, 15, 5, 4, 3, 2, 1, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 21, 10, 4, 3, 2, 1, 6, 3, 
+    2, 1, 3, 2, 1, 1, 1, 11, 6, 3, 2, 1, 3, 2, 1, 1, 1, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 32, 21, 10, 
+    4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 11, 6, 3, 2, 1, 3, 2, 1, 1, 1, 5, 3, 2, 1, 1, 1, 2, 
+    1, 1, 1, 16, 8, 4, 3, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 
+    1, 2, 1, 1 };
+
+// At most 4 points, +11.9% operations
+const unsigned int strat_Bob[MAX_Bob-1] = {
+    95, 42, 16, 5, 4, 3, 2, 1, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 26, 11, 4, 3, 2, 1, 7, 
+    3, 2, 1, 4, 2, 1, 2, 1, 1, 15, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 
+    1, 2, 1, 1, 53, 26, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 15, 7, 3, 2, 1, 4, 2, 1, 2, 
+    1, 1, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 27, 15, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 8, 4, 
+    2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 12, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 5, 3, 2, 
+    1, 1, 1, 1, 2, 1, 1, 1 };
+
+#elif (SIKE_MAX_STORED_POINTS == 5)
+
+// At most 5 points, +1.6% operations
+const unsigned int strat_Alice[MAX_Alice-1] = {
+    62, 31, 17, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 8, 5, 3, 2, 1, 2, 2, 1, 1, 4, 2, 1, 1, 
+    2, 1, 1, 16, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 
+    2, 1, 1, 31, 16, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 
+    1, 2, 1, 1, 15, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 
+    1, 1, 1, 1 };
+
+// At most 5 points, +3.8% operations
+const unsigned int strat_Bob[MAX_Bob-1] = {
+    77, 41, 25, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 14, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 7, 
+    4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 20, 11, 6, 3, 2, 1, 3, 2, 1, 1, 1, 5, 3, 2, 1, 1, 1, 2, 
+    1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 36, 20, 11, 6, 3, 2, 1, 3, 
+    2, 1, 1, 1, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 
+    2, 1, 1, 16, 9, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 1, 2, 
+    1, 1, 3, 2, 1, 1, 1, 1 };
+
+#elif (SIKE_MAX_STORED_POINTS == 6)
+
+// At most 6 points, +0.0% operations
+const unsigned int strat_Alice[MAX_Alice-1] = {
+    58, 31, 16, 10, 6, 3, 2, 1, 3, 2, 1, 1, 1, 4, 3, 2, 1, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 
+    4, 2, 1, 1, 2, 1, 1, 15, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 
+    1, 3, 2, 1, 1, 1, 1, 27, 15, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 
+    1, 1, 3, 2, 1, 1, 1, 1, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 
+    2, 1, 1, 1 };
+
+// At most 6 points, +0.8% operations
+const unsigned int strat_Bob[MAX_Bob-1] = {
+    64, 44, 26, 14, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 7, 4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 12, 7, 4, 
+    2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 18, 12, 7, 4, 2, 1, 2, 1, 
+    1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 7, 4, 3, 2, 1, 1, 1, 1, 2, 1, 1, 3, 
+    2, 1, 1, 1, 1, 28, 16, 9, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 7, 4, 2, 1, 
+    1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 12, 7, 4, 2, 1, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 
+    1, 1, 1, 1, 2, 1, 1, 1 };
+
+#else
+
+// Strategies for other bounds, written by "make strategies_p503 SIKE_MAX_STORED_POINTS=k"
+#include "P503_strategies_generated.c"
+
+#endif
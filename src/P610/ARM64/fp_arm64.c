@@ -36,6 +36,7 @@ inline void fpadd610(const digit_t* a, const digit_t* b, digit_t* c)
 { // Modular addition, c = a+b mod p610.
   // Inputs: a, b in [0, 2*p610-1] 
   // Output: c in [0, 2*p610-1]
+    OPCOUNT(fp_add);
 
     fpadd610_asm(a, b, c);
 } 
@@ -45,6 +46,7 @@ inline void fpsub610(const digit_t* a, const digit_t* b, digit_t* c)
 { // Modular subtraction, c = a-b mod p610.
   // Inputs: a, b in [0, 2*p610-1] 
   // Output: c in [0, 2*p610-1] 
+    OPCOUNT(fp_sub);
 
     fpsub610_asm(a, b, c);
 }
@@ -96,6 +98,7 @@ void fpcorrection610(digit_t* a)
 
 void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int nwords)
 { // Multiprecision multiply, c = a*b, where lng(a) = lng(b) = nwords.
+    OPCOUNT(mp_mul);
 
     UNREFERENCED_PARAMETER(nwords);
 
@@ -103,12 +106,19 @@ void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int n
 }
 
 
+void mp_sqr(const digit_t* a, digit_t* c, const unsigned int nwords)
+{ // Multiprecision squaring, c = a^2, where lng(a) = nwords.
+    mp_mul(a, a, c, nwords);
+}
+
+
 
 void rdc_mont(digit_t* ma, digit_t* mc)
 { // Montgomery reduction exploiting special form of the prime.
   // mc = ma*R^-1 mod p610x2, where R = 2^512.
   // If ma < 2^512*p610, the output mc is in the range [0, 2*p610-1].
   // ma is assumed to be in Montgomery representation.
+    OPCOUNT(rdc);
   
     rdc610_asm(ma, mc);
 }
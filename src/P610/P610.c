@@ -73,7 +73,10 @@ const uint64_t Montgomery_one[NWORDS64_FIELD]    = { 0x00000000670CC8E6, 0x00000
                                                      0x4D99C2BD28717A3F, 0x0A4A1839A323D41C, 0xD2B62215D06AD1E2, 0x1369026E862CAF3D, 0x000000010894E964 };
 
 
-// Fixed parameters for isogeny tree computation
+// Fixed parameters for isogeny tree computation, or the memory-bounded ones selected with SIKE_MAX_STORED_POINTS
+#if defined(SIKE_MAX_STORED_POINTS)
+#include "P610_strategies.c"
+#else
 const unsigned int strat_Alice[MAX_Alice-1] = { 
 67, 37, 21, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 
 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 16, 9, 
@@ -91,6 +94,7 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 17, 9, 5, 3, 2, 1, 1, 
 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 
 1, 1 };
+#endif
 
 // Setting up macro defines and including GF(p), GF(p^2), curve, isogeny and kex functions
 #define fpcopy                        fpcopy610
@@ -102,6 +106,7 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define fpcorrection                  fpcorrection610
 #define fpmul                         fpmul610
 #define fpmul_mont                    fpmul610_mont
+#define fpsqr                         fpsqr610
 #define fpsqr_mont                    fpsqr610_mont
 #define fpinv_mont                    fpinv610_mont
 #define fpinv_chain_mont              fpinv610_chain_mont
@@ -131,6 +136,21 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp610
 #define crypto_kem_enc                crypto_kem_enc_SIKEp610
 #define crypto_kem_dec                crypto_kem_dec_SIKEp610
+#define crypto_kem_keypair_derand     crypto_kem_keypair_derand_SIKEp610
+#define crypto_kem_enc_derand         crypto_kem_enc_derand_SIKEp610
+#define crypto_kem_expand_pk          crypto_kem_expand_pk_SIKEp610
+#define crypto_kem_enc_expanded       crypto_kem_enc_expanded_SIKEp610
+#define crypto_kem_keystore_write     crypto_kem_keystore_write_SIKEp610
+#define crypto_kem_keystore_open      crypto_kem_keystore_open_SIKEp610
+#define crypto_kem_keystore_take      crypto_kem_keystore_take_SIKEp610
+#define crypto_kem_keystore_remaining crypto_kem_keystore_remaining_SIKEp610
+#define crypto_kem_keystore_close     crypto_kem_keystore_close_SIKEp610
+#define kem_scheme                    sike_scheme_SIKEp610
+#define opcount_get                   opcount_get_SIKEp610
+#define opcount_reset                 opcount_reset_SIKEp610
+#define sike_stats_enable             sike_stats_enable_SIKEp610
+#define sike_stats_snapshot           sike_stats_snapshot_SIKEp610
+#define sike_stats_reset              sike_stats_reset_SIKEp610
 #define random_mod_order_A            random_mod_order_A_SIDHp610
 #define random_mod_order_B            random_mod_order_B_SIDHp610
 #define EphemeralKeyGeneration_A      EphemeralKeyGeneration_A_SIDHp610
@@ -141,4 +161,5 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #include "../fpx.c"
 #include "../ec_isogeny.c"
 #include "../sidh.c"
-#include "../sike.c"
\ No newline at end of file
+#include "../sike.c"
+#include "../keystore.c"
\ No newline at end of file
@@ -14,7 +14,7 @@
 // x23 and x2p3 are the product and sum of the x-coordinates of the intermediate double and the tripled point. The last Miller iteration only needs four 
 // precomputed values.
 
-const uint64_t T_tate3[(6 * (OBOB_EXPON - 1) + 4) * NWORDS64_FIELD] = { 
+CACHE_ALIGN const uint64_t T_tate3[(6 * (OBOB_EXPON - 1) + 4) * NWORDS64_FIELD] = { 
 0x1ACACEE95C25B36F, 0x8283860F86A452E9, 0xE463E8A5F4ABDF67, 0x5F4496B7DAFFDFB8, 
 0xB96E4571923D8135, 0xC0A7D039BB9DBC00, 0x5B4B7691B62F4EB9, 0xD5DB546FC843767A, 
 0xBB5D5CB6F297EDE, 0x8683C34F, 0xD51008F74037048C, 0x8C9DA54F68721E6, 
@@ -2897,7 +2897,7 @@ const uint64_t T_tate3[(6 * (OBOB_EXPON - 1) + 4) * NWORDS64_FIELD] = {
 // 2^eA-torsion of E0: y^2 = x^3 + x. Contains a triple (x,y,l1), there the 
 // coordinates x and y of the double of P are in Fp, the slope l1 is in Fp2.
 
-const uint64_t T_tate2_firststep_P[4 * NWORDS64_FIELD] = { 
+CACHE_ALIGN const uint64_t T_tate2_firststep_P[4 * NWORDS64_FIELD] = { 
 0x5BE1ED524F33C52B, 0xE82A6C9C95E44A2, 0x35AC19AA3D2D0C8F, 0xC48D5A6EF316DCEF, 
 0xA75B1FAE1C70541F, 0xBF4709C0460AB142, 0x6B989E232D21267C, 0x1C8F0D2F1F827A73, 
 0x7A1EF44C4B138F94, 0x76F38CA3, 0x1E89B04824B7F00F, 0xB0CECBD277603CC8, 
@@ -2913,7 +2913,7 @@ const uint64_t T_tate2_firststep_P[4 * NWORDS64_FIELD] = {
 
 // From here on all values are in Fp. The table contains eA-2 triples (x,y,l1). 
 
-const uint64_t T_tate2_P[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = { 
+CACHE_ALIGN const uint64_t T_tate2_P[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = { 
 0xE76420CC37DD8308, 0xA92FF26EE4745DAB, 0x377A25B425FFB178, 0x2AF8E297BFCE0D1F, 
 0x2589D47C051EF1EE, 0xDB00E9682F7F9205, 0xE9967060F9E3EC7, 0x154FE450E6CE6B92, 
 0xDA2544169F466B8B, 0x21CDD1EC, 0x79CD0FC4738F4FC5, 0xCEC3E5C7DBCAD38B, 
@@ -5343,7 +5343,7 @@ const uint64_t T_tate2_P[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = {
 // 2^eA-torsion of E0: y^2 = x^3 + x. Contains a triple (x,y,l1), there the 
 // coordinates x and y of the double of Q are in Fp, the slope l1 is in Fp2.
 
-const uint64_t T_tate2_firststep_Q[4 * NWORDS64_FIELD] = { 
+CACHE_ALIGN const uint64_t T_tate2_firststep_Q[4 * NWORDS64_FIELD] = { 
 0x2C9E53071352D43, 0xEF4088AD3E54C6DD, 0xC18E7055D2CFF348, 0x24B3268C87D5F690, 
 0xA3E6D94ADE7B0A93, 0x489BAD43902F0B0E, 0xA1A300A465CBB34A, 0x1E3D0279D17C14C0, 
 0xCC6901CA8B4EB6EE, 0x6DEB13A0, 0xB84B1E242A63879E, 0xD3A74C3D2770FA06, 
@@ -5359,7 +5359,7 @@ const uint64_t T_tate2_firststep_Q[4 * NWORDS64_FIELD] = {
 
 // From here on all values are in Fp. The table contains eA-2 triples (x,y,l1).
 
-const uint64_t T_tate2_Q[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = { 
+CACHE_ALIGN const uint64_t T_tate2_Q[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = { 
 0xD8A293B6CF2BB40, 0xE1B641C07DDEAD64, 0x752811982A639080, 0x5EF082EEF14391C0, 
 0x4E69530B77F63838, 0xE5342EEF727F6792, 0xF833326993E90187, 0xACCA058E8710D072, 
 0x55F4B4F98DF5D0C5, 0x24DBF832, 0xAD40559D73A22753, 0x4FEA70030F3D7C30, 
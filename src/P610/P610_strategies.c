@@ -0,0 +1,104 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/PQCrypto-SIDH
+* Released under MIT license
+*
+* Abstract: isogeny tree traversal strategies storing at most SIKE_MAX_STORED_POINTS points
+*           Generated by strategies-p610, do not edit
+*********************************************************************************************/ 
+
+// Strategies with the fewest operations for the bound, with their number of operations relative to the default strategies
+// (multiplications in GF(p) of the doublings or triplings and isogeny evaluations)
+
+#if (SIKE_MAX_STORED_POINTS == 3)
+
+// At most 3 points, +25.7% operations
+const unsigned int strat_Alice[MAX_Alice-1] = {
+    107, 36, 8, 7, 6, 5, 4, 3, 2, 1, 28, 7, 6, 5, 4, 3, 2, 1, 21, 6, 5, 4, 3, 2, 1, 15, 5, 4, 3, 2, 
+    1, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 71, 28, 7, 6, 5, 4, 3, 2, 1, 21, 6, 5, 4, 3, 2, 
+    1, 15, 5, 4, 3, 2, 1, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 43, 21, 6, 5, 4, 3, 2, 1, 15, 
+    5, 4, 3, 2, 1, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 26, 11, 5, 4, 3, 2, 1, 7, 3, 2, 1, 
+    4, 2, 1, 2, 1, 1, 15, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 
+    1 };
+
+// At most 3 points, +38.3% operations
+const unsigned int strat_Bob[MAX_Bob-1] = {
+    137, 45, 9, 8, 7, 6, 5, 4, 3, 2, 1, 36, 8, 7, 6, 5, 4, 3, 2, 1, 28, 7, 6, 5, 4, 3, 2, 1, 21, 6, 
+    5, 4, 3, 2, 1, 15, 5, 4, 3, 2, 1, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 93, 35, 8, 7, 6, 
+    5, 4, 3, 2, 1, 27, 7, 6, 5, 4, 3, 2, 1, 20, 6, 5, 4, 3, 2, 1, 14, 5, 4, 3, 2, 1, 9, 4, 3, 2, 
+    1, 5, 3, 2, 1, 2, 2, 1, 1, 64, 22, 6, 5, 4, 3, 2, 1, 16, 5, 4, 3, 2, 1, 11, 4, 3, 2, 1, 7, 3, 
+    2, 1, 4, 2, 1, 2, 1, 1, 42, 16, 5, 4, 3, 2, 1, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 
+    26, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 15, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 8, 4, 2, 
+    1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1 };
+
+#elif (SIKE_MAX_STORED_POINTS == 4)
+
+// At most 4 points, +7.8% operations
+const unsigned int strat_Alice[MAX_Alice-1] = {
+    89, 41, 16, 5, 4, 3, 2, 1, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 25, 11, 4, 3, 2, 1, 7, 
+    3, 2, 1, 4, 2, 1, 2, 1, 1, 14, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 7, 4, 2, 1, 2, 1, 1, 3, 2, 1, 
+    1, 1, 1, 48, 25, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 14, 7, 3, 2, 1, 4, 2, 1, 2, 1, 
+    1, 7, 4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 23, 14, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 7, 4, 2, 1, 
+    2, 1, 1, 3, 2, 1, 1, 1, 1, 9, 7, 4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 
+    1 };
+
+// At most 4 points, +14.0% operations
+const unsigned int strat_Bob[MAX_Bob-1] = {
+    107, 57, 21, 6, 5, 4, 3, 2, 1, 15, 5, 4, 3, 2, 1, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 36, 
+    15, 5, 4, 3, 2, 1, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 21, 10, 4, 3, 2, 1, 6, 3, 2, 1, 
+    3, 2, 1, 1, 1, 11, 6, 3, 2, 1, 3, 2, 1, 1, 1, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 56, 30, 15, 5, 4, 
+    3, 2, 1, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 15, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 
+    1, 1, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 30, 15, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 8, 4, 
+    2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 15, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 
+    1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1 };
+
+#elif (SIKE_MAX_STORED_POINTS == 5)
+
+// At most 5 points, +2.4% operations
+const unsigned int strat_Alice[MAX_Alice-1] = {
+    75, 41, 21, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 11, 6, 3, 2, 1, 3, 2, 1, 1, 1, 5, 3, 2, 
+    1, 1, 1, 2, 1, 1, 1, 20, 11, 6, 3, 2, 1, 3, 2, 1, 1, 1, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 9, 5, 
+    3, 2, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 34, 20, 11, 6, 3, 2, 1, 3, 2, 1, 1, 1, 5, 
+    3, 2, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 15, 8, 
+    5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 
+    1 };
+
+// At most 5 points, +4.7% operations
+const unsigned int strat_Bob[MAX_Bob-1] = {
+    98, 52, 26, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 15, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 8, 
+    4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 26, 15, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 8, 4, 2, 1, 2, 
+    1, 1, 4, 2, 1, 1, 2, 1, 1, 12, 7, 4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 
+    2, 1, 1, 1, 47, 26, 14, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 7, 4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 
+    12, 7, 4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 21, 12, 7, 4, 2, 
+    1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 
+    1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1 };
+
+#elif (SIKE_MAX_STORED_POINTS == 6)
+
+// At most 6 points, +0.6% operations
+const unsigned int strat_Alice[MAX_Alice-1] = {
+    69, 37, 21, 14, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 7, 4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 9, 5, 4, 
+    2, 1, 2, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 17, 9, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 4, 
+    2, 1, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 32, 17, 9, 5, 3, 2, 1, 
+    1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 
+    15, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 
+    1 };
+
+// At most 6 points, +1.3% operations
+const unsigned int strat_Bob[MAX_Bob-1] = {
+    84, 52, 30, 15, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 15, 8, 
+    4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 22, 15, 8, 
+    4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 9, 5, 4, 
+    2, 1, 1, 2, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 37, 21, 12, 7, 4, 2, 1, 2, 1, 1, 3, 2, 
+    1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 
+    1, 1, 2, 1, 1, 16, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 7, 4, 2, 1, 
+    1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1 };
+
+#else
+
+// Strategies for other bounds, written by "make strategies_p610 SIKE_MAX_STORED_POINTS=k"
+#include "P610_strategies_generated.c"
+
+#endif
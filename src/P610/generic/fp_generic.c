@@ -56,6 +56,7 @@ inline void fpadd610(const digit_t* a, const digit_t* b, digit_t* c)
     unsigned int i, carry = 0;
     digit_t mask;
 
+    OPCOUNT(fp_add);
     for (i = 0; i < NWORDS_FIELD; i++) {
         ADDC(carry, a[i], b[i], carry, c[i]); 
     }
@@ -80,6 +81,7 @@ inline void fpsub610(const digit_t* a, const digit_t* b, digit_t* c)
     unsigned int i, borrow = 0;
     digit_t mask;
 
+    OPCOUNT(fp_sub);
     for (i = 0; i < NWORDS_FIELD; i++) {
         SUBC(borrow, a[i], b[i], borrow, c[i]); 
     }
@@ -176,6 +178,7 @@ void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int n
     digit_t t = 0, u = 0, v = 0, UV[2];
     unsigned int carry = 0;
     
+    OPCOUNT(mp_mul);
     for (i = 0; i < nwords; i++) {
         for (j = 0; j <= i; j++) {
             MUL(a[j], b[i-j], UV+1, UV[0]); 
@@ -205,6 +208,43 @@ void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int n
 }
 
 
+void mp_sqr(const digit_t* a, digit_t* c, const unsigned int nwords)
+{ // Multiprecision comba squaring, c = a^2, where lng(a) = nwords.
+  // The cross products a[i]*a[j], i < j, of a column are accumulated in (t2, u2, v2) and doubled before adding a[i]^2. 
+    unsigned int i, j, k;
+    digit_t t = 0, u = 0, v = 0, t2, u2, v2, UV[2];
+    unsigned int carry = 0;
+    
+    OPCOUNT(mp_mul);
+    for (k = 0; k < 2*nwords-1; k++) {
+        t2 = 0; u2 = 0; v2 = 0;
+        i = (k < nwords) ? 0 : k-nwords+1;
+        for (j = k-i; i < j; i++, j--) {
+            MUL(a[i], a[j], UV+1, UV[0]); 
+            ADDC(0, UV[0], v2, carry, v2); 
+            ADDC(carry, UV[1], u2, carry, u2); 
+            t2 += carry;
+        }
+        t2 = (t2 << 1) | (u2 >> (RADIX-1));
+        u2 = (u2 << 1) | (v2 >> (RADIX-1));
+        v2 = v2 << 1;
+        if (i == j) {
+            MUL(a[i], a[i], UV+1, UV[0]); 
+            ADDC(0, UV[0], v2, carry, v2); 
+            ADDC(carry, UV[1], u2, carry, u2); 
+            t2 += carry;
+        }
+        ADDC(0, v2, v, carry, v); 
+        ADDC(carry, u2, u, carry, u); 
+        t = t2 + carry;
+        c[k] = v;
+        v = u; 
+        u = t;
+    }
+    c[2*nwords-1] = v; 
+}
+
+
 void rdc_mont(digit_t* ma, digit_t* mc)
 { // Efficient Montgomery reduction using comba and exploiting the special form of the prime p610.
   // mc = ma*R^-1 mod p610x2, where R = 2^768.
@@ -213,6 +253,7 @@ void rdc_mont(digit_t* ma, digit_t* mc)
     unsigned int i, j, carry, count = p610_ZERO_WORDS;
     digit_t UV[2], t = 0, u = 0, v = 0;
 
+    OPCOUNT(rdc);
     for (i = 0; i < NWORDS_FIELD; i++) {
         mc[i] = 0;
     }
@@ -67,6 +67,7 @@ inline void fpadd751(const digit_t* a, const digit_t* b, digit_t* c)
 { // Modular addition, c = a+b mod p751.
   // Inputs: a, b in [0, 2*p751-1] 
   // Output: c in [0, 2*p751-1] 
+    OPCOUNT(fp_add);
     
 #if (OS_TARGET == OS_WIN)
     unsigned int i, carry = 0;
@@ -99,6 +100,7 @@ inline void fpsub751(const digit_t* a, const digit_t* b, digit_t* c)
 { // Modular subtraction, c = a-b mod p751.
   // Inputs: a, b in [0, 2*p751-1] 
   // Output: c in [0, 2*p751-1] 
+    OPCOUNT(fp_sub);
     
 #if (OS_TARGET == OS_WIN)
     unsigned int i, borrow = 0;
@@ -168,6 +170,7 @@ void fpcorrection751(digit_t* a)
 
 void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int nwords)
 { // Multiprecision multiply, c = a*b, where lng(a) = lng(b) = nwords.
+    OPCOUNT(mp_mul);
         
     UNREFERENCED_PARAMETER(nwords);
 
@@ -583,11 +586,26 @@ void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int n
 }
 
 
+void mp_sqr(const digit_t* a, digit_t* c, const unsigned int nwords)
+{ // Multiprecision squaring, c = a^2, where lng(a) = nwords.
+#if (OS_TARGET == OS_NIX) && defined(_MULX_) && defined(_ADX_)
+    OPCOUNT(mp_mul);
+        
+    UNREFERENCED_PARAMETER(nwords);
+
+    sqr751_asm(a, c);
+#else
+    mp_mul(a, a, c, nwords);
+#endif
+}
+
+
 void rdc_mont(digit_t* ma, digit_t* mc)
 { // Montgomery reduction exploiting special form of the prime.
   // mc = ma*R^-1 mod p751x2, where R = 2^768.
   // If ma < 2^768*p751, the output mc is in the range [0, 2*p751-1].
   // ma is assumed to be in Montgomery representation.
+    OPCOUNT(rdc);
         
 #if (OS_TARGET == OS_WIN)
     unsigned int carry;
@@ -71,7 +71,10 @@ const uint64_t Montgomery_one[NWORDS64_FIELD]    = { 0x00000000000249ad, 0x00000
                                                      0x5527b1e4375c6c66, 0x697797bf3f4f24d0, 0xc89db7b2ac5c4e2e, 0x4ca4b439d2076956, 0x10f7926c7512c7e9, 0x00002d5b24bce5e2 };
 
 
-// Fixed parameters for isogeny tree computation
+// Fixed parameters for isogeny tree computation, or the memory-bounded ones selected with SIKE_MAX_STORED_POINTS
+#if defined(SIKE_MAX_STORED_POINTS)
+#include "P751_strategies.c"
+#else
 const unsigned int strat_Alice[MAX_Alice-1] = { 
 80, 48, 27, 15, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 
 1, 3, 2, 1, 1, 1, 1, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 
@@ -91,6 +94,7 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 15, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 
 1, 1, 1, 21, 12, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 5, 3, 2, 1, 1, 1, 1, 
 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1 };
+#endif
 
 // Setting up macro defines and including GF(p), GF(p^2), curve, isogeny and kex functions
 #define fpcopy                        fpcopy751
@@ -130,6 +134,21 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp751
 #define crypto_kem_enc                crypto_kem_enc_SIKEp751
 #define crypto_kem_dec                crypto_kem_dec_SIKEp751
+#define crypto_kem_keypair_derand     crypto_kem_keypair_derand_SIKEp751
+#define crypto_kem_enc_derand         crypto_kem_enc_derand_SIKEp751
+#define crypto_kem_expand_pk          crypto_kem_expand_pk_SIKEp751
+#define crypto_kem_enc_expanded       crypto_kem_enc_expanded_SIKEp751
+#define crypto_kem_keystore_write     crypto_kem_keystore_write_SIKEp751
+#define crypto_kem_keystore_open      crypto_kem_keystore_open_SIKEp751
+#define crypto_kem_keystore_take      crypto_kem_keystore_take_SIKEp751
+#define crypto_kem_keystore_remaining crypto_kem_keystore_remaining_SIKEp751
+#define crypto_kem_keystore_close     crypto_kem_keystore_close_SIKEp751
+#define kem_scheme                    sike_scheme_SIKEp751
+#define opcount_get                   opcount_get_SIKEp751
+#define opcount_reset                 opcount_reset_SIKEp751
+#define sike_stats_enable             sike_stats_enable_SIKEp751
+#define sike_stats_snapshot           sike_stats_snapshot_SIKEp751
+#define sike_stats_reset              sike_stats_reset_SIKEp751
 #define random_mod_order_A            random_mod_order_A_SIDHp751
 #define random_mod_order_B            random_mod_order_B_SIDHp751
 #define EphemeralKeyGeneration_A      EphemeralKeyGeneration_A_SIDHp751
@@ -140,4 +159,5 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #include "../fpx.c"
 #include "../ec_isogeny.c"
 #include "../sidh.c"
-#include "../sike.c"
\ No newline at end of file
+#include "../sike.c"
+#include "../keystore.c"
\ No newline at end of file
@@ -153,7 +153,10 @@ const uint64_t threeinv[NWORDS64_FIELD] = {0x555555555556188F, 0x555555555555555
                                            0x5555555555555555, 0x8105555555555555, 0x1C6290A167C97977, 0xCDD287EA6A6FB6F0, 
                                            0x42DF3D3B8EC96F64, 0x198C3C1346027872, 0xB0528624270642A3, 0xF1E61944CA0};
 
-// Fixed parameters for isogeny tree computation
+// Fixed parameters for isogeny tree computation, or the memory-bounded ones selected with SIKE_MAX_STORED_POINTS
+#if defined(SIKE_MAX_STORED_POINTS)
+#include "P751_strategies.c"
+#else
 const unsigned int strat_Alice[MAX_Alice-1] = { 
 80, 48, 27, 15, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 
 1, 3, 2, 1, 1, 1, 1, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 
@@ -162,8 +165,15 @@ const unsigned int strat_Alice[MAX_Alice-1] = {
 33, 20, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 
 1, 1, 8, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 
 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1 };
+#endif
 
+// Bob's default strategy, kept by his compressed key generation with SIKE_MAX_STORED_POINTS: the torsion basis it pulls back
+// through the dual isogenies depends on their projective representation, and thereby on the strategy
+#if defined(SIKE_MAX_STORED_POINTS)
+const unsigned int strat_Bob_keygen[MAX_Bob-1] = { 
+#else
 const unsigned int strat_Bob[MAX_Bob-1] = { 
+#endif
 112, 63, 32, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 
 1, 4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 
 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 31, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 
@@ -174,7 +184,10 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 1, 1, 1, 21, 12, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 5, 3, 2, 1, 1, 1, 1, 
 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1 };
 
+
 // Fixed traversal strategies for Pohlig-Hellman discrete logs
+// For window sizes other than the default ones they are part of P751_compressed_dlog_tables_generated.c
+#if !defined(DLOG_TABLES_GENERATED) && !defined(_RUNTIME_TABLES_)
 const unsigned int ph2_path[PLEN_2] = {
   #ifdef COMPRESSED_TABLES
       #ifdef ELL2_TORUS
@@ -194,6 +207,7 @@ const unsigned int ph3_path[PLEN_3] = {
     #endif 
   #endif
 };
+#endif
 
 
 // Entangled bases related static tables and parameters
@@ -392,17 +406,50 @@ const uint64_t v_3_torsion[TABLE_V3_LEN][2 * NWORDS64_FIELD] =
 #define EphemeralKeyGeneration_B      EphemeralKeyGeneration_B_SIDHp751_Compressed
 #define EphemeralSecretAgreement_A    EphemeralSecretAgreement_A_SIDHp751_Compressed
 #define EphemeralSecretAgreement_B    EphemeralSecretAgreement_B_SIDHp751_Compressed 
+#define EphemeralSecretAgreement_B_Uncompressed  EphemeralSecretAgreement_B_Uncompressed_SIDHp751_Compressed
+#define PublicKeyDecompression_A      PublicKeyDecompression_A_SIDHp751_Compressed
+#define PublicKeyCompression_A        PublicKeyCompression_A_SIDHp751_Compressed
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp751_compressed
 #define crypto_kem_enc                crypto_kem_enc_SIKEp751_compressed
 #define crypto_kem_dec                crypto_kem_dec_SIKEp751_compressed
+#define crypto_kem_keypair_derand     crypto_kem_keypair_derand_SIKEp751_compressed
+#define crypto_kem_enc_derand         crypto_kem_enc_derand_SIKEp751_compressed
+#define crypto_kem_enc_uncompressed   crypto_kem_enc_uncompressed_SIKEp751_compressed
+#define crypto_kem_compress_pk        crypto_kem_compress_pk_SIKEp751_compressed
+#define crypto_kem_decompress_pk      crypto_kem_decompress_pk_SIKEp751_compressed
+#define kem_scheme                    sike_scheme_SIKEp751_compressed
+#define crypto_kem_workspace_size     crypto_kem_workspace_size_SIKEp751_compressed
+#define crypto_kem_keypair_ws         crypto_kem_keypair_ws_SIKEp751_compressed
+#define crypto_kem_enc_ws             crypto_kem_enc_ws_SIKEp751_compressed
+#define crypto_kem_dec_ws             crypto_kem_dec_ws_SIKEp751_compressed
+#define EphemeralKeyGeneration_A_ws   EphemeralKeyGeneration_A_ws_SIDHp751_Compressed
+#define EphemeralKeyGeneration_B_ws   EphemeralKeyGeneration_B_ws_SIDHp751_Compressed
+#define EphemeralSecretAgreement_A_ws EphemeralSecretAgreement_A_ws_SIDHp751_Compressed
+#define EphemeralSecretAgreement_B_ws EphemeralSecretAgreement_B_ws_SIDHp751_Compressed
+#define tables_hugepages              tables_hugepages_SIKEp751_compressed
+#define tables_init                   tables_init_SIKEp751_compressed
+#define tables_map                    tables_map_SIKEp751_compressed
+#define tables_write                  tables_write_SIKEp751_compressed
+#define opcount_get                   opcount_get_SIKEp751_compressed
+#define opcount_reset                 opcount_reset_SIKEp751_compressed
+#define sike_stats_enable             sike_stats_enable_SIKEp751_compressed
+#define sike_stats_snapshot           sike_stats_snapshot_SIKEp751_compressed
+#define sike_stats_reset              sike_stats_reset_SIKEp751_compressed
+#define sike_threads_shutdown         sike_threads_shutdown_SIKEp751_compressed
 
 
 #include "../fpx.c"
 #include "../ec_isogeny.c"
-#include "../compression/torsion_basis.c"
+#if !defined(_RUNTIME_TABLES_)
 #include "P751_compressed_pair_tables.c"
-#include "../compression/pairing.c"
 #include "P751_compressed_dlog_tables.c"
+#endif
+#include "../compression/tables.c"
+#include "../compression/torsion_basis.c"
+#include "../compression/pairing.c"
 #include "../compression/dlog.c"
+#if defined(_RUNTIME_TABLES_) || defined(TABLES_GENERATOR)
+#include "../compression/tables_gen.c"
+#endif
 #include "../compression/sidh_compressed.c"
 #include "../compression/sike_compressed.c"
\ No newline at end of file
@@ -14,7 +14,7 @@
 // x23 and x2p3 are the product and sum of the x-coordinates of the intermediate double and the tripled point. The last Miller iteration only needs four 
 // precomputed values.
 
-const uint64_t T_tate3[(6 * (OBOB_EXPON - 1) + 4) * NWORDS64_FIELD] = { 
+CACHE_ALIGN const uint64_t T_tate3[(6 * (OBOB_EXPON - 1) + 4) * NWORDS64_FIELD] = { 
 0x27DD15B8A940103C, 0x698445579C6FC8AF, 0xEF0662EE3F8DA506, 0x93D4F81B06781F60, 
 0xC74371742E7C108A, 0x3101E9FA3DF1F2D, 0xF5326D30834BAB52, 0xCC65719BBE7A0F07, 
 0xDDE26695C63C52A9, 0x5EF3096F1CC1375B, 0xC294077DF435C984, 0x82F3986076B, 
@@ -4318,7 +4318,7 @@ const uint64_t T_tate3[(6 * (OBOB_EXPON - 1) + 4) * NWORDS64_FIELD] = {
 // 2^eA-torsion of E0: y^2 = x^3 + x. Contains a triple (x,y,l1), there the 
 // coordinates x and y of the double of P are in Fp, the slope l1 is in Fp2.
 
-const uint64_t T_tate2_firststep_P[4 * NWORDS64_FIELD] = { 
+CACHE_ALIGN const uint64_t T_tate2_firststep_P[4 * NWORDS64_FIELD] = { 
 0xD25C46609D011910, 0x135AF5A98C28ADCB, 0x1FBBAA32F245FF2F, 0xAFD791F380D906A5, 
 0xA7A53C388793D95A, 0xFBD17414C81EC903, 0xEB07E1336AF105F8, 0xAC3EA4E2E4FE53F6, 
 0xB6256871166682DF, 0x53E7689F74C06845, 0x23F839F6531DDBCC, 0x6BC870E1A52, 
@@ -4336,7 +4336,7 @@ const uint64_t T_tate2_firststep_P[4 * NWORDS64_FIELD] = {
 
 // From here on all values are in Fp. The table contains eA-2 triples (x,y,l1).
 
-const uint64_t T_tate2_P[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = { 
+CACHE_ALIGN const uint64_t T_tate2_P[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = { 
 0x5CBA3D258C4DB901, 0xC93BEDE745B295DE, 0xBACDF727F64CA987, 0x83ECDF3588EB0EEF, 
 0xCD2BAC5AB77E0E4, 0x1D56430F8D7803B2, 0xEA6FD88513503E97, 0x92589961E52EBA47, 
 0x915B0E001AEFB2F2, 0x85FE3AD27CF8A2C7, 0xA2A5879C170ABF08, 0x6756AABEF4A2, 
@@ -7672,7 +7672,7 @@ const uint64_t T_tate2_P[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = {
 // 2^eA-torsion of E0: y^2 = x^3 + x. Contains a triple (x,y,l1), there the 
 // coordinates x and y of the double of Q are in Fp, the slope l1 is in Fp2.
 
-const uint64_t T_tate2_firststep_Q[4 * NWORDS64_FIELD] = { 
+CACHE_ALIGN const uint64_t T_tate2_firststep_Q[4 * NWORDS64_FIELD] = { 
 0xAC2B2D74F888733E, 0xDA9B5D82CAA27D78, 0xF8656EBC40D57F4C, 0x5E1CD5BDBF041897, 
 0x1A30C6A718D110C8, 0x42ADEF0DC70D6806, 0x3BFA8FF5013BB159, 0x5E5A1D50DBB0E0C1, 
 0x3BCE4C7EDB3B6E6A, 0xA2C0219900C16A99, 0x18C7D034FA944E4C, 0x6715FAF4D0DA, 
@@ -7690,7 +7690,7 @@ const uint64_t T_tate2_firststep_Q[4 * NWORDS64_FIELD] = {
 
 // From here on all values are in Fp. The table contains eA-2 triples (x,y,l1).
 
-const uint64_t T_tate2_Q[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = { 
+CACHE_ALIGN const uint64_t T_tate2_Q[3 * (OALICE_BITS - 2) * NWORDS64_FIELD] = { 
 0x41FEAA3F231C32B5, 0x97F8BC8686891429, 0x56686BC64B25B1FF, 0x2CC4DECC8CA1D20E, 
 0x6AD16AF6F21BD80F, 0x38CBFDB8AC2567EE, 0x59A5A6E1701EE606, 0x7A6492F0D852FE48, 
 0x26EE6C4CC625968F, 0x76632520C7F63518, 0x7855AF0F7D287025, 0x245A1BD67EFB, 
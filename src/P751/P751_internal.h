@@ -44,8 +44,36 @@
 #define PARAM_A                 6  
 #define PARAM_C                 1
 // Fixed parameters for isogeny tree computation
-#define MAX_INT_POINTS_ALICE    8      
-#define MAX_INT_POINTS_BOB      10 
+// The traversals store at most MAX_INT_POINTS_ALICE and MAX_INT_POINTS_BOB points. SIKE_MAX_STORED_POINTS = k selects the
+// strategies with the fewest operations that store at most k points (see P751_strategies.c). Without it, a stack budget
+// SIKE_STACK_BUDGET = n bytes keeps the default strategies if their points take at most a quarter of n, and otherwise
+// selects the shipped strategies storing the most points (6 to 3) that do
+#if defined(SIKE_STACK_BUDGET) && !defined(SIKE_MAX_STORED_POINTS)
+    #define SIKE_POINT_BYTES    (4*NWORDS64_FIELD*8)    // Projective point x:z of the traversals
+    #if (SIKE_STACK_BUDGET/4 >= 10*SIKE_POINT_BYTES)    // Default strategies
+    #elif (SIKE_STACK_BUDGET/4 >= 6*SIKE_POINT_BYTES)
+        #define SIKE_MAX_STORED_POINTS    6
+    #elif (SIKE_STACK_BUDGET/4 >= 5*SIKE_POINT_BYTES)
+        #define SIKE_MAX_STORED_POINTS    5
+    #elif (SIKE_STACK_BUDGET/4 >= 4*SIKE_POINT_BYTES)
+        #define SIKE_MAX_STORED_POINTS    4
+    #else
+        #define SIKE_MAX_STORED_POINTS    3
+    #endif
+#endif
+#if defined(SIKE_MAX_STORED_POINTS)
+    #if (SIKE_MAX_STORED_POINTS < 1)
+        #error -- "SIKE_MAX_STORED_POINTS must be at least 1"
+    #endif
+    #define MAX_INT_POINTS_ALICE    SIKE_MAX_STORED_POINTS
+    #define MAX_INT_POINTS_BOB      SIKE_MAX_STORED_POINTS
+    #define MAX_INT_POINTS_BOB_KEYGEN    10    // Compressed key generation of Bob, which keeps the default strategy strat_Bob_keygen
+#else
+    #define MAX_INT_POINTS_ALICE    8
+    #define MAX_INT_POINTS_BOB      10
+    #define MAX_INT_POINTS_BOB_KEYGEN    MAX_INT_POINTS_BOB
+    #define strat_Bob_keygen        strat_Bob
+#endif
 #define MAX_Alice               186
 #define MAX_Bob                 239
 #define MSG_BYTES               32
@@ -67,14 +95,30 @@
     #define TABLE_V3_LEN 20
     // Parameters for discrete log computations
     // Binary Pohlig-Hellman reduced to smaller logs of order ell^W
-    #define W_2 4    
-    #define W_3 3
+    // The window sizes can be selected at build time with DLOG_W2 and DLOG_W3, which requires the
+    // tables generated by "make dlog_tables_p751" (see P751_compressed_dlog_tables_generated.c)
+    #if defined(DLOG_W2)
+        #define W_2 DLOG_W2
+    #else
+        #define W_2 4
+    #endif
+    #if defined(DLOG_W3)
+        #define W_3 DLOG_W3
+    #else
+        #define W_3 3
+    #endif
+    #if (W_2 != 4) || (W_3 != 3)
+        #define DLOG_TABLES_GENERATED
+    #endif
+    #if (W_2 < 4) || (OALICE_BITS % W_2 != 0) || (W_3 < 1) || (W_3 > 8)
+        #error -- "Unsupported window sizes for Pohlig-Hellman: W_2 must divide eA and be at least 4, and 1 <= W_3 <= 8"
+    #endif
     // ell^w    
     #define ELL2_W (1 << W_2)    
-    #define ELL3_W 27
+    #define ELL3_W POW3(W_3)
     // ell^(e mod w) 
     #define ELL2_EMODW (1 << (OALICE_BITS % W_2))    
-    #define ELL3_EMODW 9
+    #define ELL3_EMODW POW3(OBOB_EXPON % W_3)
     // # of digits in the discrete log    
     #define DLEN_2 ((OALICE_BITS + W_2 - 1) / W_2) // ceil(eA/W_2)
     #define DLEN_3 ((OBOB_EXPON + W_3 - 1) / W_3) // ceil(eB/W_3)
@@ -86,14 +130,18 @@
     #ifdef COMPRESSED_TABLES
         #if W_2 == 4
             #define PLEN_2 94
+        #else
+            #define PLEN_2 (DLEN_2 + 1)
         #endif
         #ifdef ELL2_TORUS
-            #define W_2_1 3
+            #define W_2_1 (W_2 - 1)
         #endif
 
         #ifdef ELL3_FULL_SIGNED
             #if W_3 == 3
                 #define PLEN_3 81
+            #else
+                #define PLEN_3 (DLEN_3 + 1)
             #endif
         #endif
     #endif
@@ -174,6 +222,7 @@ void rdc751_asm(digit_t* ma, digit_t* mc);
 // Field multiplication using Montgomery arithmetic, c = a*b*R^-1 mod p751, where R=2^768
 void fpmul751_mont(const digit_t* a, const digit_t* b, digit_t* c);
 void mul751_asm(const digit_t* a, const digit_t* b, digit_t* c);
+void sqr751_asm(const digit_t* a, digit_t* c);
    
 // Field squaring using Montgomery arithmetic, c = a*b*R^-1 mod p751, where R=2^768
 void fpsqr751_mont(const digit_t* ma, digit_t* mc);
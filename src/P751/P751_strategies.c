@@ -0,0 +1,112 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/PQCrypto-SIDH
+* Released under MIT license
+*
+* Abstract: isogeny tree traversal strategies storing at most SIKE_MAX_STORED_POINTS points
+*           Generated by strategies-p751, do not edit
+*********************************************************************************************/ 
+
+// Strategies with the fewest operations for the bound, with their number of operations relative to the default strategies
+// (multiplications in GF(p) of the doublings or triplings and isogeny evaluations)
+
+#if (SIKE_MAX_STORED_POINTS == 3)
+
+// At most 3 points, +29.0% operations
+const unsigned int strat_Alice[MAX_Alice-1] = {
+    131, 45, 9, 8, 7, 6, 5, 4, 3, 2, 1, 36, 8, 7, 6, 5, 4, 3, 2, 1, 28, 7, 6, 5, 4, 3, 2, 1, 21, 6, 
+    5, 4, 3, 2, 1, 15, 5, 4, 3, 2, 1, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 93, 29, 8, 7, 6, 
+    5, 4, 3, 2, 1, 22, 6, 5, 4, 3, 2, 1, 16, 5, 4, 3, 2, 1, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 
+    2, 1, 1, 64, 22, 6, 5, 4, 3, 2, 1, 16, 5, 4, 3, 2, 1, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 
+    1, 1, 42, 16, 5, 4, 3, 2, 1, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 26, 11, 4, 3, 2, 1, 
+    7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 15, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 8, 4, 2, 1, 2, 1, 1, 4, 2, 
+    1, 1, 2, 1, 1 };
+
+// At most 3 points, +41.2% operations
+const unsigned int strat_Bob[MAX_Bob-1] = {
+    176, 52, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 42, 9, 8, 7, 6, 5, 4, 3, 2, 1, 33, 8, 7, 6, 5, 4, 3, 2, 
+    1, 25, 7, 6, 5, 4, 3, 2, 1, 18, 6, 5, 4, 3, 2, 1, 12, 5, 4, 3, 2, 1, 7, 4, 3, 2, 1, 4, 2, 1, 
+    2, 1, 1, 130, 37, 8, 7, 6, 5, 4, 3, 2, 1, 29, 7, 6, 5, 4, 3, 2, 1, 22, 6, 5, 4, 3, 2, 1, 16, 5, 
+    4, 3, 2, 1, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 93, 29, 7, 6, 5, 4, 3, 2, 1, 22, 6, 
+    5, 4, 3, 2, 1, 16, 5, 4, 3, 2, 1, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 64, 22, 6, 5, 
+    4, 3, 2, 1, 16, 5, 4, 3, 2, 1, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 42, 16, 5, 4, 3, 
+    2, 1, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 26, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 
+    2, 1, 1, 15, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1 };
+
+#elif (SIKE_MAX_STORED_POINTS == 4)
+
+// At most 4 points, +9.7% operations
+const unsigned int strat_Alice[MAX_Alice-1] = {
+    101, 57, 21, 6, 5, 4, 3, 2, 1, 15, 5, 4, 3, 2, 1, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 36, 
+    15, 5, 4, 3, 2, 1, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 21, 10, 4, 3, 2, 1, 6, 3, 2, 1, 
+    3, 2, 1, 1, 1, 11, 6, 3, 2, 1, 3, 2, 1, 1, 1, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 57, 26, 12, 5, 4, 
+    3, 2, 1, 7, 4, 3, 2, 1, 4, 2, 1, 2, 1, 1, 15, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 8, 4, 2, 1, 2, 
+    1, 1, 4, 2, 1, 1, 2, 1, 1, 31, 15, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 8, 4, 2, 1, 2, 1, 1, 4, 2, 
+    1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 
+    1, 1, 2, 1, 1 };
+
+// At most 4 points, +14.3% operations
+const unsigned int strat_Bob[MAX_Bob-1] = {
+    147, 63, 22, 6, 5, 4, 3, 2, 1, 16, 5, 4, 3, 2, 1, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 
+    41, 16, 5, 4, 3, 2, 1, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 25, 11, 4, 3, 2, 1, 7, 3, 
+    2, 1, 4, 2, 1, 2, 1, 1, 14, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 7, 4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 
+    1, 1, 84, 41, 16, 5, 4, 3, 2, 1, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 25, 11, 4, 3, 2, 
+    1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 14, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 7, 4, 2, 1, 2, 1, 1, 3, 
+    2, 1, 1, 1, 1, 43, 25, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 14, 7, 3, 2, 1, 4, 2, 1, 
+    2, 1, 1, 7, 4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 20, 12, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 5, 4, 
+    2, 1, 2, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1 };
+
+#elif (SIKE_MAX_STORED_POINTS == 5)
+
+// At most 5 points, +2.8% operations
+const unsigned int strat_Alice[MAX_Alice-1] = {
+    94, 51, 25, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 14, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 7, 
+    4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 26, 14, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 7, 4, 2, 1, 2, 1, 
+    1, 3, 2, 1, 1, 1, 1, 12, 7, 4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 
+    1, 1, 43, 26, 14, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 7, 4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 12, 7, 
+    4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 17, 12, 7, 4, 2, 1, 2, 
+    1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 
+    1, 1, 2, 1, 1 };
+
+// At most 5 points, +4.8% operations
+const unsigned int strat_Bob[MAX_Bob-1] = {
+    113, 69, 36, 15, 5, 4, 3, 2, 1, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 21, 10, 4, 3, 2, 1, 6, 
+    3, 2, 1, 3, 2, 1, 1, 1, 11, 6, 3, 2, 1, 3, 2, 1, 1, 1, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 33, 21, 
+    10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 11, 6, 3, 2, 1, 3, 2, 1, 1, 1, 5, 3, 2, 1, 1, 1, 
+    2, 1, 1, 1, 15, 8, 6, 3, 2, 1, 3, 2, 1, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 
+    3, 2, 1, 1, 1, 1, 57, 30, 15, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 
+    2, 1, 1, 15, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 
+    1, 1, 27, 15, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 
+    1, 1, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1 };
+
+#elif (SIKE_MAX_STORED_POINTS == 6)
+
+// At most 6 points, +0.7% operations
+const unsigned int strat_Alice[MAX_Alice-1] = {
+    85, 47, 28, 15, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 13, 8, 
+    4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 5, 4, 2, 1, 1, 2, 1, 1, 2, 1, 1, 1, 21, 12, 7, 4, 2, 
+    1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 
+    1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 38, 21, 12, 7, 4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 
+    1, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 17, 9, 
+    5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 
+    1, 1, 2, 1, 1 };
+
+// At most 6 points, +0.6% operations
+const unsigned int strat_Bob[MAX_Bob-1] = {
+    104, 59, 40, 21, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 11, 6, 3, 2, 1, 3, 2, 1, 1, 1, 5, 3, 
+    2, 1, 1, 1, 2, 1, 1, 1, 19, 11, 6, 3, 2, 1, 3, 2, 1, 1, 1, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 8, 
+    5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 27, 15, 8, 5, 3, 2, 1, 2, 2, 1, 1, 4, 2, 
+    1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 
+    1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 47, 27, 15, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 
+    1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 
+    1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 20, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 
+    2, 1, 1, 1, 1, 2, 1, 1, 1, 8, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1 };
+
+#else
+
+// Strategies for other bounds, written by "make strategies_p751 SIKE_MAX_STORED_POINTS=k"
+#include "P751_strategies_generated.c"
+
+#endif
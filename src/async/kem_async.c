@@ -0,0 +1,437 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/PQCrypto-SIDH
+* Released under MIT license
+*
+* Abstract: asynchronous execution of SIKE operations through submission/completion rings
+*
+* Jobs are passed by reference through two bounded lock-free MPMC rings. Workers only block
+* (on a condition variable) when the submission ring is empty, and submitters only take the
+* lock when some worker is actually sleeping.
+*********************************************************************************************/
+
+#if defined(__linux__)
+    #define _GNU_SOURCE
+#endif
+#include "kem_async.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#if defined(__linux__)
+    #include <sys/eventfd.h>
+#endif
+
+#define CACHE_LINE_BYTES      64
+#define DEFAULT_RING_SIZE    256
+
+
+typedef struct {
+    atomic_size_t seq;
+    kem_async_job *job;
+} ring_cell;
+
+typedef struct {
+    ring_cell *cells;
+    size_t mask;
+    char pad0[CACHE_LINE_BYTES];
+    atomic_size_t head;                // Next position to be written
+    char pad1[CACHE_LINE_BYTES];
+    atomic_size_t tail;                // Next position to be read
+    char pad2[CACHE_LINE_BYTES];
+} job_ring;
+
+typedef struct {                       // Sleeping side of a ring
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    atomic_uint sleepers;
+} ring_waiters;
+
+typedef struct {
+    kem_async_queue *queue;
+    unsigned int index;
+} worker_arg;
+
+struct kem_async_queue {
+    job_ring submission;
+    job_ring completion;
+    ring_waiters workers;
+    ring_waiters consumers;
+    atomic_uint in_flight;
+    unsigned int capacity;
+    int stop;                          // Protected by workers.mutex
+    int event_fd;
+    int *cpus;                         // Copy of the CPU list of the configuration, or NULL
+    unsigned int num_workers;
+    pthread_t *threads;
+    worker_arg *args;
+};
+
+
+static int ring_init(job_ring *ring, size_t size)
+{ // Initialize a ring with "size" cells, size a power of 2
+    size_t i;
+
+    ring->cells = (ring_cell*)calloc(size, sizeof(ring_cell));
+    if (ring->cells == NULL) {
+        return 1;
+    }
+    for (i = 0; i < size; i++) {
+        atomic_init(&ring->cells[i].seq, i);
+    }
+    ring->mask = size - 1;
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    return 0;
+}
+
+
+static int ring_push(job_ring *ring, kem_async_job *job)
+{ // Append a job to the ring. Returns 1 if the ring is full.
+    ring_cell *cell;
+    size_t pos = atomic_load_explicit(&ring->head, memory_order_relaxed), seq;
+    intptr_t diff;
+
+    for (;;) {
+        cell = &ring->cells[pos & ring->mask];
+        seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+        diff = (intptr_t)seq - (intptr_t)pos;
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&ring->head, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return 1;
+        } else {
+            pos = atomic_load_explicit(&ring->head, memory_order_relaxed);
+        }
+    }
+    cell->job = job;
+    atomic_store_explicit(&cell->seq, pos + 1, memory_order_release);
+    return 0;
+}
+
+
+static kem_async_job* ring_pop(job_ring *ring)
+{ // Remove the oldest job from the ring. Returns NULL if the ring is empty.
+    ring_cell *cell;
+    kem_async_job *job;
+    size_t pos = atomic_load_explicit(&ring->tail, memory_order_relaxed), seq;
+    intptr_t diff;
+
+    for (;;) {
+        cell = &ring->cells[pos & ring->mask];
+        seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+        diff = (intptr_t)seq - (intptr_t)(pos + 1);
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&ring->tail, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return NULL;
+        } else {
+            pos = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+        }
+    }
+    job = cell->job;
+    atomic_store_explicit(&cell->seq, pos + ring->mask + 1, memory_order_release);
+    return job;
+}
+
+
+static void wake_one(ring_waiters *waiters)
+{ // Wake up a sleeper after publishing a job, if there is any. Pairs with the fence in the waiting functions.
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&waiters->sleepers, memory_order_relaxed) != 0) {
+        pthread_mutex_lock(&waiters->mutex);
+        pthread_cond_signal(&waiters->cond);
+        pthread_mutex_unlock(&waiters->mutex);
+    }
+}
+
+
+static void wake_all(ring_waiters *waiters)
+{ // Wake up all the sleepers, if there is any. Pairs with the fence in the waiting functions.
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&waiters->sleepers, memory_order_relaxed) != 0) {
+        pthread_mutex_lock(&waiters->mutex);
+        pthread_cond_broadcast(&waiters->cond);
+        pthread_mutex_unlock(&waiters->mutex);
+    }
+}
+
+
+static kem_async_job* wait_for_job(kem_async_queue *queue)
+{ // Block until a job is submitted. Returns NULL when the queue is stopped and drained.
+    kem_async_job *job;
+
+    pthread_mutex_lock(&queue->workers.mutex);
+    atomic_fetch_add(&queue->workers.sleepers, 1);
+    atomic_thread_fence(memory_order_seq_cst);
+    while ((job = ring_pop(&queue->submission)) == NULL && !queue->stop) {
+        pthread_cond_wait(&queue->workers.cond, &queue->workers.mutex);
+    }
+    atomic_fetch_sub(&queue->workers.sleepers, 1);
+    pthread_mutex_unlock(&queue->workers.mutex);
+    return job;
+}
+
+
+static void run_job(kem_async_job *job)
+{ // Execute a job with the functions of its parameter set
+    const kem_async_scheme *scheme = job->scheme;
+
+    switch (job->op) {
+    case KEM_ASYNC_KEYPAIR:
+        job->status = scheme->keypair(job->args.keypair.pk, job->args.keypair.sk);
+        break;
+    case KEM_ASYNC_ENC:
+        job->status = scheme->enc(job->args.enc.ct, job->args.enc.ss, job->args.enc.pk);
+        break;
+    case KEM_ASYNC_DEC:
+        job->status = scheme->dec(job->args.dec.ss, job->args.dec.ct, job->args.dec.sk);
+        break;
+    default:
+        job->status = 1;
+    }
+}
+
+
+static void pin_worker(const kem_async_queue *queue, unsigned int index)
+{ // Pin the calling worker to its CPU, if a CPU list was provided
+#if defined(__linux__)
+    cpu_set_t set;
+
+    if (queue->cpus != NULL) {
+        CPU_ZERO(&set);
+        CPU_SET(queue->cpus[index], &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &set);
+    }
+#else
+    (void)queue; (void)index;
+#endif
+}
+
+
+static void* worker_main(void *arg)
+{ // Worker thread: execute submitted jobs and move them to the completion ring
+    kem_async_queue *queue = ((worker_arg*)arg)->queue;
+    kem_async_job *job;
+
+    pin_worker(queue, ((worker_arg*)arg)->index);
+
+    for (;;) {
+        job = ring_pop(&queue->submission);
+        if (job == NULL) {
+            job = wait_for_job(queue);
+            if (job == NULL) {
+                break;
+            }
+        }
+        run_job(job);
+        ring_push(&queue->completion, job);    // Cannot fail, at most "capacity" jobs are in flight
+#if defined(__linux__)
+        if (queue->event_fd != -1) {
+            uint64_t one = 1;
+            if (write(queue->event_fd, &one, sizeof(one)) < 0) {}    // Only fails if the counter saturates, the fd is readable anyway
+        }
+#endif
+        wake_one(&queue->consumers);
+    }
+    return NULL;
+}
+
+
+static void waiters_init(ring_waiters *waiters)
+{
+    pthread_mutex_init(&waiters->mutex, NULL);
+    pthread_cond_init(&waiters->cond, NULL);
+    atomic_init(&waiters->sleepers, 0);
+}
+
+
+static void waiters_free(ring_waiters *waiters)
+{
+    pthread_cond_destroy(&waiters->cond);
+    pthread_mutex_destroy(&waiters->mutex);
+}
+
+
+static void queue_free(kem_async_queue *queue)
+{ // Release the resources of a queue whose workers are not running
+#if defined(__linux__)
+    if (queue->event_fd != -1) {
+        close(queue->event_fd);
+    }
+#endif
+    waiters_free(&queue->workers);
+    waiters_free(&queue->consumers);
+    free(queue->submission.cells);
+    free(queue->completion.cells);
+    free(queue->threads);
+    free(queue->args);
+    free(queue->cpus);
+    free(queue);
+}
+
+
+kem_async_queue* kem_async_create(const kem_async_config *config)
+{ // Create a queue and start its worker threads
+    kem_async_queue *queue;
+    unsigned int i, size = DEFAULT_RING_SIZE, num_workers = 0;
+    long ncpus;
+
+    if (config != NULL && config->ring_size != 0) {
+        for (size = 1; size < config->ring_size; size <<= 1) {}
+    }
+    if (config != NULL) {
+        num_workers = config->num_workers;
+    }
+    if (num_workers == 0) {
+        ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+        num_workers = (ncpus > 0) ? (unsigned int)ncpus : 1;
+    }
+
+    queue = (kem_async_queue*)calloc(1, sizeof(kem_async_queue));
+    if (queue == NULL) {
+        return NULL;
+    }
+    waiters_init(&queue->workers);
+    waiters_init(&queue->consumers);
+    atomic_init(&queue->in_flight, 0);
+    queue->capacity = size;
+    queue->event_fd = -1;
+    queue->threads = (pthread_t*)calloc(num_workers, sizeof(pthread_t));
+    queue->args = (worker_arg*)calloc(num_workers, sizeof(worker_arg));
+    if (queue->threads == NULL || queue->args == NULL || ring_init(&queue->submission, size) != 0 || ring_init(&queue->completion, size) != 0) {
+        queue_free(queue);
+        return NULL;
+    }
+    if (config != NULL && config->cpus != NULL) {    // The workers read the list after kem_async_create returns
+        queue->cpus = (int*)malloc(num_workers*sizeof(int));
+        if (queue->cpus == NULL) {
+            queue_free(queue);
+            return NULL;
+        }
+        for (i = 0; i < num_workers; i++) {
+            queue->cpus[i] = config->cpus[i];
+        }
+    }
+
+    if (config != NULL && config->use_eventfd) {
+#if defined(__linux__)
+        queue->event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+#endif
+        if (queue->event_fd == -1) {
+            queue_free(queue);
+            return NULL;
+        }
+    }
+
+    for (i = 0; i < num_workers; i++) {
+        queue->args[i].queue = queue;
+        queue->args[i].index = i;
+        if (pthread_create(&queue->threads[i], NULL, worker_main, &queue->args[i]) != 0) {
+            queue->num_workers = i;
+            kem_async_destroy(queue);
+            return NULL;
+        }
+    }
+    queue->num_workers = num_workers;
+
+    return queue;
+}
+
+
+void kem_async_destroy(kem_async_queue *queue)
+{ // Stop the worker threads after the submitted jobs have been executed and release the queue
+    unsigned int i;
+
+    if (queue == NULL) {
+        return;
+    }
+    pthread_mutex_lock(&queue->workers.mutex);
+    queue->stop = 1;
+    pthread_cond_broadcast(&queue->workers.cond);
+    pthread_mutex_unlock(&queue->workers.mutex);
+
+    for (i = 0; i < queue->num_workers; i++) {
+        pthread_join(queue->threads[i], NULL);
+    }
+    queue_free(queue);
+}
+
+
+int kem_async_submit(kem_async_queue *queue, kem_async_job *job)
+{ // Submit a job. Returns 1 if the queue is full.
+
+    if (atomic_fetch_add(&queue->in_flight, 1) >= queue->capacity) {
+        atomic_fetch_sub(&queue->in_flight, 1);
+        return 1;
+    }
+    ring_push(&queue->submission, job);        // Cannot fail, at most "capacity" jobs are in flight
+    wake_one(&queue->workers);
+    return 0;
+}
+
+
+static unsigned int take_completed(kem_async_queue *queue, kem_async_job **jobs, unsigned int max_jobs, int *drained)
+{ // Remove up to "max_jobs" completed jobs. Sets "drained" if they were the last jobs in flight.
+    unsigned int n = 0;
+
+    while (n < max_jobs && (jobs[n] = ring_pop(&queue->completion)) != NULL) {
+        n++;
+    }
+    *drained = (n != 0 && atomic_fetch_sub(&queue->in_flight, n) == n);
+    return n;
+}
+
+
+unsigned int kem_async_poll(kem_async_queue *queue, kem_async_job **jobs, unsigned int max_jobs)
+{ // Retrieve up to "max_jobs" completed jobs without blocking
+    int drained;
+    unsigned int n = take_completed(queue, jobs, max_jobs, &drained);
+
+    if (drained) {
+        wake_all(&queue->consumers);        // Other waiters have no completion left to wait for
+    }
+    return n;
+}
+
+
+unsigned int kem_async_wait(kem_async_queue *queue, kem_async_job **jobs, unsigned int max_jobs)
+{ // Retrieve up to "max_jobs" completed jobs, blocking until at least one is available
+    unsigned int n;
+    int drained;
+
+    if (max_jobs == 0 || atomic_load(&queue->in_flight) == 0) {
+        return 0;
+    }
+    n = kem_async_poll(queue, jobs, max_jobs);
+    if (n != 0) {
+        return n;
+    }
+
+    pthread_mutex_lock(&queue->consumers.mutex);
+    atomic_fetch_add(&queue->consumers.sleepers, 1);
+    atomic_thread_fence(memory_order_seq_cst);
+    while ((n = take_completed(queue, jobs, max_jobs, &drained)) == 0 && atomic_load(&queue->in_flight) != 0) {
+        pthread_cond_wait(&queue->consumers.cond, &queue->consumers.mutex);
+    }
+    atomic_fetch_sub(&queue->consumers.sleepers, 1);
+    pthread_mutex_unlock(&queue->consumers.mutex);
+    if (drained) {
+        wake_all(&queue->consumers);
+    }
+    return n;
+}
+
+
+int kem_async_eventfd(const kem_async_queue *queue)
+{ // File descriptor that becomes readable when jobs complete, or -1 if not enabled
+    return queue->event_fd;
+}
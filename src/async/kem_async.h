@@ -0,0 +1,75 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/PQCrypto-SIDH
+* Released under MIT license
+*
+* Abstract: asynchronous execution of SIKE operations through submission/completion rings
+*********************************************************************************************/
+
+#ifndef KEM_ASYNC_H
+#define KEM_ASYNC_H
+
+
+// Parameter-set descriptor: the KEM functions of one library variant, e.g.,
+// KEM_ASYNC_SCHEME(SIKEp434) or KEM_ASYNC_SCHEME(SIKEp751_compressed)
+typedef struct {
+    int (*keypair)(unsigned char *pk, unsigned char *sk);
+    int (*enc)(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+    int (*dec)(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
+} kem_async_scheme;
+
+#define KEM_ASYNC_SCHEME(name)    { crypto_kem_keypair_##name, crypto_kem_enc_##name, crypto_kem_dec_##name }
+
+typedef enum {
+    KEM_ASYNC_KEYPAIR,
+    KEM_ASYNC_ENC,
+    KEM_ASYNC_DEC
+} kem_async_op;
+
+// Job descriptor. It is owned by the caller and must stay alive until it is returned by the completion ring.
+// Buffers follow the argument order of the corresponding crypto_kem_* function.
+typedef struct {
+    const kem_async_scheme *scheme;
+    kem_async_op op;
+    union {
+        struct { unsigned char *pk; unsigned char *sk; } keypair;
+        struct { unsigned char *ct; unsigned char *ss; const unsigned char *pk; } enc;
+        struct { unsigned char *ss; const unsigned char *ct; const unsigned char *sk; } dec;
+    } args;
+    int status;                    // Return value of the crypto_kem_* call
+    void *user_data;               // Not touched by the queue
+} kem_async_job;
+
+typedef struct {
+    unsigned int num_workers;      // Number of worker threads (0 selects the number of online CPUs)
+    unsigned int ring_size;        // Maximum number of jobs in flight, rounded up to a power of 2 (0 selects 256)
+    const int *cpus;               // Optional list of "num_workers" CPUs to pin the workers to, e.g., the CPUs of one NUMA node (copied)
+    int use_eventfd;               // Signal completions through an eventfd (Linux only)
+} kem_async_config;
+
+typedef struct kem_async_queue kem_async_queue;
+
+
+// Create a queue and start its worker threads. Returns NULL on failure.
+kem_async_queue* kem_async_create(const kem_async_config *config);
+
+// Stop the worker threads after the submitted jobs have been executed and release the queue
+void kem_async_destroy(kem_async_queue *queue);
+
+// Submit a job. Returns 0 on success, 1 if "ring_size" jobs are already in flight.
+int kem_async_submit(kem_async_queue *queue, kem_async_job *job);
+
+// Retrieve up to "max_jobs" completed jobs without blocking. Returns the number of jobs written to "jobs".
+unsigned int kem_async_poll(kem_async_queue *queue, kem_async_job **jobs, unsigned int max_jobs);
+
+// Retrieve up to "max_jobs" completed jobs, blocking until at least one is available. Returns 0 if no job is in flight,
+// including when another thread waiting on the same queue has taken the last one.
+unsigned int kem_async_wait(kem_async_queue *queue, kem_async_job **jobs, unsigned int max_jobs);
+
+// File descriptor that becomes readable when jobs complete (see eventfd(2)), or -1 if not enabled
+int kem_async_eventfd(const kem_async_queue *queue);
+
+
+#endif
@@ -12,78 +12,51 @@
 
 void from_base(int *D, digit_t *r, int Dlen, int base) 
 { // Convert a number in base "base" with signed digits: (D[k-1]D[k-2]...D[1]D[0])_base < 2^(NWORDS_ORDER*RADIX) into decimal 
-  // Output: r = (D[k-1]*base^(k-1) + ... + D[1]*base + D[0])_10
-    digit_t ell[NWORDS_ORDER] = {0}, digit[NWORDS_ORDER] = {0}, temp[NWORDS_ORDER] = {0};    
-    int ellw;
+  // Output: r = (D[k-1]*base^(k-1) + ... + D[1]*base + D[0])_10 mod the order, i.e., mod 2^eA for even base and mod 3^eB for odd base
+  // The signed value is accumulated exactly with one word multiply-add per digit and reduced once at the end, without branching on the digits.
+    unsigned int i, j, e, L, carry, bout, c;
+    digit_t a, m, u, v, UV[2], acc[NWORDS_ORDER+1] = {0}, o[NWORDS_ORDER+1] = {0}, t[NWORDS_ORDER+1];
     
-    ell[0] = base;
-    if (D[Dlen-1] < 0) {
-        digit[0] = (digit_t)(((int)-D[Dlen-1])*ell[0]);
-        if ((base & 1) == 0) {
-            Montgomery_neg(digit, (digit_t*)Alice_order);
-            copy_words(digit, r, NWORDS_ORDER);
-        } else {
-            mp_sub((digit_t*)Bob_order, digit, r, NWORDS_ORDER);             
-        }        
-    } else {
-        r[0] = (digit_t)(D[Dlen-1]*ell[0]);
+    for (i = Dlen; i > 0; i--) {               // acc = acc*base + D[i-1], in two's complement over NWORDS_ORDER+1 words
+        a = (digit_t)D[i-1];                   // Sign-extended digit ...
+        m = (digit_t)0 - (digit_t)((unsigned int)D[i-1] >> (8*sizeof(int)-1));    // ... and its sign mask for the upper words
+        u = 0;
+        c = 0;
+        for (j = 0; j < NWORDS_ORDER+1; j++) {
+            MUL(acc[j], (digit_t)base, UV+1, UV[0]);
+            ADDC(0, UV[0], u, carry, v);
+            u = UV[1] + (digit_t)carry;
+            ADDC(c, v, (j == 0 ? a : m), c, acc[j]);
+        }
     }
 
-    for (int i = Dlen-2; i >= 1; i--) {
-        ellw = base;
-        memset(digit,0,NWORDS_ORDER*sizeof(digit_t));
-        if (D[i] < 0) {
-            digit[0] = (digit_t)(-D[i]);
-            if ((base & 1) == 0) {
-                Montgomery_neg(digit, (digit_t*)Alice_order);
-            } else {  
-                mp_sub((digit_t*)Bob_order, digit, digit, NWORDS_ORDER);                            
+    if ((base & 1) == 0) {                     // Alice's order is 2^eA: reduction is a truncation
+        for (i = 0; i < NWORDS_ORDER; i++) {
+            if (i*RADIX >= OALICE_BITS) {
+                acc[i] = 0;
+            } else if ((i+1)*RADIX > OALICE_BITS) {
+                acc[i] &= ((digit_t)1 << (OALICE_BITS % RADIX)) - 1;
             }
-        } else {
-            digit[0] = (digit_t)D[i];
         }
-        mp_add(r, digit, r, NWORDS_ORDER);
-        if ((base & 1) != 0) {
-            if (!is_orderelm_lt(r, (digit_t*)Bob_order))
-                mp_sub(r,(digit_t*)Bob_order, r, NWORDS_ORDER);               
+    } else {                                   // |acc| < base^k = 3^e*Bob_order, with 3^e <= 2^L
+        for (i = 1, e = 0; i < (unsigned int)base; i *= 3) 
+            e++;
+        for (i = 1, e = e*Dlen - OBOB_EXPON; e > 0; e--) 
+            i *= 3;
+        for (L = 0; ((unsigned int)1 << L) < i; L++);
+
+        copy_words((digit_t*)Bob_order, o, NWORDS_ORDER);
+        mp_shiftleft(o, L, NWORDS_ORDER+1);
+        mp_add(acc, o, acc, NWORDS_ORDER+1);  // acc in [0, 2^(L+1)*Bob_order). Subtract 2^l*Bob_order for l = L,...,0 whenever it fits
+        for (i = 0; i <= L; i++) {
+            bout = mp_sub(acc, o, t, NWORDS_ORDER+1);
+            m = (digit_t)0 - (digit_t)bout;    // m = 0 if acc >= 2^l*Bob_order, else m = -1
+            for (j = 0; j < NWORDS_ORDER+1; j++)
+                acc[j] = (acc[j] & m) | (t[j] & ~m);
+            mp_shiftr1(o, NWORDS_ORDER+1);
         }
-        
-        if ((base & 1) == 0) {
-            while (ellw > 1) {
-                mp_add(r, r, r, NWORDS_ORDER);   
-                ellw /= 2;
-            }
-        } else {
-            while (ellw > 1) {
-                memset(temp,0,NWORDS_ORDER*sizeof(digit_t));
-                mp_add(r, r, temp, NWORDS_ORDER);
-                if (!is_orderelm_lt(temp, (digit_t*)Bob_order)) 
-                    mp_sub(temp,(digit_t*)Bob_order, temp, NWORDS_ORDER);
-                
-                mp_add(r, temp, r, NWORDS_ORDER);
-
-                if (!is_orderelm_lt(r, (digit_t*)Bob_order))
-                    mp_sub(r,(digit_t*)Bob_order, r, NWORDS_ORDER);                
-                ellw /= 3;
-            }
-        }
-    }
-    memset(digit,0,NWORDS_ORDER*sizeof(digit_t));
-    if (D[0] < 0) {
-        digit[0] = (digit_t)(-D[0]);
-        if ((base & 1) == 0) {
-            Montgomery_neg(digit, (digit_t*)Alice_order);
-        } else { 
-            mp_sub((digit_t*)Bob_order, digit, digit, NWORDS_ORDER);            
-        }
-    } else {
-        digit[0] = (digit_t)D[0];
-    }
-    mp_add(r, digit, r, NWORDS_ORDER);
-    if ((base & 1) != 0) { 
-        if (!is_orderelm_lt(r, (digit_t*)Bob_order))
-            mp_sub(r,(digit_t*)Bob_order, r, NWORDS_ORDER);     
     }
+    copy_words(acc, r, NWORDS_ORDER);
 }
 
 
@@ -230,6 +203,9 @@ void Traverse_w_div_e_torus(const felm_t *r, int j, int k, int z, const unsigned
         
         Traverse_w_div_e_torus(rp, j + (z - t), k, t, P, CT, D, Dlen, ellw, w);  
         
+        for (int h = k; h < k + t; h++) {    // The digits are known, fetch all the table entries before the multiplications
+            if (D[h] != 0) prefetch_range(CT[(j + h)*(ellw/2) + (D[h] < 0 ? -D[h]-1 : D[h]-1)], sizeof(felm_t));
+        }
         fp2copy(r, rp);
         for (int h = k; h < k + t; h++) {
             if (D[h] != 0) {
@@ -247,7 +223,7 @@ void Traverse_w_div_e_torus(const felm_t *r, int j, int k, int z, const unsigned
         fpcorrection((digit_t*)&r[0]);
         fpcorrection((digit_t*)&r[1]);
 
-        D[k] = ord2w_dloghyb(r, (const int *)&ph2_Log, (const felm_t *)&ph2_Texp, (const felm_t *)&ph2_G);           
+        D[k] = ord2w_dloghyb(r, (const int *)comp_tables.ph2_Log, (const felm_t *)comp_tables.ph2_Texp, (const felm_t *)comp_tables.ph2_G);           
     }
 }
 
@@ -277,6 +253,9 @@ void Traverse_w_div_e_fullsigned(const f2elm_t r, int j, int k, int z, const uns
         
         Traverse_w_div_e_fullsigned(rp, j + (z - t), k, t, P, CT, D, Dlen, ellw, w);  
         
+        for (int h = k; h < k + t; h++) {    // The digits are known, fetch all the table entries before the multiplications
+            if (D[h] != 0) prefetch_range(CT + 2*((j + h)*(ellw/2) + (D[h] < 0 ? -D[h]-1 : D[h]-1)), sizeof(f2elm_t));
+        }
         fp2copy(r, rp);
         for (int h = k; h < k + t; h++) {
             if (D[h] != 0) {
@@ -337,6 +316,9 @@ void Traverse_w_notdiv_e_fullsigned(const f2elm_t r, int j, int k, int z, const
 
         Traverse_w_notdiv_e_fullsigned(rp, j + (z - t), k, t, P, CT1, CT2, D, Dlen, ell, ellw, ell_emodw, w, e);  
         
+        for (int h = k; h < k + t; h++) {    // The digits are known, fetch all the table entries before the multiplications
+            if (D[h] != 0) prefetch_range(((j > 0) ? CT2 : CT1) + 2*((j + h)*(ellw/2) + (D[h] < 0 ? -D[h]-1 : D[h]-1)), sizeof(f2elm_t));
+        }
         fp2copy(r, rp);
         for (int h = k; h < k + t; h++) {
             if (D[h] != 0) {
@@ -411,17 +393,18 @@ void Traverse_w_notdiv_e_fullsigned(const f2elm_t r, int j, int k, int z, const
 void solve_dlog(const f2elm_t r, int *D, digit_t* d, int ell)
 { // Computes the discrete log of input r = g^d where g = e(P,Q)^ell^e, and P,Q are torsion generators in the initial curve
   // Return the integer d  
+    tables_ensure();
     if (ell == 2) {
         felm_t rproj[2];
         toproj(r, rproj);  
-        Traverse_w_div_e_torus(rproj, 0, 0, PLEN_2 - 1, ph2_path, (const felm_t *)&ph2_CT, D, DLEN_2, ELL2_W, W_2);
+        Traverse_w_div_e_torus(rproj, 0, 0, PLEN_2 - 1, (const unsigned int *)comp_tables.ph2_path, (const felm_t *)comp_tables.ph2_CT, D, DLEN_2, ELL2_W, W_2);
 
         from_base(D, d, DLEN_2, ELL2_W);
     } else if (ell == 3) {
         #if (OBOB_EXPON % W_3 == 0)
-            Traverse_w_div_e_fullsigned(r, 0, 0, PLEN_3 - 1, ph3_path, (const felm_t *)&ph3_T, D, DLEN_3, ELL3_W, W_3);
+            Traverse_w_div_e_fullsigned(r, 0, 0, PLEN_3 - 1, (const unsigned int *)comp_tables.ph3_path, (const felm_t *)comp_tables.ph3_T, D, DLEN_3, ELL3_W, W_3);
         #else          
-            Traverse_w_notdiv_e_fullsigned(r, 0, 0, PLEN_3 - 1, ph3_path, (const felm_t *)&ph3_T1, (const felm_t *)&ph3_T2, D, DLEN_3, ell, ELL3_W, ELL3_EMODW, W_3, OBOB_EXPON);                    
+            Traverse_w_notdiv_e_fullsigned(r, 0, 0, PLEN_3 - 1, (const unsigned int *)comp_tables.ph3_path, (const felm_t *)comp_tables.ph3_T1, (const felm_t *)comp_tables.ph3_T2, D, DLEN_3, ell, ELL3_W, ELL3_EMODW, W_3, OBOB_EXPON);                    
         #endif     
         from_base(D, d, DLEN_3, ELL3_W);
     }    
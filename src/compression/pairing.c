@@ -12,51 +12,71 @@
 #define t_points  2
 
 
-static void final_exponentiation_2_torsion(f2elm_t f, const f2elm_t finv, f2elm_t fout)
-{ // The final exponentiation for pairings in the 2^eA-torsion group. Raising the value f to the power (p^2-1)/2^eA.
+// Scratch arrays of the pairings, kept on the stack or in a workspace of the caller (*_ws functions)
+typedef struct {
+    f2elm_t xQ2s[t_points];                            // Squared x-coordinates of the points Qj of Tate3_pairings
+    f2elm_t X[t_points], Y[t_points], Z[t_points];     // Multiples of the points P of Tate3_pairings_EA
+    f2elm_t finv[2*t_points];                          // Inverses of the final exponentiation
+} pairing_scratch_t;
+
+
+static void final_exponentiation_2_torsion(f2elm_t *f, const unsigned int n, f2elm_t *finv)
+{ // The final exponentiation for n <= 2*t_points pairings in the 2^eA-torsion group. Raising each value f[j] to the power (p^2-1)/2^eA.
+  // The n values share one inversion into finv[0..n-1], and their cyclotomic cubings are interleaved.
     felm_t one = {0};
-    f2elm_t temp = {0};
-    unsigned int i; 
+    f2elm_t temp;
+    unsigned int i, j; 
 
     fpcopy((digit_t*)&Montgomery_one, one);
+    mont_n_way_inv(f, n, finv);
     
-    // f = f^p
-    fp2_conj(f, temp);
-    fp2mul_mont(temp, finv, temp);              // temp = f^(p-1)
-
+    for (j = 0; j < n; j++) {
+        fp2_conj(f[j], temp);                   // temp = f^p
+        fp2mul_mont(temp, finv[j], f[j]);       // f = f^(p-1)
+    }
     for (i = 0; i < OBOB_EXPON; i++) {
-        cube_Fp2_cycl(temp, one);
+        for (j = 0; j < n; j++) {
+            cube_Fp2_cycl(f[j], one);
+        }
     }
-    fp2copy(temp, fout);
 }
 
 
-static void final_exponentiation_3_torsion(f2elm_t f, const f2elm_t finv, f2elm_t fout)
-{ // The final exponentiation for pairings in the 3-torsion group. Raising the value f to the power (p^2-1)/3^eB.
+static void final_exponentiation_3_torsion(f2elm_t *f, const unsigned int n, f2elm_t *finv)
+{ // The final exponentiation for n <= 2*t_points pairings in the 3-torsion group. Raising each value f[j] to the power (p^2-1)/3^eB.
+  // The n values share one inversion into finv[0..n-1], and their cyclotomic squarings are interleaved.
     felm_t one = {0};
     f2elm_t temp;
-    unsigned int i; 
+    unsigned int i, j; 
 
     fpcopy((digit_t*)&Montgomery_one, one);
+    mont_n_way_inv(f, n, finv);
     
-    // f = f^p
-    fp2_conj(f, temp); 
-    fp2mul_mont(temp, finv, temp);              // temp = f^(p-1)
-
+    for (j = 0; j < n; j++) {
+        fp2_conj(f[j], temp);                   // temp = f^p
+        fp2mul_mont(temp, finv[j], f[j]);       // f = f^(p-1)
+    }
     for (i = 0; i < OALICE_BITS; i++) {
-        sqr_Fp2_cycl(temp, one);
+        for (j = 0; j < n; j++) {
+            sqr_Fp2_cycl(f[j], one);
+        }
     }
-    fp2copy(temp, fout);
 }
 
 
-void Tate3_pairings(point_full_proj_t *Qj, f2elm_t* f)
+void Tate3_pairings(point_full_proj_t *Qj, f2elm_t* f, pairing_scratch_t *s)
 {
     felm_t *x, *y, *l1, *l2, *n1, *n2, *x2, *x23, *x2p3;
-    f2elm_t xQ2s[t_points], finv[2*t_points], one = {0};
+    f2elm_t *xQ2s = s->xQ2s, one = {0};
     f2elm_t t0, t1, t2, t3, t4, t5, g, h, tf;
+    felm_t *T;
 
+    OPCOUNT_SCOPE(OPCOUNT_PAIRINGS);
+    tables_ensure();
+    STATS_BEGIN(SIKE_PHASE_PAIRINGS);
+    T = (felm_t*)comp_tables.T_tate3;
     fpcopy((digit_t*)&Montgomery_one, one[0]);
+    prefetch_range(T, 6*sizeof(felm_t));
 
     for (int j = 0; j < t_points; j++) {
         fp2copy(one, f[j]);
@@ -65,12 +85,13 @@ void Tate3_pairings(point_full_proj_t *Qj, f2elm_t* f)
     }
 
     for (int k = 0; k < OBOB_EXPON - 1; k++) {
-        l1   = (felm_t*)T_tate3 + 6*k + 0;
-        l2   = (felm_t*)T_tate3 + 6*k + 1;
-        n1   = (felm_t*)T_tate3 + 6*k + 2;
-        n2   = (felm_t*)T_tate3 + 6*k + 3;
-        x23  = (felm_t*)T_tate3 + 6*k + 4;
-        x2p3 = (felm_t*)T_tate3 + 6*k + 5;
+        l1   = T + 6*k + 0;
+        l2   = T + 6*k + 1;
+        n1   = T + 6*k + 2;
+        n2   = T + 6*k + 3;
+        x23  = T + 6*k + 4;
+        x2p3 = T + 6*k + 5;
+        prefetch_range(T + 6*(k + 1), 6*sizeof(felm_t));    // Coefficients of the next step
         for (int j = 0; j < t_points; j++) {
             fpmul_mont(Qj[j]->X[0], *l1, t0[0]);
             fpmul_mont(Qj[j]->X[1], *l1, t0[1]);
@@ -114,10 +135,10 @@ void Tate3_pairings(point_full_proj_t *Qj, f2elm_t* f)
         }
     }
     for (int j = 0; j < t_points; j++) {
-        x  = (felm_t*)T_tate3 + 6*(OBOB_EXPON-1) + 0;
-        y  = (felm_t*)T_tate3 + 6*(OBOB_EXPON-1) + 1;
-        l1 = (felm_t*)T_tate3 + 6*(OBOB_EXPON-1) + 2;
-        x2 = (felm_t*)T_tate3 + 6*(OBOB_EXPON-1) + 3;
+        x  = T + 6*(OBOB_EXPON-1) + 0;
+        y  = T + 6*(OBOB_EXPON-1) + 1;
+        l1 = T + 6*(OBOB_EXPON-1) + 2;
+        x2 = T + 6*(OBOB_EXPON-1) + 3;
         
         fpsub(Qj[j]->X[0], *x, t0[0]);
         fpcopy(Qj[j]->X[1], t0[1]);
@@ -150,20 +171,167 @@ void Tate3_pairings(point_full_proj_t *Qj, f2elm_t* f)
     }
 
     // Final exponentiation:
-    mont_n_way_inv(f, 2*t_points, finv);
+    final_exponentiation_3_torsion(f, 2*t_points, s->finv);
+    STATS_END(SIKE_PHASE_PAIRINGS);
+}
+
+
+static void Tate3_pairings_EA(const f2elm_t A, const point_full_proj_t *P, const point_full_proj_t *Qj, f2elm_t* f, pairing_scratch_t *s)
+{ // Reduced Tate pairings f[j] = e(P[0],Qj[j]) and f[j+t_points] = e(P[1],Qj[j]) of order 3^eB on E_A: y^2 = x^3 + A*x^2 + x, for affine points
+  // P[i] of order 3^eB and affine points Qj[j]. Unlike Tate3_pairings, the first arguments are not fixed, so that the Miller loops triple P[i] in
+  // projective coordinates T = (X:Y:Z), x = X/Z and y = Y/Z. A step multiplies by the function of divisor 3(T) - (3T) - 2(O), the parabola
+  // y = yT + l*(x - xT) + m*(x - xT)^2 with a triple contact at T divided by the vertical line at 3T. Its denominators are multiplied by their
+  // conjugates instead of inverted, which changes each step by a factor in Fp that the final exponentiation cancels. For public points only.
+    f2elm_t *X = s->X, *Y = s->Y, *Z = s->Z;
+    f2elm_t Nl, Nm, Nm2, W, W2, W3, W2Z, LM, En, X3, Z3, c1, c2, c, dx, dy, g, h, t0, t1, one = {0};
+
+    OPCOUNT_SCOPE(OPCOUNT_PAIRINGS);
+    STATS_BEGIN(SIKE_PHASE_PAIRINGS);
+    fpcopy((digit_t*)&Montgomery_one, one[0]);
+    for (int i = 0; i < t_points; i++) {
+        fp2copy(P[i]->X, X[i]);
+        fp2copy(P[i]->Y, Y[i]);
+        fp2copy(one, Z[i]);
+    }
     for (int j = 0; j < 2*t_points; j++) {
-        final_exponentiation_3_torsion(f[j], finv[j], f[j]);
+        fp2copy(one, f[j]);
+    }
+
+    for (int k = 0; k < OBOB_EXPON - 1; k++) {
+        for (int i = 0; i < t_points; i++) {
+            // Slopes l = Nl/W and m = Nm/W^3 with W = 2*Y*Z, Nl = 3*X^2 + 2*A*X*Z + Z^2 and Nm = Z*((3*X + A*Z)*W^2 - Z*Nl^2)
+            fp2sqr_mont(X[i], Nl);
+            fp2add(Nl, Nl, t0);
+            fp2add(Nl, t0, Nl);
+            fp2mul_mont(X[i], Z[i], t0);
+            fp2mul_mont(A, t0, t0);
+            fp2add(t0, t0, t0);
+            fp2add(Nl, t0, Nl);
+            fp2sqr_mont(Z[i], t0);
+            fp2add(Nl, t0, Nl);
+            fp2mul_mont(Y[i], Z[i], W);
+            fp2add(W, W, W);
+            fp2sqr_mont(W, W2);
+            fp2mul_mont(W2, W, W3);
+            fp2mul_mont(A, Z[i], t1);
+            fp2add(t1, X[i], t1);
+            fp2add(t1, X[i], t1);
+            fp2add(t1, X[i], t1);
+            fp2mul_mont(t1, W2, t1);
+            fp2sqr_mont(Nl, t0);
+            fp2mul_mont(t0, Z[i], t0);
+            fp2sub(t1, t0, t1);
+            fp2mul_mont(t1, Z[i], Nm);
+
+            // 3T: x3 = X3/Z3 = xT + (1 - 2*l*m)/m^2 with Z3 = Z*Nm^2 and X3 = X*Nm^2 + Z*En, En = W^2*(W^4 - 2*Nl*Nm)
+            fp2mul_mont(Nl, Nm, LM);
+            fp2sqr_mont(W2, t0);
+            fp2sub(t0, LM, t0);
+            fp2sub(t0, LM, t0);
+            fp2mul_mont(W2, t0, En);
+            fp2sqr_mont(Nm, Nm2);
+            fp2mul_mont(Z[i], Nm2, Z3);
+            fp2mul_mont(X[i], Nm2, X3);
+            fp2mul_mont(Z[i], En, t0);
+            fp2add(X3, t0, X3);
+
+            // f = f^3*g with g = (yQ - yT - l*(xQ - xT) - m*(xQ - xT)^2)/(m*(xQ - x3)) = c*(c1*dy - c2*dx - Nm*dx^2)/(xQ*Z3 - X3), where
+            // dx = xQ*Z - X, dy = yQ*Z - Y, c1 = W^3*Z, c2 = Nl*W^2*Z and c = Nm/Z. The factor 1/m makes g equal, up to the sign, to the product
+            // of the tangent and chord lines divided by the vertical lines at 2T and 3T of Tate3_pairings
+            fp2mul_mont(W2, Z[i], W2Z);
+            fp2mul_mont(W2Z, W, c1);
+            fp2mul_mont(W2Z, Nl, c2);
+            fp2_conj(Z[i], c);
+            fp2mul_mont(c, Nm, c);
+            for (int j = 0; j < t_points; j++) {
+                fp2mul_mont(Qj[j]->X, Z[i], dx);
+                fp2sub(dx, X[i], dx);
+                fp2mul_mont(Qj[j]->Y, Z[i], dy);
+                fp2sub(dy, Y[i], dy);
+                fp2mul_mont(c1, dy, g);
+                fp2mul_mont(c2, dx, t0);
+                fp2sub(g, t0, g);
+                fp2sqr_mont(dx, t0);
+                fp2mul_mont(Nm, t0, t0);
+                fp2sub(g, t0, g);
+                fp2mul_mont(Qj[j]->X, Z3, h);
+                fp2sub(h, X3, h);
+                fp2_conj(h, h);
+                fp2mul_mont(g, h, g);
+                fp2mul_mont(g, c, g);
+                fp2sqr_mont(f[j+i*t_points], h);
+                fp2mul_mont(f[j+i*t_points], h, f[j+i*t_points]);
+                fp2mul_mont(f[j+i*t_points], g, f[j+i*t_points]);
+            }
+
+            // T = 3T = (X3*W^3*Nm : -(Y*W^3*Nm^3 + Nl*Nm*En*W^2*Z + En^2*Z) : Z3*W^3*Nm), since -3T is the fourth intersection of the parabola
+            fp2mul_mont(Y[i], W3, t0);
+            fp2mul_mont(Nm2, Nm, t1);
+            fp2mul_mont(t0, t1, t0);
+            fp2mul_mont(LM, En, t1);
+            fp2mul_mont(t1, W2Z, t1);
+            fp2add(t0, t1, t0);
+            fp2sqr_mont(En, t1);
+            fp2mul_mont(t1, Z[i], t1);
+            fp2add(t0, t1, Y[i]);
+            fp2neg(Y[i]);
+            fp2mul_mont(W3, Nm, t0);
+            fp2mul_mont(X3, t0, X[i]);
+            fp2mul_mont(Z3, t0, Z[i]);
+        }
+    }
+
+    // Last step, from the point of order 3 whose tangent has a triple contact: g = (Nl*dx - W*dy)/(W*Z)
+    for (int i = 0; i < t_points; i++) {
+        fp2sqr_mont(X[i], Nl);
+        fp2add(Nl, Nl, t0);
+        fp2add(Nl, t0, Nl);
+        fp2mul_mont(X[i], Z[i], t0);
+        fp2mul_mont(A, t0, t0);
+        fp2add(t0, t0, t0);
+        fp2add(Nl, t0, Nl);
+        fp2sqr_mont(Z[i], t0);
+        fp2add(Nl, t0, Nl);
+        fp2mul_mont(Y[i], Z[i], W);
+        fp2add(W, W, W);
+        fp2mul_mont(W, Z[i], c);
+        fp2_conj(c, c);
+        for (int j = 0; j < t_points; j++) {
+            fp2mul_mont(Qj[j]->X, Z[i], dx);
+            fp2sub(dx, X[i], dx);
+            fp2mul_mont(Qj[j]->Y, Z[i], dy);
+            fp2sub(dy, Y[i], dy);
+            fp2mul_mont(Nl, dx, g);
+            fp2mul_mont(W, dy, t0);
+            fp2sub(g, t0, g);
+            fp2mul_mont(g, c, g);
+            fp2sqr_mont(f[j+i*t_points], h);
+            fp2mul_mont(f[j+i*t_points], h, f[j+i*t_points]);
+            fp2mul_mont(f[j+i*t_points], g, f[j+i*t_points]);
+        }
     }
+
+    final_exponentiation_3_torsion(f, 2*t_points, s->finv);
+    STATS_END(SIKE_PHASE_PAIRINGS);
 }
 
 
-void Tate2_pairings(const point_t P, const point_t Q, point_full_proj_t *Qj, f2elm_t* f)
+void Tate2_pairings(const point_t P, const point_t Q, point_full_proj_t *Qj, f2elm_t* f, pairing_scratch_t *s)
 {
     felm_t *x, *y, *x_, *y_, *l1;
-    f2elm_t finv[2*t_points], one = {0};
+    f2elm_t one = {0};
     f2elm_t *x_first, *y_first, l1_first, t0, t1, g, h;
+    felm_t *TP, *TQ;
+    unsigned int stride;
     
+    OPCOUNT_SCOPE(OPCOUNT_PAIRINGS);
+    tables_ensure();
+    STATS_BEGIN(SIKE_PHASE_PAIRINGS);
+    TP = (felm_t*)comp_tables.T_tate2_P;
+    TQ = (felm_t*)comp_tables.T_tate2_Q;
+    stride = comp_tables.tate2_stride;
     fpcopy((digit_t*)&Montgomery_one, one[0]);
+    prefetch_range(TP, 3*sizeof(felm_t));
 
     for (int j = 0; j < t_points; j++) {
         fp2copy(one, f[j]);
@@ -174,10 +342,10 @@ void Tate2_pairings(const point_t P, const point_t Q, point_full_proj_t *Qj, f2e
     x_first = (f2elm_t*)P->x;
     y_first = (f2elm_t*)P->y;
 
-    x_ = (felm_t*)T_tate2_firststep_P + 0;
-    y_ = (felm_t*)T_tate2_firststep_P + 1;
-    fpcopy((digit_t*)T_tate2_firststep_P + 2*NWORDS_FIELD, l1_first[0]);         
-    fpcopy((digit_t*)T_tate2_firststep_P + 3*NWORDS_FIELD, l1_first[1]);         
+    x_ = (felm_t*)comp_tables.T_tate2_firststep_P + 0;
+    y_ = (felm_t*)comp_tables.T_tate2_firststep_P + 1;
+    fpcopy(((felm_t*)comp_tables.T_tate2_firststep_P)[2], l1_first[0]);
+    fpcopy(((felm_t*)comp_tables.T_tate2_firststep_P)[3], l1_first[1]);
     
     for (int j = 0; j < t_points; j++) {
         fp2sub(Qj[j]->X, *x_first, t0);
@@ -197,9 +365,12 @@ void Tate2_pairings(const point_t P, const point_t Q, point_full_proj_t *Qj, f2e
     y = y_;
     
     for (int k = 0; k < OALICE_BITS - 2; k++) {
-        x_ = (felm_t*)T_tate2_P + 3 * k + 0;
-        y_ = (felm_t*)T_tate2_P + 3 * k + 1;
-        l1 = (felm_t*)T_tate2_P + 3 * k + 2;
+        x_ = TP + stride*k + 0;
+        y_ = TP + stride*k + 1;
+        l1 = TP + stride*k + 2;
+        if (k + 1 < OALICE_BITS - 2) {
+            prefetch_range(TP + stride*(k + 1), 3*sizeof(felm_t));    // Coefficients of the next step
+        }
         for (int j = 0; j < t_points; j++) {
             fpsub(*x, Qj[j]->X[0], t0[1]);
             fpmul_mont(*l1, t0[1], t0[1]);
@@ -229,10 +400,11 @@ void Tate2_pairings(const point_t P, const point_t Q, point_full_proj_t *Qj, f2e
     // Pairings with Q
     x_first = (f2elm_t*)Q->x;
     y_first = (f2elm_t*)Q->y; 
-    x_ = (felm_t*)T_tate2_firststep_Q + 0;
-    y_ = (felm_t*)T_tate2_firststep_Q + 1;
-    fpcopy(((felm_t*)T_tate2_firststep_Q)[2], l1_first[0]);
-    fpcopy(((felm_t*)T_tate2_firststep_Q)[3], l1_first[1]);
+    x_ = (felm_t*)comp_tables.T_tate2_firststep_Q + 0;
+    y_ = (felm_t*)comp_tables.T_tate2_firststep_Q + 1;
+    fpcopy(((felm_t*)comp_tables.T_tate2_firststep_Q)[2], l1_first[0]);
+    fpcopy(((felm_t*)comp_tables.T_tate2_firststep_Q)[3], l1_first[1]);
+    prefetch_range(TQ, 3*sizeof(felm_t));
 
     for (int j = 0; j < t_points; j++) {
         fp2sub(Qj[j]->X, *x_first, t0);
@@ -252,9 +424,12 @@ void Tate2_pairings(const point_t P, const point_t Q, point_full_proj_t *Qj, f2e
     y = y_;
     
     for (int k = 0; k < OALICE_BITS - 2; k++) {
-        x_ = (felm_t*)T_tate2_Q + 3*k + 0;
-        y_ = (felm_t*)T_tate2_Q + 3*k + 1;
-        l1 = (felm_t*)T_tate2_Q + 3*k + 2;
+        x_ = TQ + stride*k + 0;
+        y_ = TQ + stride*k + 1;
+        l1 = TQ + stride*k + 2;
+        if (k + 1 < OALICE_BITS - 2) {
+            prefetch_range(TQ + stride*(k + 1), 3*sizeof(felm_t));    // Coefficients of the next step
+        }
         for (int j = 0; j < t_points; j++) {
             fpsub(Qj[j]->X[0], *x, t0[0]);
             fpmul_mont(*l1, t0[0], t0[0]);
@@ -284,9 +459,7 @@ void Tate2_pairings(const point_t P, const point_t Q, point_full_proj_t *Qj, f2e
     }
 
     // Final exponentiation:
-    mont_n_way_inv(f, 2*t_points, finv);
-    for (int j = 0; j < 2*t_points; j++) {
-        final_exponentiation_2_torsion(f[j], finv[j], f[j]);
-    }
+    final_exponentiation_2_torsion(f, 2*t_points, s->finv);
+    STATS_END(SIKE_PHASE_PAIRINGS);
 }
 
@@ -10,9 +10,68 @@
 
 #include "../random/random.h"
 #include <string.h>
+#if defined(_PARALLEL_DLOG_) && defined(__NIX__)
+    #include <pthread.h>
+#endif
+
+
+// Points stored by the tree traversals: the larger of the bounds of Alice's and Bob's strategies
+#define MAX_INT_POINTS       (MAX_INT_POINTS_ALICE > MAX_INT_POINTS_BOB ? MAX_INT_POINTS_ALICE : MAX_INT_POINTS_BOB)
+
+// Points stored by the tree traversals, kept on the stack or in a workspace of the caller (*_ws functions)
+typedef struct {
+    point_proj_t pts[MAX_INT_POINTS];
+} traversal_scratch_t;
+
+// Points stored by the traversal of Bob's key generation, whose strategy is not bounded by SIKE_MAX_STORED_POINTS
+typedef struct {
+    point_proj_t pts[MAX_INT_POINTS_BOB_KEYGEN];
+} keygen_traversal_scratch_t;
+
+// Scratch arrays of the steps of a key generation, secret agreement or decapsulation, which run one after the other
+typedef union {
+    traversal_scratch_t traversal;
+    keygen_traversal_scratch_t keygen_traversal;
+    basis_scratch_t basis;
+    pairing_scratch_t pairing;
+} sidh_scratch_t;
+
+// Workspace of the *_ws functions: the large scratch arrays of the public key generation and the scratch arrays of the steps
+typedef struct {
+    union {
+        f2elm_t As[MAX_Alice+1][5];    // Alice: curves and dual 4-isogenies of the isogeny walk
+        f2elm_t Ds[MAX_Bob][2];        // Bob: kernels of the dual 3-isogenies of the isogeny walk
+    } walk;
+    sidh_scratch_t scratch;
+} sidh_workspace_t;
+
+#define WORKSPACE_BYTES    (sizeof(sidh_workspace_t) + CACHE_LINE_BYTES - 1)
+
+
+size_t crypto_kem_workspace_size(void)
+{ // Size in bytes of the workspace of the *_ws functions
+    return WORKSPACE_BYTES;
+}
+
+
+static sidh_workspace_t* workspace_align(void *workspace)
+{ // The scratch arrays of a workspace of WORKSPACE_BYTES bytes at any address, aligned to a cache line
+    return (sidh_workspace_t*)(((uintptr_t)workspace + CACHE_LINE_BYTES - 1) & ~(uintptr_t)(CACHE_LINE_BYTES - 1));
+}
+
 
+static void workspace_clear(sidh_workspace_t *ws)
+{ // Erase the secret data left in a workspace of the caller by a key generation
+    clear_words((void*)ws, sizeof(sidh_workspace_t)/sizeof(digit_t));
+}
 
 
+static void scratch_clear(sidh_scratch_t *scratch)
+{ // Erase the secret data left in the scratch arrays of a workspace of the caller by a secret agreement or decapsulation,
+  // which do not use the rest of the workspace
+    clear_words((void*)scratch, sizeof(sidh_scratch_t)/sizeof(digit_t));
+}
+
 
 static void init_basis(digit_t *gen, f2elm_t XP, f2elm_t XQ, f2elm_t XR)
 { // Initialization of basis points
@@ -60,11 +119,11 @@ int random_mod_order_B(unsigned char* random_digits)
 }
 
 
-static void FullIsogeny_A_dual(unsigned char* PrivateKeyA, f2elm_t As[][5], f2elm_t a24, unsigned int sike)
+static void FullIsogeny_A_dual(unsigned char* PrivateKeyA, f2elm_t As[][5], f2elm_t a24, unsigned int sike, traversal_scratch_t *scratch)
 {
   // Input:  a private key PrivateKeyA in the range [0, 2^eA - 1]. 
   // Output: the public key PublicKeyA consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
-    point_proj_t R, pts[MAX_INT_POINTS_ALICE];
+    point_proj_t R, *pts = scratch->pts;
     f2elm_t XPA, XQA, XRA, coeff[5], A24 = {0}, C24 = {0}, A = {0};
     unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_ALICE], npts = 0, ii = 0;
     digit_t SecretKeyA[NWORDS_ORDER] = {0};
@@ -89,6 +148,7 @@ static void FullIsogeny_A_dual(unsigned char* PrivateKeyA, f2elm_t As[][5], f2el
     if (sike == 1)
         fp2_encode(R->X, &PrivateKeyA[SECRETKEY_A_BYTES + CRYPTO_PUBLICKEYBYTES]);  // privA ||= x(KA) = x(PA + sk_A*QA)
     
+    STATS_BEGIN(SIKE_PHASE_TRAVERSAL);
 #if (OALICE_BITS % 2 == 1)
     point_proj_t S;
 
@@ -129,25 +189,258 @@ static void FullIsogeny_A_dual(unsigned char* PrivateKeyA, f2elm_t As[][5], f2el
     fp2copy(C24, As[MAX_Alice-1][1]);
     get_4_isog_dual(R, A24, C24, coeff);
     eval_dual_4_isog_shared(coeff[2], coeff[3], coeff[4], *(As+MAX_Alice-1)+2);
+    STATS_END(SIKE_PHASE_TRAVERSAL);
+    STATS_BEGIN(SIKE_PHASE_JINV);
     fp2copy(A24, As[MAX_Alice][0]);
     fp2copy(C24, As[MAX_Alice][1]);
     fp2inv_mont_bingcd(C24);
     fp2mul_mont(A24, C24, a24);
+    STATS_END(SIKE_PHASE_JINV);
+}
+
+
+#if defined(_PARALLEL_DLOG_) && defined(__NIX__)
+
+#define DLEN_MAX    (DLEN_2 > DLEN_3 ? DLEN_2 : DLEN_3)
+
+enum { DLOG_CALLER, DLOG_QUEUED, DLOG_TAKEN, DLOG_DONE };    // Solved by the caller, waiting in the queue, solved by a worker, done by a worker
+
+typedef struct dlog_job {
+    struct dlog_job *prev, *next;                // Neighbours in the queue of dlog_pool
+    const felm_t *r;
+    int D[DLEN_MAX];
+    digit_t *d;
+    int ell;
+    int state;
+#if defined(_OPCOUNT_)
+    opcount_t ops;
+#endif
+} dlog_job;
+
+
+// Worker threads of solve_dlogs_dual(), started on first use and kept until sike_threads_shutdown(), so that each call does not pay for
+// creating and joining threads. The calls append their jobs to a queue served in order by all the workers, and solve the jobs that no worker
+// has taken yet once their own discrete log is done, so that concurrent calls never wait for the pool to be free.
+#define DLOG_WORKERS    3
+
+static struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t start, done;
+    dlog_job *head, *tail;                       // Jobs not taken yet, oldest first
+    pthread_t threads[DLOG_WORKERS];
+    unsigned int nworkers;                       // Threads started
+    int started;                                 // Set once the threads have been started, until sike_threads_shutdown()
+    int stopping;                                // Set while sike_threads_shutdown() joins the threads
+} dlog_pool = {PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER};
+
+static pthread_once_t dlog_pool_once = PTHREAD_ONCE_INIT;
+
+
+static void dlog_pool_append(dlog_job *job)
+{
+    job->prev = dlog_pool.tail;
+    job->next = NULL;
+    if (dlog_pool.tail != NULL) dlog_pool.tail->next = job; else dlog_pool.head = job;
+    dlog_pool.tail = job;
+}
+
+
+static void dlog_pool_unlink(dlog_job *job)
+{
+    if (job->prev != NULL) job->prev->next = job->next; else dlog_pool.head = job->next;
+    if (job->next != NULL) job->next->prev = job->prev; else dlog_pool.tail = job->prev;
+}
+
+
+static void* dlog_worker(void *arg)
+{
+    dlog_job *job;
+    (void)arg;
+
+    pthread_mutex_lock(&dlog_pool.mutex);
+    for (;;) {
+        while (dlog_pool.head == NULL && !dlog_pool.stopping) {
+            pthread_cond_wait(&dlog_pool.start, &dlog_pool.mutex);
+        }
+        if (dlog_pool.stopping) break;    // Jobs still queued are solved by their callers
+        job = dlog_pool.head;
+        dlog_pool_unlink(job);
+        job->state = DLOG_TAKEN;
+        pthread_mutex_unlock(&dlog_pool.mutex);
+
+#if defined(_OPCOUNT_)
+        memset(&opcount_ops, 0, sizeof(opcount_t));
+#endif
+        solve_dlog(job->r, job->D, job->d, job->ell);
+#if defined(_OPCOUNT_)
+        job->ops = opcount_ops;    // Operations of this job, added to the caller's by solve_dlogs_dual()
+#endif
+
+        pthread_mutex_lock(&dlog_pool.mutex);
+        job->state = DLOG_DONE;
+        pthread_cond_broadcast(&dlog_pool.done);
+    }
+    pthread_mutex_unlock(&dlog_pool.mutex);
+    return NULL;
+}
+
+
+static void dlog_pool_prepare(void)
+{
+    pthread_mutex_lock(&dlog_pool.mutex);
+}
+
+
+static void dlog_pool_parent(void)
+{
+    pthread_mutex_unlock(&dlog_pool.mutex);
+}
+
+
+static void dlog_pool_child(void)
+{ // The workers are not copied by fork(), and the jobs queued belong to threads of the parent. The child solves all the logs on the calling
+  // thread, as threads should not be started after fork() in a multithreaded process, until sike_threads_shutdown() lets it start its own.
+    pthread_mutex_init(&dlog_pool.mutex, NULL);
+    pthread_cond_init(&dlog_pool.start, NULL);
+    pthread_cond_init(&dlog_pool.done, NULL);
+    dlog_pool.head = dlog_pool.tail = NULL;
+    dlog_pool.nworkers = 0;
+    dlog_pool.started = 1;
+    dlog_pool.stopping = 0;
+}
+
+
+static void dlog_pool_register(void)
+{
+    pthread_atfork(dlog_pool_prepare, dlog_pool_parent, dlog_pool_child);
+}
+
+
+static void dlog_pool_start(void)
+{ // Start the workers, with dlog_pool.mutex held. If a thread cannot be created, the jobs are solved by the other workers and by the callers.
+    pthread_once(&dlog_pool_once, dlog_pool_register);
+    while (dlog_pool.nworkers < DLOG_WORKERS && pthread_create(&dlog_pool.threads[dlog_pool.nworkers], NULL, dlog_worker, NULL) == 0) {
+        dlog_pool.nworkers++;
+    }
+    dlog_pool.started = 1;
+}
+
+
+void sike_threads_shutdown(void)
+{ // Stop and join the workers of dlog_pool. The calls running meanwhile solve their jobs themselves, and the next call starts the workers again.
+    unsigned int i, nworkers;
+
+    pthread_mutex_lock(&dlog_pool.mutex);
+    if (dlog_pool.stopping) {    // Joined by another thread
+        pthread_mutex_unlock(&dlog_pool.mutex);
+        return;
+    }
+    dlog_pool.stopping = 1;
+    nworkers = dlog_pool.nworkers;
+    pthread_cond_broadcast(&dlog_pool.start);
+    pthread_mutex_unlock(&dlog_pool.mutex);
+
+    for (i = 0; i < nworkers; i++) {
+        pthread_join(dlog_pool.threads[i], NULL);
+    }
+
+    pthread_mutex_lock(&dlog_pool.mutex);
+    dlog_pool.nworkers = 0;
+    dlog_pool.started = 0;
+    dlog_pool.stopping = 0;
+    pthread_mutex_unlock(&dlog_pool.mutex);
+}
+
+#else
+
+void sike_threads_shutdown(void)
+{ // No threads are started without _PARALLEL_DLOG_
+}
+
+#endif
+
+
+static void solve_dlogs_dual(const f2elm_t *f, int *D, digit_t *d0, digit_t *c0, digit_t *d1, digit_t *c1, int ell)
+{ // Discrete logs of the four pairing values f[0], f[2], f[1], f[3] into d0, c0, d1, c1.
+  // With _PARALLEL_DLOG_, the last three are queued for the workers of dlog_pool while the caller solves the first one. The caller then solves
+  // the queued logs that no worker has taken, e.g., while the workers serve other calls, and waits for the others.
+#if defined(_PARALLEL_DLOG_) && defined(__NIX__)
+    dlog_job jobs[DLOG_WORKERS];
+    unsigned int i;
+
+    jobs[0].r = f[2]; jobs[0].d = c0;
+    jobs[1].r = f[1]; jobs[1].d = d1;
+    jobs[2].r = f[3]; jobs[2].d = c1;
+    for (i = 0; i < DLOG_WORKERS; i++) {
+        jobs[i].ell = ell;
+        jobs[i].state = DLOG_CALLER;
+    }
+
+    pthread_mutex_lock(&dlog_pool.mutex);
+    if (!dlog_pool.started && !dlog_pool.stopping) {
+        dlog_pool_start();
+    }
+    if (dlog_pool.nworkers != 0 && !dlog_pool.stopping) {
+        for (i = 0; i < DLOG_WORKERS; i++) {
+            jobs[i].state = DLOG_QUEUED;
+            dlog_pool_append(&jobs[i]);
+        }
+        pthread_cond_broadcast(&dlog_pool.start);
+    }
+    pthread_mutex_unlock(&dlog_pool.mutex);
+
+    solve_dlog(f[0], D, d0, ell);
+
+    pthread_mutex_lock(&dlog_pool.mutex);
+    for (i = 0; i < DLOG_WORKERS; i++) {
+        if (jobs[i].state == DLOG_QUEUED) {
+            dlog_pool_unlink(&jobs[i]);
+            jobs[i].state = DLOG_CALLER;
+        }
+    }
+    pthread_mutex_unlock(&dlog_pool.mutex);
+
+    for (i = 0; i < DLOG_WORKERS; i++) {
+        if (jobs[i].state == DLOG_CALLER) {
+            solve_dlog(jobs[i].r, jobs[i].D, jobs[i].d, ell);
+        }
+    }
+
+    pthread_mutex_lock(&dlog_pool.mutex);
+    for (i = 0; i < DLOG_WORKERS; i++) {
+        while (jobs[i].state == DLOG_TAKEN) {
+            pthread_cond_wait(&dlog_pool.done, &dlog_pool.mutex);
+        }
+    }
+    pthread_mutex_unlock(&dlog_pool.mutex);
+#if defined(_OPCOUNT_)
+    for (i = 0; i < DLOG_WORKERS; i++) {
+        if (jobs[i].state == DLOG_DONE) {
+            opcount_merge(&jobs[i].ops);
+        }
+    }
+#endif
+#else
+    solve_dlog(f[0], D, d0, ell);
+    solve_dlog(f[2], D, c0, ell);
+    solve_dlog(f[1], D, d1, ell);
+    solve_dlog(f[3], D, c1, ell);
+#endif
 }
 
 
 static void Dlogs3_dual(const f2elm_t *f, int *D, digit_t *d0, digit_t *c0, digit_t *d1, digit_t *c1)
 {
-    solve_dlog(f[0], D, d0, 3);    
-    solve_dlog(f[2], D, c0, 3);
-    solve_dlog(f[1], D, d1, 3);     
-    solve_dlog(f[3], D, c1, 3);    
+    OPCOUNT_SCOPE(OPCOUNT_DLOGS);
+    STATS_BEGIN(SIKE_PHASE_DLOGS);
+    solve_dlogs_dual(f, D, d0, c0, d1, c1, 3);
     mp_sub((digit_t*)Bob_order, c0, c0, NWORDS_ORDER);    
     mp_sub((digit_t*)Bob_order, c1, c1, NWORDS_ORDER);  
+    STATS_END(SIKE_PHASE_DLOGS);
 }
 
 
-static void PKADecompression_dual(const unsigned char* SecretKeyB, const unsigned char* CompressedPKA, point_proj_t R, f2elm_t A)
+static void PKADecompression_dual(const unsigned char* SecretKeyB, const unsigned char* CompressedPKA, point_proj_t R, f2elm_t A, basis_scratch_t *scratch)
 {
     unsigned char bit, rs[3];
     f2elm_t A24;
@@ -155,6 +448,7 @@ static void PKADecompression_dual(const unsigned char* SecretKeyB, const unsigne
     digit_t t1[NWORDS_ORDER] = {0}, t2[NWORDS_ORDER] = {0}, t3[NWORDS_ORDER] = {0}, t4[NWORDS_ORDER] = {0};
     digit_t vone[NWORDS_ORDER] = {0}, temp[NWORDS_ORDER] = {0}, SKin[NWORDS_ORDER] = {0};
     
+    OPCOUNT_SCOPE(OPCOUNT_DECOMPRESS);
     fp2_decode(&CompressedPKA[3*ORDER_B_ENCODED_BYTES], A);
     vone[0] = 1;
     to_Montgomery_mod_order(vone, vone, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2, (digit_t*)&Montgomery_RB1);  // Converting to Montgomery representation
@@ -169,7 +463,7 @@ static void PKADecompression_dual(const unsigned char* SecretKeyB, const unsigne
     fp2div2(A24, A24);
     fp2div2(A24, A24);
 
-    BuildOrdinary3nBasis_Decomp_dual(A24, Rs, rs, rs[2]);
+    BuildOrdinary3nBasis_Decomp_dual(A24, Rs, rs, rs[2], scratch);
     fpcopy((digit_t*)Montgomery_one, (Rs[0]->Z)[0]);
     fpcopy((digit_t*)Montgomery_one, (Rs[1]->Z)[0]);
 
@@ -185,7 +479,7 @@ static void PKADecompression_dual(const unsigned char* SecretKeyB, const unsigne
     if (bit == 0) {    
         Montgomery_multiply_mod_order(t1, t3, t3, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2);
         mp_add(t3, vone, t3, NWORDS_ORDER);
-        Montgomery_inversion_mod_order_bingcd(t3, t3, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2, (digit_t*)&Montgomery_RB1);
+        Montgomery_inversion_mod_orderB(t3, t3, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2);    // Constant time, t3 depends on the secret key
         Montgomery_multiply_mod_order(t1, t4, t4, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2);
         mp_add(t2, t4, t4, NWORDS_ORDER);
         Montgomery_multiply_mod_order(t3, t4, t3, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2);
@@ -194,7 +488,7 @@ static void PKADecompression_dual(const unsigned char* SecretKeyB, const unsigne
     } else {   
         Montgomery_multiply_mod_order(t1, t4, t4, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2);
         mp_add(t4, vone, t4, NWORDS_ORDER);
-        Montgomery_inversion_mod_order_bingcd(t4, t4, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2, (digit_t*)&Montgomery_RB1);
+        Montgomery_inversion_mod_orderB(t4, t4, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2);    // Constant time, t4 depends on the secret key
         Montgomery_multiply_mod_order(t1, t3, t3, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2);
         mp_add(t2, t3, t3, NWORDS_ORDER);
         Montgomery_multiply_mod_order(t3, t4, t3, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2);
@@ -211,6 +505,7 @@ static void Compress_PKA_dual(digit_t *d0, digit_t *c0, digit_t *d1, digit_t *c1
     digit_t temp[NWORDS_ORDER] = {0}, inv[NWORDS_ORDER];
     f2elm_t A;
 
+    OPCOUNT_SCOPE(OPCOUNT_COMPRESS);
     fp2add(a24,a24,A);
     fp2add(A,A,A);
     fpsub(A[0],(digit_t*)Montgomery_one,A[0]);
@@ -259,18 +554,20 @@ static void Compress_PKA_dual(digit_t *d0, digit_t *c0, digit_t *d1, digit_t *c1
 }
 
 
-static int EphemeralKeyGeneration_A_extended(unsigned char* PrivateKeyA, unsigned char* CompressedPKA)
-{ // Alice's ephemeral public key generation using compression -- SIKE protocol
-  // Output: PrivateKeyA[MSG_BYTES + SECRETKEY_A_BYTES] <- x(K_A) where K_A = PA + sk_A*Q_A 
+static int EphemeralKeyGeneration_A_extended(unsigned char* PrivateKeyA, unsigned char* CompressedPKA, unsigned int sike, f2elm_t As[][5], sidh_scratch_t *scratch)
+{ // Alice's ephemeral public key generation using compression -- SIKE protocol (sike = 1) and SIDH protocol (sike = 0)
+  // Output: PrivateKeyA[MSG_BYTES + SECRETKEY_A_BYTES] <- x(K_A) where K_A = PA + sk_A*Q_A if sike = 1
     unsigned int rs[3];
     int D[DLEN_3];
-    f2elm_t a24, As[MAX_Alice+1][5], f[4];
+    f2elm_t a24, f[4];
     digit_t c0[NWORDS_ORDER] = {0}, d0[NWORDS_ORDER] = {0}, c1[NWORDS_ORDER] = {0}, d1[NWORDS_ORDER] = {0}; 
     point_full_proj_t Rs[2];
 
-    FullIsogeny_A_dual(PrivateKeyA, As, a24, 1);
-    BuildOrdinary3nBasis_dual(a24, As, Rs, rs, &rs[2]);
-    Tate3_pairings(Rs, f);
+    OPCOUNT_SCOPE(OPCOUNT_KEYGEN_A);
+    USDT_SCOPE(OPCOUNT_KEYGEN_A);
+    FullIsogeny_A_dual(PrivateKeyA, As, a24, sike, &scratch->traversal);
+    BuildOrdinary3nBasis_dual(a24, As, Rs, rs, &rs[2], &scratch->basis);
+    Tate3_pairings(Rs, f, &scratch->pairing);
     Dlogs3_dual(f, D, d0, c0, d1, c1);
     Compress_PKA_dual(d0, c0, d1, c1, a24, rs, CompressedPKA);
     return 0;
@@ -279,42 +576,160 @@ static int EphemeralKeyGeneration_A_extended(unsigned char* PrivateKeyA, unsigne
 
 int EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* CompressedPKA)
 { // Alice's ephemeral public key generation using compression -- SIDH protocol
-  // Output: PrivateKeyA[MSG_BYTES + SECRETKEY_A_BYTES] <- x(K_A) where K_A = PA + sk_A*Q_A 
+    f2elm_t As[MAX_Alice+1][5];
+    sidh_scratch_t scratch;
+
+    return EphemeralKeyGeneration_A_extended((unsigned char*)PrivateKeyA, CompressedPKA, 0, As, &scratch);
+}
+
+
+int EphemeralKeyGeneration_A_ws(const unsigned char* PrivateKeyA, unsigned char* CompressedPKA, void *workspace)
+{ // Alice's ephemeral public key generation using compression -- SIDH protocol, with the scratch memory in a workspace
+  // of crypto_kem_workspace_size() bytes
+    sidh_workspace_t *ws = workspace_align(workspace);
+
+    EphemeralKeyGeneration_A_extended((unsigned char*)PrivateKeyA, CompressedPKA, 0, ws->walk.As, &ws->scratch);
+    workspace_clear(ws);
+    return 0;
+}
+
+
+static void Ladder_combination(const point_proj_t *Rs, const digit_t *alpha, const digit_t *beta, const f2elm_t A, const f2elm_t A24, point_proj_t R)
+{ // R = x(alpha*R0 + beta*R1) for a basis {R0, R1} of E_A[3^eB] given by Rs = {x(R0), x(R1), x(R0-R1)}, where alpha or beta is a unit mod 3^eB.
+  // The 3-point ladder gives x(R0 + (beta/alpha)*R1) or x(R1 + (alpha/beta)*R0), which is then multiplied by alpha or beta. Public values only.
+    point_proj_t Ts[3], S;
+    digit_t u[NWORDS_ORDER], v[NWORDS_ORDER], inv[NWORDS_ORDER];
+    unsigned int swap = (mod3((digit_t*)alpha) == 0), nbits;
+
+    for (int i = 0; i < 3; i++) {
+        fp2copy(Rs[(i < 2 && swap) ? 1-i : i]->X, Ts[i]->X);
+        fp2copy(Rs[(i < 2 && swap) ? 1-i : i]->Z, Ts[i]->Z);
+    }
+    to_Montgomery_mod_order(swap ? beta : alpha, u, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2, (digit_t*)&Montgomery_RB1);
+    to_Montgomery_mod_order(swap ? alpha : beta, v, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2, (digit_t*)&Montgomery_RB1);
+    Montgomery_inversion_mod_order_bingcd(u, inv, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2, (digit_t*)&Montgomery_RB1);
+    Montgomery_multiply_mod_order(v, inv, v, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2);
+    from_Montgomery_mod_order(v, v, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2);
+    Ladder3pt_dual(Ts, v, BOB, S, A24);
+
+    // Ladder() computes (2^nbits + m)*S for the nbits lower bits m of its scalar, so that nbits is set to the position of the top bit of u
+    from_Montgomery_mod_order(u, u, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2);
+    for (nbits = OBOB_BITS - 1; nbits > 0 && ((u[nbits >> LOG2RADIX] >> (nbits & (RADIX-1))) & 1) == 0; nbits--);
+    Ladder(S, u, A, nbits, R);
+}
+
+
+int PublicKeyDecompression_A(const unsigned char* CompressedPKA, unsigned char* PublicKeyA)
+{ // Conversion of Alice's compressed public key to the uncompressed encoding {x(P), x(Q), x(P-Q)}, where P and Q are the images of Bob's basis up
+  // to a common scalar, which leaves Bob's kernels <P + skB*Q> unchanged. With the basis {R0, R1} of E_A[3^eB] rebuilt from the key, P = R0 + a*R1 and
+  // Q = b*R0 + c*R1 for the scalars [a, b, c] of the key, R0 and R1 being swapped if the bit of index NBITS_ORDER is set (see PKADecompression_dual).
+    unsigned char bit, rs[3];
+    f2elm_t A, A24;
+    point_proj_t Rs[3] = {0}, R[3];
+    digit_t one[NWORDS_ORDER] = {0}, a[NWORDS_ORDER] = {0}, q0[NWORDS_ORDER] = {0}, q1[NWORDS_ORDER] = {0}, d0[NWORDS_ORDER], d1[NWORDS_ORDER];
+    basis_scratch_t scratch;
+
+    OPCOUNT_SCOPE(OPCOUNT_DECOMPRESS);
+    fp2_decode(&CompressedPKA[3*ORDER_B_ENCODED_BYTES], A);
+    bit = CompressedPKA[3*ORDER_B_ENCODED_BYTES + FP2_ENCODED_BYTES] >> 7;
+    memcpy(rs, &CompressedPKA[3*ORDER_B_ENCODED_BYTES + FP2_ENCODED_BYTES], SIDH_BASISHINTBYTES);
+    rs[0] &= 0x7F;
+
+    fpadd(A[0], (digit_t*)Montgomery_one, A24[0]);
+    fpcopy(A[1], A24[1]);
+    fpadd(A24[0], (digit_t*)Montgomery_one, A24[0]);
+    fp2div2(A24, A24);
+    fp2div2(A24, A24);
+
+    BuildOrdinary3nBasis_Decomp_dual(A24, Rs, rs, rs[2], &scratch);
+    fpcopy((digit_t*)Montgomery_one, (Rs[0]->Z)[0]);
+    fpcopy((digit_t*)Montgomery_one, (Rs[1]->Z)[0]);
+    for (int i = 0; i < 3; i++) {
+        Double(Rs[i], Rs[i], A24, OALICE_BITS);    // Basis of E_A[3^eB] and its difference
+    }
+    swap_points(Rs[0], Rs[1], 0-(digit_t)bit);
+
+    one[0] = 1;
+    decode_to_digits(&CompressedPKA[0], a, ORDER_B_ENCODED_BYTES, NWORDS_ORDER);
+    decode_to_digits(&CompressedPKA[ORDER_B_ENCODED_BYTES], (bit == 0) ? q0 : q1, ORDER_B_ENCODED_BYTES, NWORDS_ORDER);
+    decode_to_digits(&CompressedPKA[2*ORDER_B_ENCODED_BYTES], (bit == 0) ? q1 : q0, ORDER_B_ENCODED_BYTES, NWORDS_ORDER);
+    if (mp_sub(one, q0, d0, NWORDS_ORDER) != 0)    // P - Q = (1 - q0)*R0 + (a - q1)*R1
+        mp_add(d0, (digit_t*)Bob_order, d0, NWORDS_ORDER);
+    if (mp_sub(a, q1, d1, NWORDS_ORDER) != 0)
+        mp_add(d1, (digit_t*)Bob_order, d1, NWORDS_ORDER);
+
+    Ladder_combination(Rs, one, a, A, A24, R[0]);
+    Ladder_combination(Rs, q0, q1, A, A24, R[1]);
+    Ladder_combination(Rs, d0, d1, A, A24, R[2]);
+    inv_3_way(R[0]->Z, R[1]->Z, R[2]->Z);
+    for (int i = 0; i < 3; i++) {
+        fp2mul_mont(R[i]->X, R[i]->Z, R[i]->X);
+        fp2_encode(R[i]->X, &PublicKeyA[i*FP2_ENCODED_BYTES]);
+    }
+    return 0;
+}
+
+
+int PublicKeyCompression_A(const unsigned char* PublicKeyA, const unsigned char* BasisHint, unsigned char* CompressedPKA)
+{ // Conversion of Alice's public key {x(P), x(Q), x(P-Q)} to the compressed encoding, with the basis of E_A[3^eB] of the compressed key given by
+  // the SIDH_BASISHINTBYTES bytes BasisHint recorded from it, which saves the search for the basis. Without the dual isogeny of the key generation,
+  // the pairings of P and Q with the basis are computed on E_A. They differ from those of the key generation by a common power, which the scalars
+  // of the compressed key, ratios of their discrete logs, do not depend on.
     unsigned int rs[3];
+    unsigned char r[3];
     int D[DLEN_3];
-    f2elm_t a24, As[MAX_Alice+1][5], f[4];
-    digit_t c0[NWORDS_ORDER] = {0}, d0[NWORDS_ORDER] = {0}, c1[NWORDS_ORDER] = {0}, d1[NWORDS_ORDER] = {0}; 
-    point_full_proj_t Rs[2];
+    f2elm_t A, a24, f[4];
+    digit_t c0[NWORDS_ORDER] = {0}, d0[NWORDS_ORDER] = {0}, c1[NWORDS_ORDER] = {0}, d1[NWORDS_ORDER] = {0};
+    point_proj_t xs[3] = {0}, Rs[3] = {0};
+    point_full_proj_t Ps[2], Qs[2];
+    sidh_scratch_t scratch;
+
+    OPCOUNT_SCOPE(OPCOUNT_COMPRESS);
+    for (int i = 0; i < 3; i++) {
+        fp2_decode(&PublicKeyA[i*FP2_ENCODED_BYTES], xs[i]->X);
+        fpcopy((digit_t*)Montgomery_one, (xs[i]->Z)[0]);
+    }
+    get_A(xs[0]->X, xs[1]->X, xs[2]->X, A);
+    fpadd(A[0], (digit_t*)Montgomery_one, a24[0]);
+    fpcopy(A[1], a24[1]);
+    fpadd(a24[0], (digit_t*)Montgomery_one, a24[0]);
+    fp2div2(a24, a24);
+    fp2div2(a24, a24);
+    CompleteMPoint(A, xs[0]->X, xs[0]->Z, Ps[0]);
+    RecoverY(A, xs, Ps);
+
+    memcpy(r, BasisHint, SIDH_BASISHINTBYTES);
+    r[0] &= 0x7F;
+    BuildOrdinary3nBasis_Decomp_dual(a24, Rs, r, r[2], &scratch.basis);
+    fpcopy((digit_t*)Montgomery_one, (Rs[0]->Z)[0]);
+    fpcopy((digit_t*)Montgomery_one, (Rs[1]->Z)[0]);
+    CompleteMPoint(A, Rs[0]->X, Rs[0]->Z, Qs[0]);
+    RecoverY(A, Rs, Qs);
 
-    FullIsogeny_A_dual((unsigned char*)PrivateKeyA, As, a24, 0);
-    BuildOrdinary3nBasis_dual(a24, As, Rs, rs, &rs[2]);
-    Tate3_pairings(Rs, f);
+    Tate3_pairings_EA(A, Ps, Qs, f, &scratch.pairing);
     Dlogs3_dual(f, D, d0, c0, d1, c1);
+    for (int i = 0; i < 3; i++) {
+        rs[i] = r[i];
+    }
     Compress_PKA_dual(d0, c0, d1, c1, a24, rs, CompressedPKA);
     return 0;
 }
 
 
-int EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned char* PKA, unsigned char* SharedSecretB)
-{ // Bob's ephemeral shared secret computation using compression
-  // It produces a shared secret key SharedSecretB using his secret key PrivateKeyB and Alice's decompressed data point_R and param_A
-  // Inputs: Bob's PrivateKeyB is an integer in the range [1, oB-1], where oB = 3^OBOB_EXP. 
-  //         Alice's decompressed data consists of point_R in (X:Z) coordinates and the curve parameter param_A in GF(p^2).
-  // Output: a shared secret SharedSecretB that consists of one element in GF(p^2). 
+static void SharedSecret_B(point_proj_t R, const f2elm_t param_A, unsigned char* SharedSecretB, traversal_scratch_t *scratch)
+{ // Bob's shared secret from the kernel point R of his isogeny on Alice's curve E_A
     unsigned int i, ii = 0, row, m, index = 0, pts_index[MAX_INT_POINTS_BOB], npts = 0;
     f2elm_t A24plus = {0}, A24minus = {0};
-    point_proj_t R, pts[MAX_INT_POINTS_BOB];
+    point_proj_t *pts = scratch->pts;
     f2elm_t jinv, A, coeff[3];
-    f2elm_t param_A = {0};
 
-    PKADecompression_dual(PrivateKeyB, PKA, R, param_A);
-    
     fp2copy((felm_t*)param_A, A);    
     fpadd((digit_t*)&Montgomery_one, (digit_t*)&Montgomery_one, A24minus[0]);
     fp2add(A, A24minus, A24plus);
     fp2sub(A, A24minus, A24minus);
         
     // Traverse tree
+    STATS_BEGIN(SIKE_PHASE_TRAVERSAL);
     index = 0;
     for (row = 1; row < MAX_Bob; row++) {
         while (index < MAX_Bob-row) {
@@ -341,20 +756,93 @@ int EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned
     fp2add(A24plus, A24minus, A);
     fp2add(A, A, A);
     fp2sub(A24plus, A24minus, A24plus);
+    STATS_END(SIKE_PHASE_TRAVERSAL);
+    STATS_BEGIN(SIKE_PHASE_JINV);
     j_inv(A, A24plus, jinv);    
     fp2_encode(jinv, SharedSecretB);    // Format shared secret
-      
+    STATS_END(SIKE_PHASE_JINV);
+}
+
+
+static int EphemeralSecretAgreement_B_extended(const unsigned char* PrivateKeyB, const unsigned char* PKA, unsigned char* SharedSecretB, sidh_scratch_t *scratch)
+{ // Bob's ephemeral shared secret computation using compression
+  // It produces a shared secret key SharedSecretB using his secret key PrivateKeyB and Alice's decompressed data point_R and param_A
+  // Inputs: Bob's PrivateKeyB is an integer in the range [1, oB-1], where oB = 3^OBOB_EXP. 
+  //         Alice's decompressed data consists of point_R in (X:Z) coordinates and the curve parameter param_A in GF(p^2).
+  // Output: a shared secret SharedSecretB that consists of one element in GF(p^2). 
+    point_proj_t R;
+    f2elm_t param_A = {0};
+
+    OPCOUNT_SCOPE(OPCOUNT_AGREEMENT_B);
+    USDT_SCOPE(OPCOUNT_AGREEMENT_B);
+    PKADecompression_dual(PrivateKeyB, PKA, R, param_A, &scratch->basis);
+    SharedSecret_B(R, param_A, SharedSecretB, &scratch->traversal);
+    return 0;
+}
+
+
+int EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned char* PKA, unsigned char* SharedSecretB)
+{ // Bob's ephemeral shared secret computation using compression -- SIDH protocol
+    sidh_scratch_t scratch;
+
+    return EphemeralSecretAgreement_B_extended(PrivateKeyB, PKA, SharedSecretB, &scratch);
+}
+
+
+int EphemeralSecretAgreement_B_ws(const unsigned char* PrivateKeyB, const unsigned char* PKA, unsigned char* SharedSecretB, void *workspace)
+{ // Bob's ephemeral shared secret computation using compression -- SIDH protocol, with the scratch memory in a workspace
+  // of crypto_kem_workspace_size() bytes
+    sidh_workspace_t *ws = workspace_align(workspace);
+
+    EphemeralSecretAgreement_B_extended(PrivateKeyB, PKA, SharedSecretB, &ws->scratch);
+    scratch_clear(&ws->scratch);
+    return 0;
+}
+
+
+static int EphemeralSecretAgreement_B_Uncompressed_extended(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, unsigned char* SharedSecretB, traversal_scratch_t *scratch)
+{ // Bob's ephemeral shared secret computation from Alice's public key {x(P), x(Q), x(P-Q)} given by PublicKeyDecompression_A(),
+  // with the kernel point x(P + skB*Q) from the 3-point ladder instead of the decompression
+    point_proj_t xs[3] = {0}, R;
+    f2elm_t A, A24;
+    digit_t SecretKeyB[NWORDS_ORDER] = {0};
+
+    OPCOUNT_SCOPE(OPCOUNT_AGREEMENT_B);
+    USDT_SCOPE(OPCOUNT_AGREEMENT_B);
+    for (int i = 0; i < 3; i++) {
+        fp2_decode(&PublicKeyA[i*FP2_ENCODED_BYTES], xs[i]->X);
+        fpcopy((digit_t*)Montgomery_one, (xs[i]->Z)[0]);
+    }
+    get_A(xs[0]->X, xs[1]->X, xs[2]->X, A);
+    fpadd(A[0], (digit_t*)Montgomery_one, A24[0]);
+    fpcopy(A[1], A24[1]);
+    fpadd(A24[0], (digit_t*)Montgomery_one, A24[0]);
+    fp2div2(A24, A24);
+    fp2div2(A24, A24);
+
+    decode_to_digits(PrivateKeyB, SecretKeyB, SECRETKEY_B_BYTES, NWORDS_ORDER);
+    Ladder3pt_dual(xs, SecretKeyB, BOB, R, A24);
+    clear_words((void*)SecretKeyB, NWORDS_ORDER);
+    SharedSecret_B(R, A, SharedSecretB, scratch);
     return 0;
 }
 
 
-static void FullIsogeny_B_dual(const unsigned char* PrivateKeyB, f2elm_t Ds[][2], f2elm_t A)
+int EphemeralSecretAgreement_B_Uncompressed(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, unsigned char* SharedSecretB)
+{ // Bob's ephemeral shared secret computation from Alice's uncompressed public key
+    traversal_scratch_t scratch;
+
+    return EphemeralSecretAgreement_B_Uncompressed_extended(PrivateKeyB, PublicKeyA, SharedSecretB, &scratch);
+}
+
+
+static void FullIsogeny_B_dual(const unsigned char* PrivateKeyB, f2elm_t Ds[][2], f2elm_t A, keygen_traversal_scratch_t *scratch)
 { // Bob's ephemeral public key generation
   // Input:  a private key PrivateKeyB in the range [0, 2^Floor(Log(2,oB)) - 1]. 
   // Output: the public key PublicKeyB consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
-    point_proj_t R = {0}, Q3 = {0}, pts[MAX_INT_POINTS_BOB];
+    point_proj_t R = {0}, Q3 = {0}, *pts = scratch->pts;
     f2elm_t XPB, XQB, XRB, coeff[3], A24plus = {0}, A24minus = {0};
-    unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_BOB], npts = 0, ii = 0;
+    unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_BOB_KEYGEN], npts = 0, ii = 0;
     digit_t SecretKeyB[NWORDS_ORDER] = {0};
 
     // Initialize basis points
@@ -374,14 +862,16 @@ static void FullIsogeny_B_dual(const unsigned char* PrivateKeyB, f2elm_t Ds[][2]
     decode_to_digits(PrivateKeyB, SecretKeyB, SECRETKEY_B_BYTES, NWORDS_ORDER);    
     LADDER3PT(XPB, XQB, XRB, SecretKeyB, BOB, R, A);
     
-    // Traverse tree
+    // Traverse tree with the default strategy: the basis generated from the kernels Ds of the dual isogenies depends on their
+    // projective representation, so that another strategy would give a different compressed public key
+    STATS_BEGIN(SIKE_PHASE_TRAVERSAL);
     index = 0;
     for (row = 1; row < MAX_Bob; row++) {
         while (index < MAX_Bob-row) {
             fp2copy(R->X, pts[npts]->X);
             fp2copy(R->Z, pts[npts]->Z);
             pts_index[npts++] = index;
-            m = strat_Bob[ii++];
+            m = strat_Bob_keygen[ii++];
             xTPLe(R, R, A24minus, A24plus, (int)m);
             index += m;
         } 
@@ -402,23 +892,26 @@ static void FullIsogeny_B_dual(const unsigned char* PrivateKeyB, f2elm_t Ds[][2]
     eval_3_isog(Q3, coeff);    // Kernel of dual 
     fp2sub(Q3->X, Q3->Z, Ds[MAX_Bob-1][0]);
     fp2add(Q3->X, Q3->Z, Ds[MAX_Bob-1][1]);
+    STATS_END(SIKE_PHASE_TRAVERSAL);
 
+    STATS_BEGIN(SIKE_PHASE_JINV);
     fp2add(A24plus, A24minus, A);
     fp2sub(A24plus, A24minus, A24plus);
     fp2inv_mont_bingcd(A24plus);
     fp2mul_mont(A24plus, A, A);
     fp2add(A, A, A);    // A = 2*(A24plus+A24mins)/(A24plus-A24minus) 
+    STATS_END(SIKE_PHASE_JINV);
 }
 
 
 static void Dlogs2_dual(const f2elm_t *f, int *D, digit_t *d0, digit_t *c0, digit_t *d1, digit_t *c1)
 {
-    solve_dlog(f[0], D, d0, 2);
-    solve_dlog(f[2], D, c0, 2);
-    solve_dlog(f[1], D, d1, 2);
-    solve_dlog(f[3], D, c1, 2);
+    OPCOUNT_SCOPE(OPCOUNT_DLOGS);
+    STATS_BEGIN(SIKE_PHASE_DLOGS);
+    solve_dlogs_dual(f, D, d0, c0, d1, c1, 2);
     mp_sub((digit_t*)Alice_order, c0, c0, NWORDS_ORDER);
     mp_sub((digit_t*)Alice_order, c1, c1, NWORDS_ORDER);
+    STATS_END(SIKE_PHASE_DLOGS);
 }
 
 
@@ -431,6 +924,7 @@ static int PKBDecompression_extended(const unsigned char* SecretKeyA, const unsi
     digit_t SKin[NWORDS_ORDER] = {0}, a0[NWORDS_ORDER] = {0}, a1[NWORDS_ORDER] = {0}, b0[NWORDS_ORDER] = {0}, b1[NWORDS_ORDER] = {0};
     point_proj_t Rs[3] = {0};
 
+    OPCOUNT_SCOPE(OPCOUNT_DECOMPRESS);
     mask >>= (MAXBITS_ORDER - OALICE_BITS);
 
     fp2_decode(&CompressedPKB[4*ORDER_A_ENCODED_BYTES], A);
@@ -505,6 +999,7 @@ static void Compress_PKB_dual_extended(digit_t *d0, digit_t *c0, digit_t *d1, di
     uint64_t mask = (digit_t)(-1);
     digit_t tmp[2*NWORDS_ORDER] = {0}, D[2*NWORDS_ORDER] = {0}, Dinv[2*NWORDS_ORDER] = {0};
     
+    OPCOUNT_SCOPE(OPCOUNT_COMPRESS);
     mask >>= (MAXBITS_ORDER - OALICE_BITS);
     
     multiply(c0, d1, tmp, NWORDS_ORDER);
@@ -547,6 +1042,7 @@ static void PKBDecompression(const unsigned char* SecretKeyA, const unsigned cha
     digit_t SKin[NWORDS_ORDER] = {0}, comp_temp[NWORDS_ORDER] = {0};
     point_proj_t Rs[3] = {0};
 
+    OPCOUNT_SCOPE(OPCOUNT_DECOMPRESS);
     mask >>= (MAXBITS_ORDER - OALICE_BITS);
     vone[0] = 1;
 
@@ -603,6 +1099,9 @@ static void PKBDecompression(const unsigned char* SecretKeyA, const unsigned cha
 static void Compress_PKB_dual(digit_t *d0, digit_t *c0, digit_t *d1, digit_t *c1, f2elm_t A, unsigned char qnr, unsigned char ind, unsigned char *CompressedPKB)
 { // Bob's PK compression -- SIDH protocol
     digit_t tmp[2*NWORDS_ORDER], inv[NWORDS_ORDER];
+
+    OPCOUNT_SCOPE(OPCOUNT_COMPRESS);
+
     if ((d1[0] & 1) == 1) {  // Storing [-d0*d1^-1 = b1*a0^-1, -c1*d1^-1 = a1*a0^-1, c0*d1^-1 = b0*a0^-1] and setting bit384 to 0
         inv_mod_orderA(d1, inv);
         Montgomery_neg(d0, (digit_t*)Alice_order);
@@ -640,17 +1139,19 @@ static void Compress_PKB_dual(digit_t *d0, digit_t *c0, digit_t *d1, digit_t *c1
 }
 
 
-static int EphemeralKeyGeneration_B_extended(const unsigned char* PrivateKeyB, unsigned char* CompressedPKB, unsigned int sike)
+static int EphemeralKeyGeneration_B_extended(const unsigned char* PrivateKeyB, unsigned char* CompressedPKB, unsigned int sike, f2elm_t Ds[][2], sidh_scratch_t *scratch)
 { // Bob's ephemeral public key generation using compression -- SIKE protocol
     unsigned char qnr, ind;
     int D[DLEN_2] = {0};
     digit_t c0[NWORDS_ORDER] = {0}, d0[NWORDS_ORDER] = {0}, c1[NWORDS_ORDER] = {0}, d1[NWORDS_ORDER] = {0}; 
-    f2elm_t Ds[MAX_Bob][2] = {0}, f[4] = {0}, A = {0};
+    f2elm_t f[4] = {0}, A = {0};
     point_full_proj_t Rs[2] = {0};
     point_t Pw, Qw;
 
-    FullIsogeny_B_dual(PrivateKeyB, Ds, A);
-    BuildOrdinary2nBasis_dual(A, Ds, Rs, &qnr, &ind);  // Generate a basis in E_A and pulls it back to E_A6. Rs[0] and Rs[1] affinized.
+    OPCOUNT_SCOPE(OPCOUNT_KEYGEN_B);
+    USDT_SCOPE(OPCOUNT_KEYGEN_B);
+    FullIsogeny_B_dual(PrivateKeyB, Ds, A, &scratch->keygen_traversal);
+    BuildOrdinary2nBasis_dual(A, Ds, Rs, &qnr, &ind, &scratch->basis);  // Generate a basis in E_A and pulls it back to E_A6. Rs[0] and Rs[1] affinized.
 
     // Maps from y^2 = x^3 + 6x^2 + x into y^2 = x^3 -11x + 14
     fpadd((digit_t*)Montgomery_one, (Rs[0]->X)[0], (Rs[0]->X)[0]);
@@ -658,15 +1159,15 @@ static int EphemeralKeyGeneration_B_extended(const unsigned char* PrivateKeyB, u
     fpadd((digit_t*)Montgomery_one, (Rs[1]->X)[0], (Rs[1]->X)[0]);
     fpadd((digit_t*)Montgomery_one, (Rs[1]->X)[0], (Rs[1]->X)[0]);  // Weierstrass form 
 
-    fpcopy((digit_t*)A_basis_zero + 0*NWORDS_FIELD, Pw->x[0]);
-    fpcopy((digit_t*)A_basis_zero + 1*NWORDS_FIELD, Pw->x[1]);
-    fpcopy((digit_t*)A_basis_zero + 2*NWORDS_FIELD, Pw->y[0]);
-    fpcopy((digit_t*)A_basis_zero + 3*NWORDS_FIELD, Pw->y[1]);
-    fpcopy((digit_t*)A_basis_zero + 4*NWORDS_FIELD, Qw->x[0]);
-    fpcopy((digit_t*)A_basis_zero + 5*NWORDS_FIELD, Qw->x[1]);
-    fpcopy((digit_t*)A_basis_zero + 6*NWORDS_FIELD, Qw->y[0]);
-    fpcopy((digit_t*)A_basis_zero + 7*NWORDS_FIELD, Qw->y[1]);
-    Tate2_pairings(Pw, Qw, Rs, f);
+    fpcopy((digit_t*)comp_tables.A_basis_zero + 0*NWORDS_FIELD, Pw->x[0]);
+    fpcopy((digit_t*)comp_tables.A_basis_zero + 1*NWORDS_FIELD, Pw->x[1]);
+    fpcopy((digit_t*)comp_tables.A_basis_zero + 2*NWORDS_FIELD, Pw->y[0]);
+    fpcopy((digit_t*)comp_tables.A_basis_zero + 3*NWORDS_FIELD, Pw->y[1]);
+    fpcopy((digit_t*)comp_tables.A_basis_zero + 4*NWORDS_FIELD, Qw->x[0]);
+    fpcopy((digit_t*)comp_tables.A_basis_zero + 5*NWORDS_FIELD, Qw->x[1]);
+    fpcopy((digit_t*)comp_tables.A_basis_zero + 6*NWORDS_FIELD, Qw->y[0]);
+    fpcopy((digit_t*)comp_tables.A_basis_zero + 7*NWORDS_FIELD, Qw->y[1]);
+    Tate2_pairings(Pw, Qw, Rs, f, &scratch->pairing);
     fp2correction(f[0]);
     fp2correction(f[1]);
     fp2correction(f[2]);
@@ -684,19 +1185,34 @@ static int EphemeralKeyGeneration_B_extended(const unsigned char* PrivateKeyB, u
 
 int EphemeralKeyGeneration_B(const unsigned char* PrivateKeyB, unsigned char* CompressedPKB)
 { // Bob's ephemeral public key generation using compression -- SIDH protocol
+    f2elm_t Ds[MAX_Bob][2];
+    sidh_scratch_t scratch;
+
+    return EphemeralKeyGeneration_B_extended(PrivateKeyB, CompressedPKB, 0, Ds, &scratch);
+}
+
+
+int EphemeralKeyGeneration_B_ws(const unsigned char* PrivateKeyB, unsigned char* CompressedPKB, void *workspace)
+{ // Bob's ephemeral public key generation using compression -- SIDH protocol, with the scratch memory in a workspace
+  // of crypto_kem_workspace_size() bytes
+    sidh_workspace_t *ws = workspace_align(workspace);
 
-    return EphemeralKeyGeneration_B_extended(PrivateKeyB, CompressedPKB, 0);
+    EphemeralKeyGeneration_B_extended(PrivateKeyB, CompressedPKB, 0, ws->walk.Ds, &ws->scratch);
+    workspace_clear(ws);
+    return 0;
 }
 
 
-static int EphemeralSecretAgreement_A_extended(const unsigned char* PrivateKeyA, const unsigned char* PKB, unsigned char* SharedSecretA, unsigned int sike)
+static int EphemeralSecretAgreement_A_extended(const unsigned char* PrivateKeyA, const unsigned char* PKB, unsigned char* SharedSecretA, unsigned int sike, traversal_scratch_t *scratch)
 { // Alice's ephemeral shared secret computation using compression -- SIKE protocol
     unsigned int i, ii = 0, row, m, index = 0, pts_index[MAX_INT_POINTS_ALICE], npts = 0;
     f2elm_t A24plus = {0}, C24 = {0};
-    point_proj_t R, pts[MAX_INT_POINTS_ALICE];
+    point_proj_t R, *pts = scratch->pts;
     f2elm_t jinv, coeff[5], A;
     f2elm_t param_A = {0};
 
+    OPCOUNT_SCOPE(OPCOUNT_AGREEMENT_A);
+    USDT_SCOPE(OPCOUNT_AGREEMENT_A);
     if (sike == 1) {
         if (!PKBDecompression_extended(PrivateKeyA, PKB, R, param_A, SharedSecretA + FP2_ENCODED_BYTES) == 0)
             return 1;
@@ -709,6 +1225,7 @@ static int EphemeralSecretAgreement_A_extended(const unsigned char* PrivateKeyA,
     fp2add(A, C24, A24plus);
     fpadd(C24[0], C24[0], C24[0]);    
 
+    STATS_BEGIN(SIKE_PHASE_TRAVERSAL);
 #if (OALICE_BITS % 2 == 1)
     point_proj_t S;
 
@@ -744,8 +1261,11 @@ static int EphemeralSecretAgreement_A_extended(const unsigned char* PrivateKeyA,
     fp2add(A24plus, A24plus, A24plus);
     fp2sub(A24plus, C24, A24plus);
     fp2add(A24plus, A24plus, A24plus);
+    STATS_END(SIKE_PHASE_TRAVERSAL);
+    STATS_BEGIN(SIKE_PHASE_JINV);
     j_inv(A24plus, C24, jinv);    
     fp2_encode(jinv, SharedSecretA);    // Format shared secret
+    STATS_END(SIKE_PHASE_JINV);
     
     return 0;
 }
@@ -757,14 +1277,26 @@ int EphemeralSecretAgreement_A(const unsigned char* PrivateKeyA, const unsigned
   // Inputs: Alice's PrivateKeyA is an even integer in the range [2, oA-2], where oA = 2^OALICE_BITS. 
   //         Bob's decompressed data consists of point_R in (X:Z) coordinates and the curve parameter param_A in GF(p^2).
   // Output: a shared secret SharedSecretA that consists of one element in GF(p^2).
+    traversal_scratch_t scratch;
+
+    return EphemeralSecretAgreement_A_extended(PrivateKeyA, PKB, SharedSecretA, 0, &scratch);
+}
 
-    return EphemeralSecretAgreement_A_extended(PrivateKeyA, PKB, SharedSecretA, 0);
+
+int EphemeralSecretAgreement_A_ws(const unsigned char* PrivateKeyA, const unsigned char* PKB, unsigned char* SharedSecretA, void *workspace)
+{ // Alice's ephemeral shared secret computation using compression -- SIDH protocol, with the scratch memory in a workspace
+  // of crypto_kem_workspace_size() bytes
+    sidh_workspace_t *ws = workspace_align(workspace);
+
+    EphemeralSecretAgreement_A_extended(PrivateKeyA, PKB, SharedSecretA, 0, &ws->scratch.traversal);
+    scratch_clear(&ws->scratch);
+    return 0;
 }
 
 
-int8_t validate_ciphertext(const unsigned char* ephemeralsk_, const unsigned char* CompressedPKB, const unsigned char* xKA, const unsigned char* tphiBKA_t)
+int8_t validate_ciphertext(const unsigned char* ephemeralsk_, const unsigned char* CompressedPKB, const unsigned char* xKA, const unsigned char* tphiBKA_t, traversal_scratch_t *scratch)
 { // If ct validation passes returns 0, otherwise returns -1.
-    point_proj_t phis[3] = {0}, R, S, pts[MAX_INT_POINTS_BOB];
+    point_proj_t phis[3] = {0}, R, S, *pts = scratch->pts;
     f2elm_t XPB, XQB, XRB, coeff[3], A24plus = {0}, A24minus = {0}, A = {0}, comp1 = {0}, comp2 = {0}, one = {0};
     digit_t temp[NWORDS_ORDER] = {0}, sk[NWORDS_ORDER] = {0};
     unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_BOB], npts = 0, ii = 0;
@@ -789,6 +1321,7 @@ int8_t validate_ciphertext(const unsigned char* ephemeralsk_, const unsigned cha
     LADDER3PT(XPB, XQB, XRB, sk, BOB, R, A);
     
     // Traverse tree
+    STATS_BEGIN(SIKE_PHASE_TRAVERSAL);
     index = 0;
     for (row = 1; row < MAX_Bob; row++) {
         while (index < MAX_Bob-row) {
@@ -812,6 +1345,7 @@ int8_t validate_ciphertext(const unsigned char* ephemeralsk_, const unsigned cha
     }    
     get_3_isog(R, A24minus, A24plus, coeff);         
     eval_3_isog(phis[0], coeff);  // phis[0] <- phiB(PA + skA*QA)
+    STATS_END(SIKE_PHASE_TRAVERSAL);
 
     fp2_decode(&CompressedPKB[4*ORDER_A_ENCODED_BYTES], A);
     
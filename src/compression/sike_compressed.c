@@ -10,19 +10,30 @@
 
 #include <string.h>
 #include "../sha3/fips202.h"
+#include "../ctx/sike_ctx.h"
 
 
-int crypto_kem_keypair(unsigned char *pk, unsigned char *sk)
+static int kem_keypair_coins(unsigned char *coins)
+{ // Random bytes of the key generation: s||SK (CRYPTO_KEYPAIRCOINBYTES = MSG_BYTES + SECRETKEY_A_BYTES bytes)
+    return (randombytes(coins, MSG_BYTES) != 0 || random_mod_order_A(coins + MSG_BYTES) != 0);
+}
+
+
+static int kem_keypair(unsigned char *pk, unsigned char *sk, const unsigned char *coins, f2elm_t As[][5], sidh_scratch_t *scratch)
 { // SIKE's key generation using compression
+  // Input:   coins s||SK (CRYPTO_KEYPAIRCOINBYTES = MSG_BYTES + SECRETKEY_A_BYTES bytes)
   // Outputs: secret key sk (CRYPTO_SECRETKEYBYTES = MSG_BYTES + SECRETKEY_A_BYTES + CRYPTO_PUBLICKEYBYTES + FP2_ENCODED_BYTES bytes)
   //          public key pk_comp (CRYPTO_PUBLICKEYBYTES bytes) 
+    OPCOUNT_SCOPE(OPCOUNT_KEM_KEYPAIR);
+    USDT_SCOPE(OPCOUNT_KEM_KEYPAIR);
     
     // Generate lower portion of secret key sk <- s||SK
-    if (randombytes(sk, MSG_BYTES) != 0 || random_mod_order_A(sk + MSG_BYTES) != 0)
-        return 1;
+    memcpy(sk, coins, MSG_BYTES + SECRETKEY_A_BYTES);
+    sk[MSG_BYTES] &= 0xFE;                                // Make private scalar even and mask last byte as in random_mod_order_A
+    sk[MSG_BYTES + SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
 
     // Generate public key pk
-    EphemeralKeyGeneration_A_extended(sk + MSG_BYTES, pk);
+    EphemeralKeyGeneration_A_extended(sk + MSG_BYTES, pk, 1, As, scratch);
 
     // Append public key pk to secret key sk
     memcpy(&sk[MSG_BYTES + SECRETKEY_A_BYTES], pk, CRYPTO_PUBLICKEYBYTES);
@@ -31,9 +42,48 @@ int crypto_kem_keypair(unsigned char *pk, unsigned char *sk)
 }
 
 
-int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk)
+int crypto_kem_keypair(unsigned char *pk, unsigned char *sk)
+{ // SIKE's key generation using compression
+    digit_t coins[NBYTES_TO_NWORDS(CRYPTO_KEYPAIRCOINBYTES)];    // s||SK, in words to be cleared
+    f2elm_t As[MAX_Alice+1][5];
+    sidh_scratch_t scratch;
+    int ret = 1;
+
+    if (kem_keypair_coins((unsigned char*)coins) == 0)
+        ret = kem_keypair(pk, sk, (unsigned char*)coins, As, &scratch);
+    clear_words((void*)coins, NBYTES_TO_NWORDS(CRYPTO_KEYPAIRCOINBYTES));
+    return ret;
+}
+
+
+int crypto_kem_keypair_derand(unsigned char *pk, unsigned char *sk, const unsigned char *coins)
+{ // SIKE's key generation using compression, with the random bytes given by the caller
+    f2elm_t As[MAX_Alice+1][5];
+    sidh_scratch_t scratch;
+
+    return kem_keypair(pk, sk, coins, As, &scratch);
+}
+
+
+int crypto_kem_keypair_ws(unsigned char *pk, unsigned char *sk, void *workspace)
+{ // SIKE's key generation using compression, with the scratch memory in a workspace of crypto_kem_workspace_size() bytes
+    sidh_workspace_t *ws = workspace_align(workspace);
+    digit_t coins[NBYTES_TO_NWORDS(CRYPTO_KEYPAIRCOINBYTES)];    // s||SK, in words to be cleared
+    int ret = 1;
+
+    if (kem_keypair_coins((unsigned char*)coins) == 0)
+        ret = kem_keypair(pk, sk, (unsigned char*)coins, ws->walk.As, &ws->scratch);
+    clear_words((void*)coins, NBYTES_TO_NWORDS(CRYPTO_KEYPAIRCOINBYTES));
+    workspace_clear(ws);
+    return ret;
+}
+
+
+static int kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk, const unsigned char *pk_uncomp, const unsigned char *coins, f2elm_t Ds[][2], sidh_scratch_t *scratch)
 { // SIKE's encapsulation using compression
   // Input:   public key pk              (CRYPTO_PUBLICKEYBYTES bytes)
+  //          uncompressed public key pk_uncomp, or NULL to decompress pk (CRYPTO_PUBLICKEYBYTES_UNCOMPRESSED bytes)
+  //          coins m                    (CRYPTO_ENCCOINBYTES = MSG_BYTES bytes)
   // Outputs: shared secret ss           (CRYPTO_BYTES bytes)
   //          ciphertext message ct      (CRYPTO_CIPHERTEXTBYTES = PARTIALLY_COMPRESSED_CHUNK_CT + MSG_BYTES bytes)
     unsigned char ephemeralsk[SECRETKEY_B_BYTES] = {0};
@@ -41,30 +91,101 @@ int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk
     unsigned char h[MSG_BYTES];
     unsigned char temp[CRYPTO_CIPHERTEXTBYTES + MSG_BYTES] = {0};
 
+    OPCOUNT_SCOPE(OPCOUNT_KEM_ENC);
+    USDT_SCOPE(OPCOUNT_KEM_ENC);
     // Generate ephemeralsk <- G(m||pk) mod oB 
-    if (randombytes(temp, MSG_BYTES) != 0)
-        return 1;
+    memcpy(temp, coins, MSG_BYTES);
     memcpy(&temp[MSG_BYTES], pk, CRYPTO_PUBLICKEYBYTES);        
-    shake256(ephemeralsk, SECRETKEY_B_BYTES, temp, MSG_BYTES + CRYPTO_PUBLICKEYBYTES);
+    STATS_PHASE(SIKE_PHASE_HASH, shake256(ephemeralsk, SECRETKEY_B_BYTES, temp, MSG_BYTES + CRYPTO_PUBLICKEYBYTES));
     FormatPrivKey_B(ephemeralsk);
     
     // Encrypt
-    EphemeralKeyGeneration_B_extended(ephemeralsk, ct, 1); 
-    EphemeralSecretAgreement_B(ephemeralsk, pk, jinvariant);  
-    shake256(h, MSG_BYTES, jinvariant, FP2_ENCODED_BYTES);          
+    EphemeralKeyGeneration_B_extended(ephemeralsk, ct, 1, Ds, scratch); 
+    if (pk_uncomp == NULL)
+        EphemeralSecretAgreement_B_extended(ephemeralsk, pk, jinvariant, scratch);
+    else
+        EphemeralSecretAgreement_B_Uncompressed_extended(ephemeralsk, pk_uncomp, jinvariant, &scratch->traversal);
+    STATS_PHASE(SIKE_PHASE_HASH, shake256(h, MSG_BYTES, jinvariant, FP2_ENCODED_BYTES));          
     for (int i = 0; i < MSG_BYTES; i++) {
         ct[i + PARTIALLY_COMPRESSED_CHUNK_CT] = temp[i] ^ h[i];
     }
 
     // Generate shared secret ss <- H(m||ct)
     memcpy(&temp[MSG_BYTES], ct, CRYPTO_CIPHERTEXTBYTES);      
-    shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES + MSG_BYTES);
+    STATS_PHASE(SIKE_PHASE_HASH, shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES + MSG_BYTES));
 
     return 0;
 }
 
 
-int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk)
+int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk)
+{ // SIKE's encapsulation using compression
+    digit_t coins[NBYTES_TO_NWORDS(CRYPTO_ENCCOINBYTES)];    // m, in words to be cleared
+    f2elm_t Ds[MAX_Bob][2] = {0};
+    sidh_scratch_t scratch;
+    int ret = 1;
+
+    if (randombytes((unsigned char*)coins, MSG_BYTES) == 0)
+        ret = kem_enc(ct, ss, pk, NULL, (unsigned char*)coins, Ds, &scratch);
+    clear_words((void*)coins, NBYTES_TO_NWORDS(CRYPTO_ENCCOINBYTES));
+    return ret;
+}
+
+
+int crypto_kem_enc_derand(unsigned char *ct, unsigned char *ss, const unsigned char *pk, const unsigned char *coins)
+{ // SIKE's encapsulation using compression, with the random bytes given by the caller
+    f2elm_t Ds[MAX_Bob][2] = {0};
+    sidh_scratch_t scratch;
+
+    return kem_enc(ct, ss, pk, NULL, coins, Ds, &scratch);
+}
+
+
+int crypto_kem_enc_ws(unsigned char *ct, unsigned char *ss, const unsigned char *pk, void *workspace)
+{ // SIKE's encapsulation using compression, with the scratch memory in a workspace of crypto_kem_workspace_size() bytes
+    sidh_workspace_t *ws = workspace_align(workspace);
+    digit_t coins[NBYTES_TO_NWORDS(CRYPTO_ENCCOINBYTES)];    // m, in words to be cleared
+    int ret = 1;
+
+    if (randombytes((unsigned char*)coins, MSG_BYTES) == 0)
+        ret = kem_enc(ct, ss, pk, NULL, (unsigned char*)coins, ws->walk.Ds, &ws->scratch);
+    clear_words((void*)coins, NBYTES_TO_NWORDS(CRYPTO_ENCCOINBYTES));
+
+    workspace_clear(ws);
+    return ret;
+}
+
+
+int crypto_kem_enc_uncompressed(unsigned char *ct, unsigned char *ss, const unsigned char *pk, const unsigned char *pk_uncomp)
+{ // SIKE's encapsulation using compression, with the secret agreement computed from the uncompressed public key pk_uncomp of pk
+  // The compressed key pk is still needed, as it is hashed with m into the ephemeral secret key
+    digit_t coins[NBYTES_TO_NWORDS(CRYPTO_ENCCOINBYTES)];    // m, in words to be cleared
+    f2elm_t Ds[MAX_Bob][2] = {0};
+    sidh_scratch_t scratch;
+    int ret = 1;
+
+    if (randombytes((unsigned char*)coins, MSG_BYTES) == 0)
+        ret = kem_enc(ct, ss, pk, pk_uncomp, (unsigned char*)coins, Ds, &scratch);
+    clear_words((void*)coins, NBYTES_TO_NWORDS(CRYPTO_ENCCOINBYTES));
+    return ret;
+}
+
+
+int crypto_kem_decompress_pk(unsigned char *pk_uncomp, const unsigned char *pk)
+{ // Conversion of the public key pk (CRYPTO_PUBLICKEYBYTES bytes) to the uncompressed encoding pk_uncomp (CRYPTO_PUBLICKEYBYTES_UNCOMPRESSED bytes)
+    return PublicKeyDecompression_A(pk, pk_uncomp);
+}
+
+
+int crypto_kem_compress_pk(unsigned char *pk, const unsigned char *sk)
+{ // Compressed public key pk (CRYPTO_PUBLICKEYBYTES bytes) of the secret key sk. The key generation stores it in sk, so that it is copied
+  // instead of being computed again from the uncompressed key
+    memcpy(pk, &sk[MSG_BYTES + SECRETKEY_A_BYTES], CRYPTO_PUBLICKEYBYTES);
+    return 0;
+}
+
+
+static int kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk, traversal_scratch_t *scratch)
 { // SIKE's decapsulation using compression 
   // Input:   secret key sk                         (CRYPTO_SECRETKEYBYTES = MSG_BYTES + SECRETKEY_A_BYTES + CRYPTO_PUBLICKEYBYTES + FP2_ENCODED_BYTES bytes)
   //          compressed ciphertext message ct      (CRYPTO_CIPHERTEXTBYTES = PARTIALLY_COMPRESSED_CHUNK_CT + MSG_BYTES bytes) 
@@ -75,11 +196,13 @@ int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned ch
     unsigned char* tphiBKA_t = &jinvariant_[FP2_ENCODED_BYTES];
     int8_t selector = -1;
     
+    OPCOUNT_SCOPE(OPCOUNT_KEM_DEC);
+    USDT_SCOPE(OPCOUNT_KEM_DEC);
     // Decrypt 
-    if (!EphemeralSecretAgreement_A_extended(sk + MSG_BYTES, ct, jinvariant_, 1) == 0) {
+    if (!EphemeralSecretAgreement_A_extended(sk + MSG_BYTES, ct, jinvariant_, 1, scratch) == 0) {
         goto Hashing;
     }
-    shake256(h_, MSG_BYTES, jinvariant_, FP2_ENCODED_BYTES);   
+    STATS_PHASE(SIKE_PHASE_HASH, shake256(h_, MSG_BYTES, jinvariant_, FP2_ENCODED_BYTES));   
     
     for (int i = 0; i < MSG_BYTES; i++) {
         temp[i] = ct[i + PARTIALLY_COMPRESSED_CHUNK_CT] ^ h_[i];                         
@@ -87,18 +210,42 @@ int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned ch
     
     // Generate ephemeralsk_ <- G(m||pk) mod oB
     memcpy(&temp[MSG_BYTES], &sk[MSG_BYTES + SECRETKEY_A_BYTES], CRYPTO_PUBLICKEYBYTES);            
-    shake256(ephemeralsk_, SECRETKEY_B_BYTES, temp, MSG_BYTES + CRYPTO_PUBLICKEYBYTES);
+    STATS_PHASE(SIKE_PHASE_HASH, shake256(ephemeralsk_, SECRETKEY_B_BYTES, temp, MSG_BYTES + CRYPTO_PUBLICKEYBYTES));
     FormatPrivKey_B(ephemeralsk_);
     
     // Generate shared secret ss <- H(m||ct), or output ss <- H(s||ct) in case of ct verification failure
     // No need to recompress, just check if x(phi(P) + t*phi(Q)) == x((a0 + t*a1)*R1 + (b0 + t*b1)*R2)    
-    selector = validate_ciphertext(ephemeralsk_, ct, &sk[MSG_BYTES + SECRETKEY_A_BYTES + CRYPTO_PUBLICKEYBYTES], tphiBKA_t);
+    selector = validate_ciphertext(ephemeralsk_, ct, &sk[MSG_BYTES + SECRETKEY_A_BYTES + CRYPTO_PUBLICKEYBYTES], tphiBKA_t, scratch);
 Hashing:
     // If ct validation passes (selector = 0) then do ss = H(m||ct), otherwise (selector = -1) load s to do ss = H(s||ct)
     ct_cmov(temp, sk, MSG_BYTES, selector);
     memcpy(&temp[MSG_BYTES], ct, CRYPTO_CIPHERTEXTBYTES);  
-    shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES + MSG_BYTES);
+    STATS_PHASE(SIKE_PHASE_HASH, shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES + MSG_BYTES));
 
     return 0;
 }
 
+
+int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk)
+{ // SIKE's decapsulation using compression
+    traversal_scratch_t scratch;
+
+    return kem_dec(ss, ct, sk, &scratch);
+}
+
+
+int crypto_kem_dec_ws(unsigned char *ss, const unsigned char *ct, const unsigned char *sk, void *workspace)
+{ // SIKE's decapsulation using compression, with the scratch memory in a workspace of crypto_kem_workspace_size() bytes
+    sidh_workspace_t *ws = workspace_align(workspace);
+    int ret;
+
+    ret = kem_dec(ss, ct, sk, &ws->scratch.traversal);
+    scratch_clear(&ws->scratch);
+    return ret;
+}
+
+
+// Parameter-set descriptor of the context interface
+const sike_scheme kem_scheme = {CRYPTO_ALGNAME, CRYPTO_SECRETKEYBYTES, CRYPTO_PUBLICKEYBYTES, CRYPTO_CIPHERTEXTBYTES, CRYPTO_BYTES, WORKSPACE_BYTES,
+                                crypto_kem_keypair, crypto_kem_enc, crypto_kem_dec, crypto_kem_keypair_ws, crypto_kem_enc_ws,
+                                CRYPTO_KEYPAIRCOINBYTES, CRYPTO_ENCCOINBYTES, crypto_kem_keypair_derand, crypto_kem_enc_derand, crypto_kem_dec_ws};
\ No newline at end of file
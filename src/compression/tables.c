@@ -0,0 +1,490 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/PQCrypto-SIDH
+* Released under MIT license
+*
+* Abstract: access to the pairing and Pohlig-Hellman tables for compression
+*********************************************************************************************/
+
+#include <stddef.h>
+#include <string.h>
+#if defined(__NIX__)
+    #include <stdio.h>
+    #include <stdlib.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <errno.h>
+    #if defined(_RUNTIME_TABLES_)
+        #include <pthread.h>
+    #endif
+#endif
+
+#define HUGEPAGE_BYTES    ((size_t)1 << 21)
+
+
+#if defined(_RUNTIME_TABLES_)
+// Tables computed by tables_init() in place of PXXX_compressed_pair_tables.c and PXXX_compressed_dlog_tables.c
+static uint64_t T_tate3[(6*(OBOB_EXPON - 1) + 4)*NWORDS64_FIELD];
+static uint64_t T_tate2_firststep_P[4*NWORDS64_FIELD];
+static uint64_t T_tate2_P[3*(OALICE_BITS - 2)*NWORDS64_FIELD];
+static uint64_t T_tate2_firststep_Q[4*NWORDS64_FIELD];
+static uint64_t T_tate2_Q[3*(OALICE_BITS - 2)*NWORDS64_FIELD];
+static unsigned int ph2_path[PLEN_2];
+static unsigned int ph3_path[PLEN_3];
+static uint64_t ph2_Texp[((1<<(W_2_1-2))-1)*NWORDS64_FIELD];
+static int ph2_Log[(1<<(W_2_1))-1];
+static uint64_t ph2_G[(1<<(W_2-2))*NWORDS64_FIELD];
+static uint64_t ph2_CT[DLEN_2*(ELL2_W >> 1)*NWORDS64_FIELD];
+#if (OBOB_EXPON % W_3 == 0)
+static uint64_t ph3_T[DLEN_3*(ELL3_W>>1)*2*NWORDS64_FIELD];
+#else
+static uint64_t ph3_T1[DLEN_3*(ELL3_W>>1)*2*NWORDS64_FIELD];
+static uint64_t ph3_T2[DLEN_3*(ELL3_W>>1)*2*NWORDS64_FIELD];
+#endif
+
+static int tables_generate(void);
+#endif
+
+
+// The precomputed tables of compression are read through these pointers. They refer to the compiled tables unless a copy is installed
+// by tables_hugepages() or the tables are mapped from a table store by tables_map() or tables_init(). The three elements of step k of
+// T_tate2_P and T_tate2_Q are located at element tate2_stride*k, so that both tables can be interleaved step by step in a single
+// slot of tables_hugepages().
+typedef struct {
+    const void *A_basis_zero, *B_basis_zero, *B_gen_3_tors;
+    const void *table_v_qr, *table_v_qnr, *table_r_qr, *table_r_qnr, *v_3_torsion;
+    const void *T_tate3;
+    const void *T_tate2_firststep_P, *T_tate2_P;
+    const void *T_tate2_firststep_Q, *T_tate2_Q;
+    unsigned int tate2_stride;                   // Stride between steps of T_tate2_P and T_tate2_Q in field elements
+    const void *ph2_path, *ph3_path;
+    const void *ph2_CT, *ph2_Texp, *ph2_Log, *ph2_G;
+    const void *ph3_T, *ph3_T1, *ph3_T2;
+    void *region;                                // Memory holding the copy of the tables, if any
+    size_t region_bytes;
+    void *file_map;                              // Mapping of the table store, if any
+    size_t file_bytes;
+} compression_tables;
+
+static compression_tables comp_tables = {
+    A_basis_zero, B_basis_zero, B_gen_3_tors,
+    table_v_qr, table_v_qnr, table_r_qr, table_r_qnr, v_3_torsion,
+    T_tate3,
+    T_tate2_firststep_P, T_tate2_P,
+    T_tate2_firststep_Q, T_tate2_Q,
+    3,
+    ph2_path, ph3_path,
+    ph2_CT, ph2_Texp, ph2_Log, ph2_G,
+#if (OBOB_EXPON % W_3 == 0)
+    ph3_T, NULL, NULL,
+#else
+    NULL, ph3_T1, ph3_T2,
+#endif
+    NULL, 0, NULL, 0
+};
+
+// Tables in the order of use: key generation and decompression build the torsion bases, then run the pairings and then the discrete logs.
+// The position of a table in this list is its identifier in the table store, whose version must change with the list.
+typedef struct {
+    size_t field;                                // Offset of the table pointer in compression_tables
+    size_t bytes;
+} table_entry;
+
+#define TABLE_ENTRY(t)           { offsetof(compression_tables, t), sizeof(t) }
+#define TABLE_PTR(tables, i)     (*(const void**)((unsigned char*)(tables) + table_entries[i].field))
+
+static const table_entry table_entries[] = {
+    TABLE_ENTRY(A_basis_zero),
+    TABLE_ENTRY(B_basis_zero),
+    TABLE_ENTRY(B_gen_3_tors),
+    TABLE_ENTRY(table_v_qr),
+    TABLE_ENTRY(table_v_qnr),
+    TABLE_ENTRY(table_r_qr),
+    TABLE_ENTRY(table_r_qnr),
+    TABLE_ENTRY(v_3_torsion),
+    TABLE_ENTRY(T_tate2_firststep_P),
+    TABLE_ENTRY(T_tate2_firststep_Q),
+    TABLE_ENTRY(T_tate2_P),
+    TABLE_ENTRY(T_tate2_Q),
+    TABLE_ENTRY(T_tate3),
+    TABLE_ENTRY(ph2_path),
+    TABLE_ENTRY(ph2_CT),
+    TABLE_ENTRY(ph2_Texp),
+    TABLE_ENTRY(ph2_Log),
+    TABLE_ENTRY(ph2_G),
+    TABLE_ENTRY(ph3_path),
+#if (OBOB_EXPON % W_3 == 0)
+    TABLE_ENTRY(ph3_T),
+#else
+    TABLE_ENTRY(ph3_T1),
+    TABLE_ENTRY(ph3_T2),
+#endif
+};
+#define NUM_TABLE_ENTRIES    (sizeof(table_entries)/sizeof(table_entry))
+
+
+static inline void prefetch_range(const void *addr, size_t nbytes)
+{ // Prefetch the cache lines holding addr[0, nbytes-1]
+    const unsigned char *p = (const unsigned char*)addr;
+
+    for (size_t i = 0; i < nbytes; i += CACHE_LINE_BYTES) {
+        PREFETCH(p + i);
+    }
+    PREFETCH(p + nbytes - 1);
+}
+
+
+static size_t align_up(size_t n, size_t alignment)
+{
+    return (n + alignment - 1) & ~(alignment - 1);
+}
+
+
+#if defined(__linux__)
+
+static void* map_hugepages(size_t nbytes)
+{ // Anonymous memory backed by huge pages, either reserved ones (hugetlbfs) or transparent huge pages. Returns NULL on failure.
+    unsigned char *p, *aligned;
+    size_t head;
+
+#if defined(MAP_HUGETLB)
+    p = (unsigned char*)mmap(NULL, nbytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (p != MAP_FAILED) return p;
+#endif
+    // Transparent huge pages need a 2MB-aligned range
+    p = (unsigned char*)mmap(NULL, nbytes + HUGEPAGE_BYTES, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) return NULL;
+    aligned = (unsigned char*)align_up((size_t)p, HUGEPAGE_BYTES);
+    head = (size_t)(aligned - p);
+    if (head != 0) munmap(p, head);
+    munmap(aligned + nbytes, HUGEPAGE_BYTES - head);
+#if defined(MADV_HUGEPAGE)
+    madvise(aligned, nbytes, MADV_HUGEPAGE);
+#endif
+    return aligned;
+}
+
+
+static size_t hugepages_slot_bytes(unsigned int i)
+{ // Bytes of the slot of table i in the copy of tables_hugepages(). T_tate2_P and T_tate2_Q are interleaved in a single slot, that of T_tate2_P,
+  // sized for both tables, so that the slots do not depend on the position of T_tate2_Q in table_entries.
+    if (table_entries[i].field == offsetof(compression_tables, T_tate2_P)) {
+        return align_up(sizeof(T_tate2_P) + sizeof(T_tate2_Q), CACHE_LINE_BYTES);
+    } else if (table_entries[i].field == offsetof(compression_tables, T_tate2_Q)) {
+        return 0;
+    }
+    return align_up(table_entries[i].bytes, CACHE_LINE_BYTES);
+}
+
+#endif
+
+
+#if defined(__NIX__)
+// Table store: a header, a directory with the offset and size of each table, and the tables in the order of table_entries, each one at
+// a 64-byte aligned offset. A store is only accepted by the library variant, window sizes and byte order that wrote it, and only if
+// its checksum matches.
+
+#define TABLES_STORE_MAGIC      "SIKETBL"
+#define TABLES_STORE_VERSION    2
+#define TABLES_BYTE_ORDER       0x01020304
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;                         // TABLES_BYTE_ORDER in the byte order of the writer
+    char scheme[32];                             // CRYPTO_ALGNAME
+    uint32_t w2, w3;
+    uint32_t num_tables;
+    uint32_t reserved;
+    uint64_t bytes;                              // Size of the store
+    uint64_t checksum;                           // FNV-1a over the 64-bit words of the store, taking this field as zero
+} tables_store_header;
+
+typedef struct {
+    uint32_t id;                                 // Position in table_entries
+    uint32_t reserved;
+    uint64_t offset;
+    uint64_t bytes;
+} tables_store_entry;
+
+#define TABLES_STORE_PREFIX_BYTES    ((sizeof(tables_store_header) + NUM_TABLE_ENTRIES*sizeof(tables_store_entry) + CACHE_LINE_BYTES - 1) & ~(size_t)(CACHE_LINE_BYTES - 1))
+
+
+static size_t tables_store_prefix(unsigned char *prefix)
+{ // Header (with a zero checksum) and directory of the store. Returns the size of the store.
+    tables_store_header *header = (tables_store_header*)prefix;
+    tables_store_entry *dir = (tables_store_entry*)(prefix + sizeof(tables_store_header));
+    size_t pos = TABLES_STORE_PREFIX_BYTES;
+
+    memset(prefix, 0, TABLES_STORE_PREFIX_BYTES);
+    for (unsigned int i = 0; i < NUM_TABLE_ENTRIES; i++) {
+        dir[i].id = i;
+        dir[i].offset = pos;
+        dir[i].bytes = table_entries[i].bytes;
+        pos = align_up(pos + table_entries[i].bytes, CACHE_LINE_BYTES);
+    }
+    memcpy(header->magic, TABLES_STORE_MAGIC, sizeof(TABLES_STORE_MAGIC));
+    header->version = TABLES_STORE_VERSION;
+    header->byte_order = TABLES_BYTE_ORDER;
+    strncpy(header->scheme, CRYPTO_ALGNAME, sizeof(header->scheme) - 1);
+    header->w2 = W_2;
+    header->w3 = W_3;
+    header->num_tables = NUM_TABLE_ENTRIES;
+    header->bytes = pos;
+    return pos;
+}
+
+
+static uint64_t tables_store_checksum(const unsigned char *store, size_t bytes)
+{
+    const uint64_t *w = (const uint64_t*)store;
+    const size_t skip = offsetof(tables_store_header, checksum)/sizeof(uint64_t);
+    uint64_t h = 0xCBF29CE484222325ULL;
+
+    for (size_t i = 0; i < bytes/sizeof(uint64_t); i++) {
+        h ^= (i == skip) ? 0 : w[i];
+        h *= 0x100000001B3ULL;
+    }
+    return h;
+}
+
+
+static int tables_store_write(const char *path, const compression_tables *tables)
+{ // Write the tables to a store. It is created under a temporary name and then renamed, so that readers never see a partial store.
+  // Returns 0 on success.
+    CACHE_ALIGN unsigned char prefix[TABLES_STORE_PREFIX_BYTES];
+    unsigned char *image = NULL;
+    const tables_store_entry *dir = (const tables_store_entry*)(prefix + sizeof(tables_store_header));
+    size_t bytes = tables_store_prefix(prefix), done = 0;
+    char *tmp = NULL;
+    int fd, status = 1;
+
+    image = (unsigned char*)calloc(bytes, 1);
+    tmp = (char*)malloc(strlen(path) + 8);
+    if (image == NULL || tmp == NULL) goto cleanup;
+
+    memcpy(image, prefix, sizeof(prefix));
+    for (unsigned int i = 0; i < NUM_TABLE_ENTRIES; i++) {
+        const uint64_t *src = (const uint64_t*)TABLE_PTR(tables, i);
+        if (tables->tate2_stride != 3 && (table_entries[i].field == offsetof(compression_tables, T_tate2_P) ||
+                                          table_entries[i].field == offsetof(compression_tables, T_tate2_Q))) {
+            for (unsigned int k = 0; k < OALICE_BITS - 2; k++) {    // Interleaved by tables_hugepages()
+                memcpy(image + dir[i].offset + 3*k*NWORDS64_FIELD*sizeof(uint64_t), src + tables->tate2_stride*k*NWORDS64_FIELD,
+                       3*NWORDS64_FIELD*sizeof(uint64_t));
+            }
+        } else {
+            memcpy(image + dir[i].offset, src, table_entries[i].bytes);
+        }
+    }
+    ((tables_store_header*)image)->checksum = tables_store_checksum(image, bytes);
+
+    strcpy(tmp, path);
+    strcat(tmp, ".XXXXXX");
+    fd = mkstemp(tmp);
+    if (fd < 0) goto cleanup;
+    while (done < bytes) {
+        ssize_t n = write(fd, image + done, bytes - done);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        done += (size_t)n;
+    }
+    if (done == bytes && fchmod(fd, 0644) == 0) status = 0;
+    if (close(fd) != 0) status = 1;
+    if (status == 0 && rename(tmp, path) != 0) status = 1;
+    if (status != 0) unlink(tmp);
+
+cleanup:
+    free(image);
+    free(tmp);
+    return status;
+}
+
+
+static int tables_store_map(const char *path, compression_tables *tables)
+{ // Map a table store read-only and shared, and point the tables to it. Returns 0 on success, 1 if the store is missing or damaged, or
+  // if it was written by a different library variant, window sizes or byte order.
+    CACHE_ALIGN unsigned char prefix[TABLES_STORE_PREFIX_BYTES];
+    const tables_store_entry *dir = (const tables_store_entry*)(prefix + sizeof(tables_store_header));
+    size_t bytes = tables_store_prefix(prefix);
+    const unsigned char *map;
+    struct stat st;
+    int fd;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0) return 1;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size != bytes) {
+        close(fd);
+        return 1;
+    }
+    map = (const unsigned char*)mmap(NULL, bytes, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return 1;
+
+    if (memcmp(map, prefix, offsetof(tables_store_header, checksum)) != 0 ||
+        memcmp(map + sizeof(tables_store_header), dir, NUM_TABLE_ENTRIES*sizeof(tables_store_entry)) != 0 ||
+        ((const tables_store_header*)map)->checksum != tables_store_checksum(map, bytes)) {
+        munmap((void*)map, bytes);
+        return 1;
+    }
+    for (unsigned int i = 0; i < NUM_TABLE_ENTRIES; i++) {
+        TABLE_PTR(tables, i) = map + dir[i].offset;
+    }
+    tables->tate2_stride = 3;
+    tables->file_map = (void*)map;
+    tables->file_bytes = bytes;
+    return 0;
+}
+
+#endif
+
+
+#if defined(_RUNTIME_TABLES_)
+static const char *tables_cache_path = NULL;
+static int tables_status = 1;
+#if defined(__NIX__)
+static pthread_once_t tables_once = PTHREAD_ONCE_INIT;
+#else
+static int tables_done = 0;
+#endif
+
+
+static void tables_init_once(void)
+{
+    if (comp_tables.file_map != NULL) {          // Mapped by tables_map()
+        tables_status = 0;
+        return;
+    }
+#if defined(__NIX__)
+    if (tables_cache_path != NULL && tables_store_map(tables_cache_path, &comp_tables) == 0) {
+        tables_status = 0;
+        return;
+    }
+#endif
+    tables_status = tables_generate();
+#if defined(__NIX__)
+    if (tables_status == 0 && tables_cache_path != NULL) {
+        tables_store_write(tables_cache_path, &comp_tables);    // If the store cannot be written, the next start-up computes the tables again
+    }
+#endif
+}
+#endif
+
+
+static inline void tables_ensure(void)
+{ // With runtime tables, compute them on first use unless tables_init() was called before
+#if defined(_RUNTIME_TABLES_)
+#if defined(__NIX__)
+    pthread_once(&tables_once, tables_init_once);
+#else
+    if (tables_done == 0) {
+        tables_init_once();
+        tables_done = 1;
+    }
+#endif
+#endif
+}
+
+
+int tables_init(const char *cache_path)
+{ // Set up the pairing and Pohlig-Hellman tables. With runtime tables (RUNTIME_TABLES=TRUE), they are mapped from the table store cache_path if it
+  // holds the tables of this library variant, or otherwise computed and written to cache_path for the next start-up (POSIX only). cache_path
+  // can be NULL. Only the first call has an effect, and without it the tables are computed on first use. With compiled tables, this function
+  // does nothing. Returns 0 on success.
+#if defined(_RUNTIME_TABLES_)
+    tables_cache_path = cache_path;
+    tables_ensure();
+    return tables_status;
+#else
+    UNREFERENCED_PARAMETER(cache_path);
+    return 0;
+#endif
+}
+
+
+int tables_map(const char *path)
+{ // Read all the precomputed tables of compression from the table store "path", which is mapped read-only and shared, so that the processes
+  // using the same store share a single copy of the tables. The store is written by tables_write() ("make tables_store_pXXX") or tables_init().
+  // It must be called before the library is used by any thread (POSIX only). Returns 0 on success, 1 if the file is missing or damaged,
+  // or if it was written for another library variant, other window sizes W_2 and W_3 or another byte order. The store replaces a copy of
+  // the tables made by tables_hugepages(), which is released.
+#if defined(__NIX__)
+    compression_tables tables = comp_tables;
+
+    if (comp_tables.file_map != NULL) return 0;
+    if (tables_store_map(path, &tables) != 0) return 1;
+    if (tables.region != NULL) {
+        munmap(tables.region, tables.region_bytes);
+        tables.region = NULL;
+        tables.region_bytes = 0;
+    }
+    comp_tables = tables;
+    return 0;
+#else
+    UNREFERENCED_PARAMETER(path);
+    return 1;
+#endif
+}
+
+
+int tables_write(const char *path)
+{ // Write the precomputed tables of compression to the table store "path", to be mapped by tables_map() (POSIX only). With runtime tables,
+  // they are computed first if needed. Returns 0 on success.
+#if defined(__NIX__)
+    tables_ensure();
+    return tables_store_write(path, &comp_tables);
+#else
+    UNREFERENCED_PARAMETER(path);
+    return 1;
+#endif
+}
+
+
+int tables_hugepages(void)
+{ // Copy the pairing and Pohlig-Hellman tables to memory backed by huge pages, each table aligned to a cache line and with T_tate2_P
+  // and T_tate2_Q interleaved step by step, and use the copy for all subsequent computations. This reduces TLB misses when the tables
+  // are cold. It must be called before the library is used by any thread. Returns 0 on success, 1 if huge pages are not available.
+#if defined(__linux__)
+    const size_t felm_bytes = NWORDS64_FIELD*sizeof(uint64_t);
+    size_t nbytes = 0;
+    unsigned char *region, *p;
+
+    tables_ensure();
+    if (comp_tables.region != NULL) return 0;
+    for (unsigned int i = 0; i < NUM_TABLE_ENTRIES; i++) {
+        nbytes += hugepages_slot_bytes(i);
+    }
+    nbytes = align_up(nbytes, HUGEPAGE_BYTES);
+    region = (unsigned char*)map_hugepages(nbytes);
+    if (region == NULL) return 1;
+
+    p = region;
+    for (unsigned int i = 0; i < NUM_TABLE_ENTRIES; i++) {
+        if (table_entries[i].field == offsetof(compression_tables, T_tate2_P)) {
+            const uint64_t *TP = (const uint64_t*)comp_tables.T_tate2_P, *TQ = (const uint64_t*)comp_tables.T_tate2_Q;
+            uint64_t *tate2 = (uint64_t*)p;
+            for (unsigned int k = 0; k < OALICE_BITS - 2; k++) {
+                memcpy(tate2 + 6*k*NWORDS64_FIELD, TP + 3*k*NWORDS64_FIELD, 3*felm_bytes);
+                memcpy(tate2 + (6*k + 3)*NWORDS64_FIELD, TQ + 3*k*NWORDS64_FIELD, 3*felm_bytes);
+            }
+            comp_tables.T_tate2_P = tate2;
+            comp_tables.T_tate2_Q = tate2 + 3*NWORDS64_FIELD;
+        } else if (table_entries[i].field != offsetof(compression_tables, T_tate2_Q)) {
+            memcpy(p, TABLE_PTR(&comp_tables, i), table_entries[i].bytes);
+            TABLE_PTR(&comp_tables, i) = p;
+        }
+        p += hugepages_slot_bytes(i);
+    }
+
+    mprotect(region, nbytes, PROT_READ);
+    comp_tables.tate2_stride = 6;
+    comp_tables.region = region;
+    comp_tables.region_bytes = nbytes;
+    return 0;
+#else
+    return 1;
+#endif
+}
@@ -0,0 +1,477 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/PQCrypto-SIDH
+* Released under MIT license
+*
+* Abstract: computation of the pairing and Pohlig-Hellman tables for compression from the
+*           torsion bases of the starting curve
+*********************************************************************************************/
+
+#include <stdlib.h>
+
+
+/******************************* Pairing tables *******************************/
+
+static void dbl_affine(const f2elm_t x, const f2elm_t y, const f2elm_t a, f2elm_t l, f2elm_t x2, f2elm_t y2)
+{ // Doubling on y^2 = x^3 + a*x + b. Output: the slope l of the tangent at (x,y) and (x2,y2) = 2*(x,y)
+    f2elm_t t0, t1;
+
+    fp2sqr_mont(x, t0);
+    fp2add(t0, t0, t1);
+    fp2add(t0, t1, t0);
+    fp2add(t0, a, t0);                            // t0 = 3*x^2 + a
+    fp2add(y, y, t1);
+    fp2inv_mont_bingcd(t1);
+    fp2mul_mont(t0, t1, l);                       // l = (3*x^2 + a)/(2*y)
+    fp2sqr_mont(l, t0);
+    fp2sub(t0, x, t0);
+    fp2sub(t0, x, t0);                            // x2 = l^2 - 2*x
+    fp2sub(x, t0, t1);
+    fp2mul_mont(l, t1, t1);
+    fp2sub(t1, y, y2);                            // y2 = l*(x - x2) - y
+    fp2copy(t0, x2);
+}
+
+
+static void add_affine(const f2elm_t x1, const f2elm_t y1, const f2elm_t x2, const f2elm_t y2, f2elm_t l, f2elm_t x3, f2elm_t y3)
+{ // Addition of two different points. Output: the slope l of the line through them and (x3,y3) = (x1,y1) + (x2,y2)
+    f2elm_t t0, t1;
+
+    fp2sub(x2, x1, t1);
+    fp2inv_mont_bingcd(t1);
+    fp2sub(y2, y1, t0);
+    fp2mul_mont(t0, t1, l);                       // l = (y2 - y1)/(x2 - x1)
+    fp2sqr_mont(l, t0);
+    fp2sub(t0, x1, t0);
+    fp2sub(t0, x2, t0);                           // x3 = l^2 - x1 - x2
+    fp2sub(x1, t0, t1);
+    fp2mul_mont(l, t1, t1);
+    fp2sub(t1, y1, y3);                           // y3 = l*(x1 - x3) - y1
+    fp2copy(t0, x3);
+}
+
+
+static void line_eval(const f2elm_t l, const f2elm_t x, const f2elm_t y, const f2elm_t xQ, const f2elm_t yQ, f2elm_t g)
+{ // g = l*(xQ - x) - (yQ - y)
+    f2elm_t t0;
+
+    fp2sub(xQ, x, t0);
+    fp2mul_mont(l, t0, g);
+    fp2sub(g, yQ, g);
+    fp2add(g, y, g);
+}
+
+
+static void store_felm(const felm_t a, uint64_t *T, unsigned int i)
+{
+    felm_t t;
+
+    fpcopy(a, t);
+    fpcorrection(t);
+    fpcopy(t, ((felm_t*)T)[i]);
+}
+
+
+static void tate2_chain(const point_t P, int twisted, const point_t Q, uint64_t *T_firststep, uint64_t *T, f2elm_t f)
+{ // Doublings of P on y^2 = x^3 - 11x + 14, which is the curve used by Tate2_pairings. The multiples 2^k*P, k > 0, are either in E(Fp) or,
+  // if "twisted" is set, of the form (x, i*y) with x, y in Fp; the tables store x, y and the real slope l of the line l*(x - xQ) + (y - yQ).
+  // If Q is not NULL, f = f_{2^eA,P}(Q) up to a factor in Fp, which the final exponentiation of the reduced Tate pairing cancels.
+    f2elm_t a = {0}, x, y, l, x2, y2, g, h, v = {0};
+    unsigned int k;
+
+    fpcopy((digit_t*)&Montgomery_one, v[0]);
+    for (k = 0; k < 11; k++) fpsub(a[0], v[0], a[0]);
+    fpcopy(v[0], f[0]);
+    fpzero(f[1]);
+
+    // First step, from P with coordinates in Fp2
+    fp2copy(P->x, x);
+    fp2copy(P->y, y);
+    dbl_affine(x, y, a, l, x2, y2);
+    store_felm(x2[0], T_firststep, 0);
+    store_felm(twisted ? y2[1] : y2[0], T_firststep, 1);
+    store_felm(l[0], T_firststep, 2);
+    store_felm(l[1], T_firststep, 3);
+    if (Q != NULL) {
+        line_eval(l, x, y, Q->x, Q->y, g);
+        fp2sub(Q->x, x2, h);
+        fp2_conj(h, h);                           // 1/(xQ - x2) up to a factor in Fp
+        fp2mul_mont(g, h, f);
+    }
+    fp2copy(x2, x);
+    fp2copy(y2, y);
+
+    for (k = 0; k < OALICE_BITS - 2; k++) {
+        dbl_affine(x, y, a, l, x2, y2);
+        store_felm(x2[0], T, 3*k + 0);
+        if (twisted) {
+            store_felm(y2[1], T, 3*k + 1);
+            fpcopy(l[1], v[0]);
+            fpneg(v[0]);                          // l = -i*v[0]
+            store_felm(v[0], T, 3*k + 2);
+        } else {
+            store_felm(y2[0], T, 3*k + 1);
+            store_felm(l[0], T, 3*k + 2);
+        }
+        if (Q != NULL) {
+            line_eval(l, x, y, Q->x, Q->y, g);
+            fp2sub(Q->x, x2, h);
+            fp2_conj(h, h);
+            fp2sqr_mont(f, f);
+            fp2mul_mont(f, g, f);
+            fp2mul_mont(f, h, f);
+        }
+        fp2copy(x2, x);
+        fp2copy(y2, y);
+    }
+
+    // Last step, the tangent at the point of order 2 is vertical
+    if (Q != NULL) {
+        fp2sub(Q->x, x, g);
+        fp2sqr_mont(f, f);
+        fp2mul_mont(f, g, f);
+    }
+}
+
+
+static void tate3_chain(const point_t P, const point_t Q, uint64_t *T, f2elm_t f)
+{ // Triplings of P in E0(Fp), E0: y^2 = x^3 + x, in the format of T_tate3. Also f = f_{3^eB,P}(Q) up to a factor in Fp.
+    f2elm_t a = {0}, x, y, l1, l2, n, x2, y2, x3, y3, g, h;
+
+    fpcopy((digit_t*)&Montgomery_one, a[0]);
+    fp2copy(a, f);
+    fp2copy(P->x, x);
+    fp2copy(P->y, y);
+
+    for (unsigned int k = 0; k < OBOB_EXPON - 1; k++) {
+        dbl_affine(x, y, a, l1, x2, y2);
+        add_affine(x, y, x2, y2, l2, x3, y3);
+        store_felm(l1[0], T, 6*k + 0);
+        store_felm(l2[0], T, 6*k + 1);
+        fp2mul_mont(l1, x, n);
+        fp2sub(y, n, n);
+        store_felm(n[0], T, 6*k + 2);             // n1 = y - l1*x
+        fp2mul_mont(l2, x, n);
+        fp2sub(y, n, n);
+        store_felm(n[0], T, 6*k + 3);             // n2 = y - l2*x
+        fp2mul_mont(x2, x3, n);
+        store_felm(n[0], T, 6*k + 4);             // x2*x3
+        fp2add(x2, x3, n);
+        store_felm(n[0], T, 6*k + 5);             // x2 + x3
+
+        line_eval(l1, x, y, Q->x, Q->y, g);
+        line_eval(l2, x, y, Q->x, Q->y, h);
+        fp2mul_mont(g, h, g);
+        fp2sub(Q->x, x2, h);
+        fp2_conj(h, h);
+        fp2mul_mont(g, h, g);
+        fp2sub(Q->x, x3, h);
+        fp2_conj(h, h);
+        fp2mul_mont(g, h, g);
+        fp2sqr_mont(f, h);
+        fp2mul_mont(f, h, f);
+        fp2mul_mont(f, g, f);                     // f = f^3*g
+        fp2copy(x3, x);
+        fp2copy(y3, y);
+    }
+
+    // Last step, from the point of order 3 whose tangent has a triple contact
+    dbl_affine(x, y, a, l1, x2, y2);
+    store_felm(x[0], T, 6*(OBOB_EXPON - 1) + 0);
+    store_felm(y[0], T, 6*(OBOB_EXPON - 1) + 1);
+    store_felm(l1[0], T, 6*(OBOB_EXPON - 1) + 2);
+    store_felm(x2[0], T, 6*(OBOB_EXPON - 1) + 3);
+    line_eval(l1, x, y, Q->x, Q->y, g);
+    fp2sqr_mont(f, h);
+    fp2mul_mont(f, h, f);
+    fp2mul_mont(f, g, f);
+}
+
+
+static void pairing_tables(uint64_t *tate3, uint64_t *tate2_firststep_P, uint64_t *tate2_P, uint64_t *tate2_firststep_Q, uint64_t *tate2_Q, f2elm_t g2, f2elm_t g3)
+{ // Tables of Tate3_pairings and Tate2_pairings, and the generators g2 = e(PA,QA) and g3 = e(PB,QB) of the groups of the discrete logs,
+  // where (PA,QA) and (PB,QB) are the torsion bases A_basis_zero and B_basis_zero
+    point_t PA, QA, PB, QB;
+    f2elm_t f[1], finv[1];
+
+    fp2copy((felm_t*)A_basis_zero + 0, PA->x);
+    fp2copy((felm_t*)A_basis_zero + 2, PA->y);
+    fp2copy((felm_t*)A_basis_zero + 4, QA->x);
+    fp2copy((felm_t*)A_basis_zero + 6, QA->y);
+    fp2copy((felm_t*)B_basis_zero + 0, PB->x);
+    fp2copy((felm_t*)B_basis_zero + 2, PB->y);
+    fp2copy((felm_t*)B_basis_zero + 4, QB->x);
+    fp2copy((felm_t*)B_basis_zero + 6, QB->y);
+
+    tate2_chain(PA, 1, QA, tate2_firststep_P, tate2_P, f[0]);
+    final_exponentiation_2_torsion(f, 1, finv);
+    fp2copy(f[0], g2);
+    fp2correction(g2);
+    tate2_chain(QA, 0, NULL, tate2_firststep_Q, tate2_Q, f[0]);
+
+    tate3_chain(PB, QB, tate3, f[0]);
+    final_exponentiation_3_torsion(f, 1, finv);
+    fp2copy(f[0], g3);
+    fp2correction(g3);
+}
+
+
+/*************************** Pohlig-Hellman tables ****************************/
+
+static int optimal_path(unsigned int *P, int n, int p, int q)
+{ // Optimal Pohlig-Hellman strategy for n leaves: a left edge (exponentiation by ell^w) costs p, a right edge (table multiplication) costs q.
+  // P[z] is the number of leaves of the left subtree of a node with z leaves. Ties are resolved towards smaller left subtrees.
+    long long *C = (long long*)calloc(n + 1, sizeof(long long));
+
+    if (C == NULL) return 1;
+    P[0] = 0;
+    if (n >= 1) P[1] = 0;
+    for (int z = 2; z <= n; z++) {
+        C[z] = -1;
+        for (int t = 1; t < z; t++) {
+            long long c = C[t] + C[z - t] + (long long)(z - t)*p + (long long)t*q;
+            if (C[z] < 0 || c < C[z]) {
+                C[z] = c;
+                P[z] = t;
+            }
+        }
+    }
+    free(C);
+    return 0;
+}
+
+
+static void torus_mul(const felm_t *a, const felm_t *b, felm_t *c)
+{ // [x1:y1]*[x2:y2] = [x1*x2 - y1*y2 : x1*y2 + y1*x2]
+    felm_t t0, t1, t2;
+
+    fpmul_mont(a[0], b[0], t0);
+    fpmul_mont(a[1], b[1], t1);
+    fpsub(t0, t1, t2);
+    fpmul_mont(a[0], b[1], t0);
+    fpmul_mont(a[1], b[0], t1);
+    fpadd(t0, t1, c[1]);
+    fpcopy(t2, c[0]);
+}
+
+
+static int torus_to_alpha(const felm_t *a, felm_t alpha)
+{ // alpha = x/y. Returns 1 for the identity [1:0].
+    felm_t t;
+
+    fpcopy(a[1], t);
+    fpcorrection(t);
+    if (is_felm_zero(t)) return 1;
+    fpinv_mont(t);
+    fpmul_mont(a[0], t, alpha);
+    fpcorrection(alpha);
+    return 0;
+}
+
+
+static void torus_pow2(felm_t *a, int k)
+{
+    for (int i = 0; i < k; i++) sqr_Fp2_cycl_proj(a);
+}
+
+
+static void fp_sqrt(const felm_t a, felm_t r)
+{ // r = a^((p+1)/4) = a^(2^(eA-2)*3^eB)
+    felm_t t;
+
+    fpcopy(a, r);
+    for (int i = 0; i < OALICE_BITS - 2; i++) fpsqr_mont(r, r);
+    for (int i = 0; i < OBOB_EXPON; i++) {
+        fpsqr_mont(r, t);
+        fpmul_mont(r, t, r);
+    }
+    fpcorrection(r);
+}
+
+
+static int ph2_tables(const f2elm_t g2, int w, unsigned int *path, felm_t *CT, felm_t *Texp, int *Log, felm_t *G)
+{ // Tables for the binary Pohlig-Hellman in the torus with window size w: path (dlen+1 entries), CT (dlen*2^(w-1)), Texp (2^(w-3)-1),
+  // Log (2^(w-1)-1) and G (2^(w-2)), where dlen = eA/w. Returns 0 on success, 1 if w is not supported or memory is exhausted.
+    int w1 = w - 1, half = 1 << (w - 1), dlen = OALICE_BITS/w, nLog = (1 << w1) - 1, ncand = 0, status = 1;
+    felm_t g[2], b[2], acc[2], rho_w[2], rho[2], alpha, one, t0;
+    felm_t *rho_pow, *cand, *level, *next;
+    int *cand_idx, *G_set;
+
+    if (w < 4 || OALICE_BITS % w != 0) return 1;
+    rho_pow = (felm_t*)calloc(1 << w1, sizeof(felm_t));
+    cand = (felm_t*)calloc(nLog, sizeof(felm_t));
+    level = (felm_t*)calloc(1 << w1, sizeof(felm_t));
+    next = (felm_t*)calloc(1 << w1, sizeof(felm_t));
+    cand_idx = (int*)calloc(nLog, sizeof(int));
+    G_set = (int*)calloc(1 << (w - 2), sizeof(int));
+    if (rho_pow == NULL || cand == NULL || level == NULL || next == NULL || cand_idx == NULL || G_set == NULL) goto cleanup;
+
+    // Cost of a left edge: w cyclotomic squarings (2 multiplications each), right edge: one mixed multiplication (3 units)
+    if (optimal_path(path, dlen, 2*w, 3) != 0) goto cleanup;
+
+    // g = [g2_0 + 1 : g2_1] (see toproj) and b = g^-1
+    fpcopy((digit_t*)&Montgomery_one, one);
+    fpadd(g2[0], one, g[0]);
+    fpcopy(g2[1], g[1]);
+    fpcopy(g[0], b[0]);
+    fpcopy(g[1], b[1]);
+    fpneg(b[1]);
+
+    // CT[i*2^(w-1) + t-1] = g^(-t*2^(w*i))
+    for (int i = 0; i < dlen; i++) {
+        fp2copy(b, acc);
+        for (int t = 1; t <= half; t++) {
+            torus_to_alpha(acc, CT[i*half + t - 1]);
+            torus_mul(acc, b, acc);
+        }
+        torus_pow2(b, w);
+    }
+
+    // rho_w = g^(2^(eA-w)) generates the leaves, rho = rho_w^2 is the generator used by the Log table
+    fp2copy(g, rho_w);
+    torus_pow2(rho_w, OALICE_BITS - w);
+    fp2copy(rho_w, rho);
+    torus_pow2(rho, 1);
+    fp2copy(rho, acc);
+    for (int d = 1; d < (1 << w1); d++) {
+        torus_to_alpha(acc, rho_pow[d]);
+        torus_mul(acc, rho, acc);
+    }
+
+    // Candidates of ord2w_dlog: 0 = -1, 1 = i, -1 = -i, then alpha +/- sqrt(1 + alpha^2) for each level
+    memset(cand[0], 0, sizeof(felm_t)); cand_idx[ncand++] = 0;
+    fpcopy(one, cand[1]); cand_idx[ncand++] = 1;
+    fpcopy(one, cand[2]); fpneg(cand[2]); fpcorrection(cand[2]); cand_idx[ncand++] = 2;
+    fpcopy(one, level[0]);
+    for (int j = 2; j < w1; j++) {
+        for (int m = 0; m < (1 << (j - 2)); m++) {
+            felm_t *T = &Texp[(1 << (j - 2)) + m - 1];
+            fpsqr_mont(level[m], t0);
+            fpadd(t0, one, t0);
+            fp_sqrt(t0, *T);
+            fpadd(level[m], *T, next[2*m]);
+            fpsub(level[m], *T, next[2*m + 1]);
+            fpcorrection(next[2*m]);
+            fpcorrection(next[2*m + 1]);
+        }
+        for (int i = 0; i < (1 << (j - 1)); i++) {
+            fpcopy(next[i], cand[ncand]);
+            cand_idx[ncand++] = (1 << j) + i - 1;
+            fpcopy(next[i], cand[ncand]);
+            fpneg(cand[ncand]);
+            fpcorrection(cand[ncand]);
+            cand_idx[ncand++] = (1 << (j + 1)) - i - 2;
+        }
+        memcpy(level, next, (1 << (j - 1))*sizeof(felm_t));
+    }
+    for (int c = 0; c < ncand; c++) {
+        int d;
+        for (d = 1; d < (1 << w1); d++) {
+            if (memcmp(rho_pow[d], cand[c], sizeof(felm_t)) == 0) break;
+        }
+        if (d == (1 << w1)) goto cleanup;         // Not a power of rho, g2 does not have order 2^eA
+        Log[cand_idx[c]] = (d > (1 << (w1 - 1))) ? d - (1 << w1) : d;
+    }
+
+    // G[index] = rho_w^d', with the index and d' derived from d = log(h^2) as in ord2w_dloghyb
+    for (int d = 1; d < (1 << w1); d++) {
+        int t = highest_t(d), ord = w1 - t, tmp = ((d >> t) - 1) >> 1, i_j = reverse_bits(tmp, ord - 1), dd = d, index;
+        if (ord >= 2 && i_j >= (1 << (ord - 2))) {
+            i_j = (1 << (ord - 1)) - i_j - 1;
+            dd = (1 << w1) - d;
+        }
+        index = (ord < 2) ? 0 : (1 << (ord - 2)) + i_j;
+        fp2copy(rho_w, acc);
+        for (int k = 1; k < dd; k++) torus_mul(acc, rho_w, acc);
+        torus_to_alpha(acc, alpha);
+        if (G_set[index] && memcmp(G[index], alpha, sizeof(felm_t)) != 0) goto cleanup;
+        fpcopy(alpha, G[index]);
+        G_set[index] = 1;
+    }
+    status = 0;
+
+cleanup:
+    free(rho_pow);
+    free(cand);
+    free(level);
+    free(next);
+    free(cand_idx);
+    free(G_set);
+    return status;
+}
+
+
+static void cycl_pow3(f2elm_t a, int k)
+{
+    for (int i = 0; i < k; i++) cube_Fp2_cycl(a, (digit_t*)&Montgomery_one);
+}
+
+
+static void ph3_row(f2elm_t *row, const f2elm_t b, int n)
+{ // row[t-1] = b^t
+    f2elm_t acc;
+
+    fp2copy(b, acc);
+    for (int t = 1; t <= n; t++) {
+        fp2copy(acc, row[t - 1]);
+        fp2correction(row[t - 1]);
+        fp2mul_mont(acc, b, acc);
+    }
+}
+
+
+static int ph3_tables(const f2elm_t g3, int w, unsigned int *path, f2elm_t *T1, f2elm_t *T2)
+{ // Tables for the ternary Pohlig-Hellman with signed digits and window size w: path (dlen+1 entries) and T1 (dlen*(3^w-1)/2),
+  // where dlen = ceil(eB/w). If w does not divide eB, T2 is filled in as well, otherwise it is not used and can be NULL.
+  // Returns 0 on success, 1 if w is not supported or memory is exhausted.
+    int emod = OBOB_EXPON % w, half = 1, dlen = (OBOB_EXPON + w - 1)/w;
+    f2elm_t b, bprev = {0}, b2;
+
+    if (w < 1 || w > 8) return 1;
+    for (int i = 0; i < w; i++) half *= 3;
+    half >>= 1;
+
+    // Cost of a left edge: w cyclotomic cubings, right edge: one multiplication
+    if (optimal_path(path, dlen, w, 1) != 0) return 1;
+
+    // b = g^-1
+    fp2_conj(g3, b);
+
+    // T1[i*half + t-1] = g^(-t*3^(w*i)), and if w does not divide eB, T2[i*half + t-1] = g^(-t*3^(w*i + e mod w - w)) for i > 0,
+    // T2 = T1 on the first row
+    for (int i = 0; i < dlen; i++) {
+        ph3_row(&T1[i*half], b, half);
+        if (emod != 0) {
+            if (i == 0) {
+                ph3_row(&T2[0], b, half);
+            } else {
+                fp2copy(bprev, b2);
+                cycl_pow3(b2, emod);
+                ph3_row(&T2[i*half], b2, half);
+            }
+        }
+        fp2copy(b, bprev);
+        cycl_pow3(b, w);
+    }
+    return 0;
+}
+
+
+#if defined(_RUNTIME_TABLES_)
+
+static int tables_generate(void)
+{ // Compute the tables of tables.c for the window sizes W_2 and W_3. Returns 0 on success.
+    f2elm_t g2, g3;
+
+    pairing_tables(T_tate3, T_tate2_firststep_P, T_tate2_P, T_tate2_firststep_Q, T_tate2_Q, g2, g3);
+    if (ph2_tables(g2, W_2, ph2_path, (felm_t*)ph2_CT, (felm_t*)ph2_Texp, ph2_Log, (felm_t*)ph2_G) != 0) return 1;
+#if (OBOB_EXPON % W_3 == 0)
+    return ph3_tables(g3, W_3, ph3_path, (f2elm_t*)ph3_T, NULL);
+#else
+    return ph3_tables(g3, W_3, ph3_path, (f2elm_t*)ph3_T1, (f2elm_t*)ph3_T2);
+#endif
+}
+
+#endif
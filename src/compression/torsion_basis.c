@@ -13,12 +13,35 @@
 #define DECOMPRESSION 1
 
 
-static void Elligator2(const f2elm_t a24, const unsigned int r, f2elm_t x, unsigned char *bit, const unsigned char COMPorDEC)
-{ // Generate an x-coordinate of a point on curve with (affine) coefficient a24 
-  // Use a precomputed Elligator table of size TABLE_V3_LEN and switch to online computations if table runs out of elements.
+// Scratch arrays of the torsion basis generation, kept on the stack or in a workspace of the caller (*_ws functions)
+typedef struct {
+    point_proj_t pts[3];     // Entangled x-only basis of BuildOrdinary2nBasis_dual
+    f2elm_t xs[2], zs[2];    // Elligator2 outputs of the two basis points
+    f2elm_t t[2], tinv[2];   // Values and inverses of the n-way inversions
+    f2elm_t gX[2], gZ[2];    // Pairings of the first basis point with the 3-torsion generators
+} basis_scratch_t;
+
+
+static void rhs_proj(const f2elm_t A, const f2elm_t X, const f2elm_t Z, f2elm_t t)
+{ // t = X*(X^2 + A*X*Z + Z^2)*Z = (x^3 + A*x^2 + x)*Z^4 for x = X/Z, so t is a square iff x^3 + A*x^2 + x is
+    f2elm_t t0;
+
+    fp2mul_mont(A, Z, t0);
+    fp2add(X, t0, t0);
+    fp2mul_mont(X, t0, t0);       // t0 = X^2 + A*X*Z
+    fp2sqr_mont(Z, t);
+    fp2add(t0, t, t0);            // t0 = X^2 + A*X*Z + Z^2
+    fp2mul_mont(X, Z, t);
+    fp2mul_mont(t, t0, t);
+}
+
+
+static void Elligator2(const f2elm_t a24, const unsigned int r, f2elm_t x, f2elm_t z, unsigned char *bit, const unsigned char COMPorDEC)
+{ // Generate the x-coordinate x/z of a point on curve with (affine) coefficient a24 
+  // Use a precomputed Elligator table of size TABLE_V3_LEN, which gives z = 1, and switch to online computations if table runs out of elements.
+  // Online, x/z = -A/(1 + U*r^2) is left projective so that the candidates need no inversion (see Elligator2_affine).
   // Use the counter r
-    int i;
-    felm_t one_fp, a2, b2, N, temp0, temp1, rmonty = {0}, *U;
+    felm_t one_fp, rmonty = {0}, *U;
     f2elm_t A, y2, *t_ptr, v;
 
     fpcopy((digit_t*)&Montgomery_one, one_fp);
@@ -28,56 +51,61 @@ static void Elligator2(const f2elm_t a24, const unsigned int r, f2elm_t x, unsig
 
     // Elligator computation    
     if (r < TABLE_V3_LEN) {
-        t_ptr = (f2elm_t *)&v_3_torsion[r];    
+        t_ptr = (f2elm_t *)comp_tables.v_3_torsion + r;    
         fp2copy((felm_t*)t_ptr, v);
-    } else { // Compute v = 1/(1+U*r^2)
+        fp2mul_mont(A, v, x);                 // x = A*v; v := 1/(1 + U*r^2) table lookup
+        fp2zero(z);
+        fpcopy(one_fp, z[0]);
+    } else { // Compute z = 1+U*r^2
         U = (felm_t *)U3;
         rmonty[0] = r;
         to_mont(rmonty, rmonty);
         fpsqr_mont(rmonty, rmonty);
-        fpmul_mont(U[0], rmonty, v[0]);
-        fpmul_mont(U[1], rmonty, v[1]);
-        fpadd(v[0], (digit_t*)&Montgomery_one, v[0]);
-        fp2inv_mont_bingcd(v);
+        fpmul_mont(U[0], rmonty, z[0]);
+        fpmul_mont(U[1], rmonty, z[1]);
+        fpadd(z[0], one_fp, z[0]);
+        fp2copy(A, x);
     }
-    fp2mul_mont(A, v, x);     // x = A*v; v := 1/(1 + U*r^2) table lookup
-    fp2neg(x);                // x = -A*v;
+    fp2neg(x);                // x/z = -A*v;
     
     if (COMPorDEC == COMPRESSION) {
-        fp2add(A, x, y2);                      // y2 = x + A
-        fp2mul_mont(y2,  x,  y2);              // y2 = x*(x + A)
-        fpadd(y2[0],  one_fp,  y2[0]);         // y2 = x(x + A) + 1
-        fp2mul_mont(x, y2, y2);                // y2 = x*(x^2 + Ax + 1);
-        fpsqr_mont(y2[0], a2);
-        fpsqr_mont(y2[1], b2);
-        fpadd(a2, b2, N);                      // N := norm(y2);
-
-        fpcopy(N, temp0);
-        for (i = 0; i < OALICE_BITS - 2; i++) {    
-            fpsqr_mont(temp0,  temp0);
-        }
-        for (i = 0; i < OBOB_EXPON; i++) {
-            fpsqr_mont(temp0,  temp1);
-            fpmul_mont(temp0,  temp1,  temp0);
-        }
-        fpsqr_mont(temp0, temp1);              // z = N^((p + 1) div 4);
-        fpcorrection(temp1);
-        fpcorrection(N);
-        if (memcmp(temp1, N, NBITS_TO_NBYTES(NBITS_FIELD)) != 0) {
+        rhs_proj(A, x, z, y2);
+        if (!is_sqr_fp2(y2, v[0])) {
+            fp2mul_mont(A, z, v);
             fp2neg(x);
-            fp2sub(x, A, x);                   // x = -x - A;
-            if (COMPorDEC == COMPRESSION)
-                *bit = 1;        
+            fp2sub(x, v, x);                   // x/z = -x/z - A;
+            *bit = 1;        
         }
     } else {
         if (*bit) {
+            fp2mul_mont(A, z, v);
             fp2neg(x);
-            fp2sub(x,A,x);                              // x = -x - A;
+            fp2sub(x, v, x);                   // x/z = -x/z - A;
         }       
     }
 }
 
 
+static void Elligator2_affine(basis_scratch_t *s, const unsigned int *r, const unsigned int n)
+{ // Make the n <= 2 outputs s->xs[i]/s->zs[i] of Elligator2 with counters r[i] affine. Only the counters beyond the table have
+  // s->zs[i] != 1, and these share a single inversion
+    unsigned int i, m = 0;
+
+    for (i = 0; i < n; i++) {
+        if (r[i] >= TABLE_V3_LEN)
+            fp2copy(s->zs[i], s->t[m++]);
+    }
+    if (m == 0)
+        return;
+
+    mont_n_way_inv((const f2elm_t*)s->t, m, s->tinv);
+    for (i = 0, m = 0; i < n; i++) {
+        if (r[i] >= TABLE_V3_LEN)
+            fp2mul_mont(s->xs[i], s->tinv[m++], s->xs[i]);
+    }
+}
+
+
 static void TripleAndParabola_proj(const point_full_proj_t R, f2elm_t l1x, f2elm_t l1z)
 {
     fp2sqr_mont(R->X, l1z);
@@ -101,45 +129,28 @@ static void Tate3_proj(const point_full_proj_t P, const point_full_proj_t Q, f2e
 }
 
 
-static void FinalExpo3_2way(f2elm_t *gX, f2elm_t *gZ)
-{
+static void FinalExpo3_nway(f2elm_t *gX, f2elm_t *gZ, const unsigned int n, basis_scratch_t *s)
+{ // Final exponentiation of n <= 2 projective values gX/gZ to the power (p^2-1)/3, sharing one inversion.
+  // After the power p-1 the values have norm 1, so the cyclotomic squarings and cubings apply.
     unsigned int i, j;
-    f2elm_t f_[2], finv[2];
 
-    for(i = 0; i < 2; i++) {
-        fp2copy(gZ[i], f_[i]);
-        fpneg(f_[i][1]);    // Conjugate
-        fp2mul_mont(gX[i], f_[i], f_[i]);
+    for(i = 0; i < n; i++) {
+        fp2copy(gZ[i], s->t[i]);
+        fpneg(s->t[i][1]);    // Conjugate
+        fp2mul_mont(gX[i], s->t[i], s->t[i]);
     }
-    mont_n_way_inv(f_,2,finv);
-    for(i = 0; i < 2; i++) {
+    mont_n_way_inv((const f2elm_t*)s->t,n,s->tinv);
+    for(i = 0; i < n; i++) {
         fpneg(gX[i][1]);
         fp2mul_mont(gX[i], gZ[i], gX[i]);
-        fp2mul_mont(gX[i], finv[i], gX[i]);
-        for(j = 0; j < OALICE_BITS; j++)
-            fp2sqr_mont(gX[i], gX[i]);
-        for(j = 0; j < OBOB_EXPON-1; j++)
-            cube_Fp2_cycl(gX[i], (digit_t*)&Montgomery_one);
+        fp2mul_mont(gX[i], s->tinv[i], gX[i]);
     }
-}
-
-
-static void FinalExpo3(f2elm_t gX, f2elm_t gZ)
-{
-    unsigned int i;
-    f2elm_t f_;
-
-    fp2copy(gZ, f_);
-    fpneg(f_[1]);
-    fp2mul_mont(gX, f_, f_);
-    fp2inv_mont_bingcd(f_);
-    fpneg(gX[1]);
-    fp2mul_mont(gX,gZ, gX);
-    fp2mul_mont(gX,f_, gX);
-    for(i = 0; i < OALICE_BITS; i++)
-        fp2sqr_mont(gX, gX);
-    for(i = 0; i < OBOB_EXPON-1; i++)
-        cube_Fp2_cycl(gX, (digit_t*)Montgomery_one);
+    for(j = 0; j < OALICE_BITS; j++)
+        for(i = 0; i < n; i++)
+            sqr_Fp2_cycl(gX[i], (digit_t*)&Montgomery_one);
+    for(j = 0; j < OBOB_EXPON-1; j++)
+        for(i = 0; i < n; i++)
+            cube_Fp2_cycl(gX[i], (digit_t*)&Montgomery_one);
 }
 
 
@@ -160,27 +171,27 @@ static void make_positive(f2elm_t x)
 }
 
 
-static bool FirstPoint_dual(const point_proj_t P, point_full_proj_t R, unsigned char *ind)
+static bool FirstPoint_dual(const point_proj_t P, point_full_proj_t R, unsigned char *ind, basis_scratch_t *s)
 {
     point_full_proj_t R3,S3;
-    f2elm_t gX[2],gZ[2];
+    f2elm_t *gX = s->gX, *gZ = s->gZ;
     felm_t zero = {0};
     unsigned long long nbytes = NBITS_TO_NBYTES(NBITS_FIELD);
     unsigned char alpha,beta;
 
-    fpcopy((digit_t*)B_gen_3_tors + 0*NWORDS_FIELD, (R3->X)[0]);
-    fpcopy((digit_t*)B_gen_3_tors + 1*NWORDS_FIELD, (R3->X)[1]);
-    fpcopy((digit_t*)B_gen_3_tors + 2*NWORDS_FIELD, (R3->Y)[0]);
-    fpcopy((digit_t*)B_gen_3_tors + 3*NWORDS_FIELD, (R3->Y)[1]);
-    fpcopy((digit_t*)B_gen_3_tors + 4*NWORDS_FIELD, (S3->X)[0]);
-    fpcopy((digit_t*)B_gen_3_tors + 5*NWORDS_FIELD, (S3->X)[1]);
-    fpcopy((digit_t*)B_gen_3_tors + 6*NWORDS_FIELD, (S3->Y)[0]);
-    fpcopy((digit_t*)B_gen_3_tors + 7*NWORDS_FIELD, (S3->Y)[1]);
+    fpcopy((digit_t*)comp_tables.B_gen_3_tors + 0*NWORDS_FIELD, (R3->X)[0]);
+    fpcopy((digit_t*)comp_tables.B_gen_3_tors + 1*NWORDS_FIELD, (R3->X)[1]);
+    fpcopy((digit_t*)comp_tables.B_gen_3_tors + 2*NWORDS_FIELD, (R3->Y)[0]);
+    fpcopy((digit_t*)comp_tables.B_gen_3_tors + 3*NWORDS_FIELD, (R3->Y)[1]);
+    fpcopy((digit_t*)comp_tables.B_gen_3_tors + 4*NWORDS_FIELD, (S3->X)[0]);
+    fpcopy((digit_t*)comp_tables.B_gen_3_tors + 5*NWORDS_FIELD, (S3->X)[1]);
+    fpcopy((digit_t*)comp_tables.B_gen_3_tors + 6*NWORDS_FIELD, (S3->Y)[0]);
+    fpcopy((digit_t*)comp_tables.B_gen_3_tors + 7*NWORDS_FIELD, (S3->Y)[1]);
 
     CompletePoint(P,R);
     Tate3_proj(R3,R,gX[0],gZ[0]);
     Tate3_proj(S3,R,gX[1],gZ[1]);
-    FinalExpo3_2way(gX,gZ);
+    FinalExpo3_nway(gX,gZ,2,s);
 
     // Do small DLog with respect to g_R3_S3
     fp2correction(gX[0]);
@@ -216,7 +227,7 @@ static bool FirstPoint_dual(const point_proj_t P, point_full_proj_t R, unsigned
 }
 
 
-static bool SecondPoint_dual(const point_proj_t P, point_full_proj_t R, unsigned char ind)
+static bool SecondPoint_dual(const point_proj_t P, point_full_proj_t R, unsigned char ind, basis_scratch_t *s)
 {
     point_full_proj_t RS3;
     f2elm_t gX, gZ;
@@ -224,14 +235,14 @@ static bool SecondPoint_dual(const point_proj_t P, point_full_proj_t R, unsigned
     unsigned long long nbytes = NBITS_TO_NBYTES(NBITS_FIELD);
 
     // Pair with 3-torsion point determined by first point
-    fpcopy((digit_t*)B_gen_3_tors + (4*ind + 0)*NWORDS_FIELD, (RS3->X)[0]);
-    fpcopy((digit_t*)B_gen_3_tors + (4*ind + 1)*NWORDS_FIELD, (RS3->X)[1]);
-    fpcopy((digit_t*)B_gen_3_tors + (4*ind + 2)*NWORDS_FIELD, (RS3->Y)[0]);
-    fpcopy((digit_t*)B_gen_3_tors + (4*ind + 3)*NWORDS_FIELD, (RS3->Y)[1]);
+    fpcopy((digit_t*)comp_tables.B_gen_3_tors + (4*ind + 0)*NWORDS_FIELD, (RS3->X)[0]);
+    fpcopy((digit_t*)comp_tables.B_gen_3_tors + (4*ind + 1)*NWORDS_FIELD, (RS3->X)[1]);
+    fpcopy((digit_t*)comp_tables.B_gen_3_tors + (4*ind + 2)*NWORDS_FIELD, (RS3->Y)[0]);
+    fpcopy((digit_t*)comp_tables.B_gen_3_tors + (4*ind + 3)*NWORDS_FIELD, (RS3->Y)[1]);
 
     CompletePoint(P, R);
     Tate3_proj(RS3, R, gX, gZ);
-    FinalExpo3(gX, gZ);
+    FinalExpo3_nway(&gX, &gZ, 1, s);
 
     fp2correction(gX);
     if (memcmp(gX[1], zero, (size_t)nbytes) != 0)    // Not equal to 1
@@ -241,44 +252,40 @@ static bool SecondPoint_dual(const point_proj_t P, point_full_proj_t R, unsigned
 }
 
 
-static void FirstPoint3n(const f2elm_t a24, const f2elm_t As[][5], f2elm_t x, point_full_proj_t R, unsigned int *r, unsigned char *ind, unsigned char *bitEll)
+static void FirstPoint3n(const f2elm_t a24, const f2elm_t As[][5], f2elm_t x, f2elm_t z, point_full_proj_t R, unsigned int *r, unsigned char *ind, unsigned char *bitEll, basis_scratch_t *s)
 {
     bool b = false;
     point_proj_t P;
-    felm_t zero = {0};
     *r = 0;    
 
     while (!b) {        
         *bitEll = 0;
-        Elligator2(a24, *r, x, bitEll, COMPRESSION);    // Get x-coordinate on curve a24
+        Elligator2(a24, *r, x, z, bitEll, COMPRESSION);    // Get x-coordinate on curve a24
 
         fp2copy(x, P->X);
-        fpcopy((digit_t*)&Montgomery_one, (P->Z)[0]);
-        fpcopy(zero, (P->Z)[1]);
+        fp2copy(z, P->Z);
         eval_full_dual_4_isog(As, P);    // Move x over to A = 0
 
-        b = FirstPoint_dual(P, R, ind);  // Compute DLog with 3-torsion points
+        b = FirstPoint_dual(P, R, ind, s);  // Compute DLog with 3-torsion points
         *r = *r + 1;
     }
 }
 
 
-static void SecondPoint3n(const f2elm_t a24, const f2elm_t As[][5], f2elm_t x, point_full_proj_t R, unsigned int *r, unsigned char ind, unsigned char *bitEll)
+static void SecondPoint3n(const f2elm_t a24, const f2elm_t As[][5], f2elm_t x, f2elm_t z, point_full_proj_t R, unsigned int *r, unsigned char ind, unsigned char *bitEll, basis_scratch_t *s)
 {
     bool b = false;
     point_proj_t P;
-    felm_t zero = {0};
 
     while (!b) {
         *bitEll = 0;
-        Elligator2(a24, *r, x, bitEll, COMPRESSION);
+        Elligator2(a24, *r, x, z, bitEll, COMPRESSION);
 
         fp2copy(x, P->X);
-        fpcopy((digit_t*)&Montgomery_one, (P->Z)[0]);
-        fpcopy(zero, (P->Z)[1]);
+        fp2copy(z, P->Z);
         eval_full_dual_4_isog(As, P);    // Move x over to A = 0
 
-        b = SecondPoint_dual(P, R, ind);
+        b = SecondPoint_dual(P, R, ind, s);
         *r = *r + 1;
     }
 }
@@ -346,54 +353,71 @@ static void BiQuad_affine(const f2elm_t a24, const f2elm_t x0, const f2elm_t x1,
 }
 
 
-static void BuildOrdinary3nBasis_dual(const f2elm_t a24, const f2elm_t As[][5], point_full_proj_t *R, unsigned int *r, unsigned int *bitsEll)
+static void BuildOrdinary3nBasis_dual(const f2elm_t a24, const f2elm_t As[][5], point_full_proj_t *R, unsigned int *r, unsigned int *bitsEll, basis_scratch_t *s)
 {
     point_proj_t D;
-    f2elm_t xs[2];
+    unsigned int rs[2];
     unsigned char ind, bit;
 
-    FirstPoint3n(a24, As, xs[0], R[0], r, &ind, &bit);
+    OPCOUNT_SCOPE(OPCOUNT_BASIS);
+    STATS_BEGIN(SIKE_PHASE_BASIS);
+    FirstPoint3n(a24, As, s->xs[0], s->zs[0], R[0], r, &ind, &bit, s);
     *bitsEll = (unsigned int)bit;
     *(r+1) = *r;
-    SecondPoint3n(a24, As, xs[1], R[1], r+1, ind, &bit);
+    SecondPoint3n(a24, As, s->xs[1], s->zs[1], R[1], r+1, ind, &bit, s);
     *bitsEll |= ((unsigned int)bit << 1);
 
+    rs[0] = r[0]-1;
+    rs[1] = r[1]-1;
+    Elligator2_affine(s, rs, 2);
+
     // Get x-coordinate of difference
-    BiQuad_affine(a24, xs[0], xs[1], D);
+    BiQuad_affine(a24, s->xs[0], s->xs[1], D);
     eval_full_dual_4_isog(As, D);    // Move x over to A = 0
     makeDiff(R[0], R[1], D);
+    STATS_END(SIKE_PHASE_BASIS);
 }
 
 
-static void BuildOrdinary3nBasis_Decomp_dual(const f2elm_t A24, point_proj_t *Rs, unsigned char *r, const unsigned char bitsEll)
+static void BuildOrdinary3nBasis_Decomp_dual(const f2elm_t A24, point_proj_t *Rs, unsigned char *r, const unsigned char bitsEll, basis_scratch_t *s)
 {
     unsigned char bitEll[2];
+    unsigned int rs[2];
     
+    OPCOUNT_SCOPE(OPCOUNT_BASIS);
+    STATS_BEGIN(SIKE_PHASE_BASIS);
     bitEll[0] = bitsEll & 0x1;
     bitEll[1] = (bitsEll >> 1) & 0x1;    
+    rs[0] = (unsigned int)r[0]-1;
+    rs[1] = (unsigned int)r[1]-1;
     
     // Elligator2 both x-coordinates
-    Elligator2(A24, (unsigned int)r[0]-1, Rs[0]->X, &bitEll[0], DECOMPRESSION);
-    Elligator2(A24, (unsigned int)r[1]-1, Rs[1]->X, &bitEll[1], DECOMPRESSION);
+    Elligator2(A24, rs[0], s->xs[0], s->zs[0], &bitEll[0], DECOMPRESSION);
+    Elligator2(A24, rs[1], s->xs[1], s->zs[1], &bitEll[1], DECOMPRESSION);
+    Elligator2_affine(s, rs, 2);
+    fp2copy(s->xs[0], Rs[0]->X);
+    fp2copy(s->xs[1], Rs[1]->X);
     // Get x-coordinate of difference
     BiQuad_affine(A24, Rs[0]->X, Rs[1]->X, Rs[2]);
+    STATS_END(SIKE_PHASE_BASIS);
 }
 
 
 static void get2mPointonEA(const f2elm_t A, f2elm_t x, felm_t r, f2elm_t t, unsigned char *vqnr, unsigned char *ind) 
 {// Given a Montgomery curve EA, find a point of order 2^m using precomputed tables of size TABLE_R_LEN and switch to online computations if table runs out of elements.
-    f2elm_t *tv_ptr, v, tmp;
+ // Online, the candidates x = -A/z with z = 1 + u*r^2 are tested projectively and only the one found is inverted.
+    f2elm_t *tv_ptr, v, z, tmp;
     felm_t *tr_ptr, *u;
 
     u = (felm_t *)u_entang;
     // Select the correct tables, i.e., if A is a QR then v must be QNR, and vice-versa
     if (is_sqr_fp2(A,  tmp[0])) {
-        tv_ptr = (f2elm_t *)table_v_qnr; 
-        tr_ptr = (felm_t *)table_r_qnr; 
+        tv_ptr = (f2elm_t *)comp_tables.table_v_qnr; 
+        tr_ptr = (felm_t *)comp_tables.table_r_qnr; 
         *vqnr = 1;
     } else {
-        tv_ptr = (f2elm_t *)table_v_qr;
-        tr_ptr = (felm_t *)table_r_qr; 
+        tv_ptr = (f2elm_t *)comp_tables.table_v_qr;
+        tr_ptr = (felm_t *)comp_tables.table_r_qr; 
         *vqnr = 0;
     }
 
@@ -402,28 +426,39 @@ static void get2mPointonEA(const f2elm_t A, f2elm_t x, felm_t r, f2elm_t t, unsi
         if (*ind <= TABLE_R_LEN-1) {
             fp2copy((felm_t *)*tv_ptr++, v);
             fpcopy(tr_ptr[*ind], r);
+            fp2mul_mont(A, v, x);   
+            fp2neg(x);                   // x = -A*v
+            fp2add(x, A, tmp);        
+            fp2mul_mont(x, tmp, tmp); 
+            fpadd(tmp[0], (digit_t*)Montgomery_one, tmp[0]); 
+            fp2mul_mont(x, tmp, t);      // t = x^3 + A*x^2 + x
+            *ind += 1;
         } else {
             do {
                 fpadd(r, (digit_t*)Montgomery_one, r);
                 fpmul_mont(r, r, tmp[1]);
-                fpmul_mont(u[0], tmp[1], tmp[0]);
-                fpmul_mont(u[1], tmp[1], tmp[1]);
-                fpadd(tmp[0], (digit_t*)Montgomery_one, tmp[0]);
-                fp2inv_mont_bingcd(tmp);
-                fp2copy(tmp, v);     // v = 1/(1 + u*r^2)
+                fpmul_mont(u[0], tmp[1], z[0]);
+                fpmul_mont(u[1], tmp[1], z[1]);
+                fpadd(z[0], (digit_t*)Montgomery_one, z[0]);    // z = 1 + u*r^2 = 1/v, which is a square iff v is
                 *ind += 1; // store the number of attempts for r so that we skip them during decompression
-            } while (is_sqr_fp2(v, tmp[0]) == *vqnr);
+            } while (is_sqr_fp2(z, tmp[0]) == *vqnr);
+            fp2copy(A, x);
+            fp2neg(x);
+            rhs_proj(A, x, z, t);        // t = (x^3 + A*x^2 + x)*z^4 for x = -A/z
         }
+    } while (!is_sqr_fp2(t, tmp[0]));
+    *ind -= 1;
+
+    if (*ind >= TABLE_R_LEN) {
+        fp2copy(z, v);
+        fp2inv_mont_bingcd(v);           // v = 1/(1 + u*r^2)
         fp2mul_mont(A, v, x);   
-        fp2neg(x);                   // x = -A*v
+        fp2neg(x);                       // x = -A*v
         fp2add(x, A, tmp);        
         fp2mul_mont(x, tmp, tmp); 
         fpadd(tmp[0], (digit_t*)Montgomery_one, tmp[0]); 
-        fp2mul_mont(x, tmp, t);      // t = x^3 + A*x^2 + x
-        if (*ind < TABLE_R_LEN)
-            *ind += 1;
-    } while (!is_sqr_fp2(t, tmp[0]));
-    *ind -= 1;
+        fp2mul_mont(x, tmp, t);          // t = x^3 + A*x^2 + x
+    }
 }
 
 
@@ -448,18 +483,21 @@ static void BuildEntangledXonly(const f2elm_t A, point_proj_t *R, unsigned char
 }
 
 
-static void BuildOrdinary2nBasis_dual(const f2elm_t A, const f2elm_t Ds[][2], point_full_proj_t *Rs, unsigned char *qnr, unsigned char *ind)
+static void BuildOrdinary2nBasis_dual(const f2elm_t A, const f2elm_t Ds[][2], point_full_proj_t *Rs, unsigned char *qnr, unsigned char *ind, basis_scratch_t *s)
 {
     unsigned int i;
     felm_t t0;
-    f2elm_t A6 = {0};
-    point_proj_t xs[3] = {0};    
+    f2elm_t A6 = {0}, one = {0};
+    point_proj_t *xs = s->pts;
 
+    OPCOUNT_SCOPE(OPCOUNT_BASIS);
+    STATS_BEGIN(SIKE_PHASE_BASIS);
     // Generate x-only entangled basis 
     BuildEntangledXonly(A, xs, qnr, ind);
 
-    fpcopy((digit_t*)Montgomery_one, (xs[0]->Z)[0]);
-    fpcopy((digit_t*)Montgomery_one, (xs[1]->Z)[0]);
+    fpcopy((digit_t*)Montgomery_one, one[0]);
+    fp2copy(one, xs[0]->Z);
+    fp2copy(one, xs[1]->Z);
 
     // Move them back to A = 6 
     for(i = 0; i < MAX_Bob; i++) {
@@ -476,6 +514,7 @@ static void BuildOrdinary2nBasis_dual(const f2elm_t A, const f2elm_t Ds[][2], po
 
     CompleteMPoint(A6, xs[0]->X, xs[0]->Z, Rs[0]);
     RecoverY(A6, xs, Rs);
+    STATS_END(SIKE_PHASE_BASIS);
 }
 
 
@@ -488,11 +527,11 @@ static void getrvOf2mPoint_Decomp(const unsigned char vqnr, const unsigned char
     u = (felm_t *)u_entang;
     // Select the correct tables
     if (vqnr == 1) {
-        tv_ptr = (f2elm_t *)table_v_qnr; 
-        tr_ptr = (felm_t *)table_r_qnr; 
+        tv_ptr = (f2elm_t *)comp_tables.table_v_qnr; 
+        tr_ptr = (felm_t *)comp_tables.table_r_qnr; 
     } else {
-        tv_ptr = (f2elm_t *)table_v_qr;
-        tr_ptr = (felm_t *)table_r_qr; 
+        tv_ptr = (f2elm_t *)comp_tables.table_v_qr;
+        tr_ptr = (felm_t *)comp_tables.table_r_qr; 
     }
 
     if (ind < TABLE_R_LEN) {
@@ -515,6 +554,8 @@ static void BuildEntangledXonly_Decomp(const f2elm_t A, point_proj_t *R, unsigne
 {
     f2elm_t r, t, v;
 
+    OPCOUNT_SCOPE(OPCOUNT_BASIS);
+    STATS_BEGIN(SIKE_PHASE_BASIS);
     getrvOf2mPoint_Decomp(qnr, ind, r[0], v);
 
     if (ind < TABLE_R_LEN) {
@@ -569,4 +610,5 @@ static void BuildEntangledXonly_Decomp(const f2elm_t A, point_proj_t *R, unsigne
         fp2sqr_mont(r, r);
         fp2mul_mont(R[2]->Z, r, R[2]->Z);
     }
+    STATS_END(SIKE_PHASE_BASIS);
 }
@@ -123,6 +123,7 @@
 #define NBITS_TO_NBYTES(nbits)      (((nbits)+7)/8)                                          // Conversion macro from number of bits to number of bytes
 #define NBITS_TO_NWORDS(nbits)      (((nbits)+(sizeof(digit_t)*8)-1)/(sizeof(digit_t)*8))    // Conversion macro from number of bits to number of computer words
 #define NBYTES_TO_NWORDS(nbytes)    (((nbytes)+sizeof(digit_t)-1)/sizeof(digit_t))           // Conversion macro from number of bytes to number of computer words
+#define POW3(e)                     ((e)==0 ? 1 : (e)==1 ? 3 : (e)==2 ? 9 : (e)==3 ? 27 : (e)==4 ? 81 : (e)==5 ? 243 : (e)==6 ? 729 : (e)==7 ? 2187 : 6561)  // 3^e for 0 <= e <= 8, usable in preprocessor conditionals
 
 // Macro to avoid compiler warnings when detecting unreferenced parameters
 #define UNREFERENCED_PARAMETER(PAR) ((void)(PAR))
@@ -160,6 +161,31 @@
     #define LETOH_64(i) (i)
 #endif
 
+// Alignment of the precomputed tables to cache lines, placed before the declaration
+#define CACHE_LINE_BYTES    64
+#if (COMPILER == COMPILER_VC)
+    #define CACHE_ALIGN    __declspec(align(64))
+#else
+    #define CACHE_ALIGN    __attribute__((aligned(64)))
+#endif
+
+// Prefetch of read-only data into all cache levels
+#if (COMPILER == COMPILER_GCC || COMPILER == COMPILER_CLANG)
+    #define PREFETCH(addr)    __builtin_prefetch((addr), 0, 3)
+#elif (COMPILER == COMPILER_VC) && (TARGET == TARGET_AMD64 || TARGET == TARGET_x86)
+    #include <intrin.h>
+    #define PREFETCH(addr)    _mm_prefetch((const char*)(addr), _MM_HINT_T0)
+#else
+    #define PREFETCH(addr)
+#endif
+
+// Thread-local storage
+#if (COMPILER == COMPILER_VC)
+    #define THREAD_LOCAL    __declspec(thread)
+#else
+    #define THREAD_LOCAL    __thread
+#endif
+
 
 /********************** Constant-time unsigned comparisons ***********************/
 
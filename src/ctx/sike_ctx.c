@@ -0,0 +1,79 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/PQCrypto-SIDH
+* Released under MIT license
+*
+* Abstract: reentrant KEM interface over the parameter sets, with a source of random bytes per context
+*
+* The source of a context is installed as the source of random bytes of the calling thread for
+* the duration of each call, and the previous source is restored afterwards.
+*********************************************************************************************/
+
+#include "sike_ctx.h"
+#include "../random/random.h"
+
+
+int sike_ctx_init(sike_ctx *ctx, const sike_scheme *scheme, sike_rng_fn rng, void *rng_state, void *workspace)
+{ // Initialize a context
+    if (scheme == NULL) return 1;
+
+    ctx->scheme = scheme;
+    ctx->rng = rng;
+    ctx->rng_state = rng_state;
+    ctx->workspace = workspace;
+    return 0;
+}
+
+
+static randombytes_source ctx_source_begin(const sike_ctx *ctx)
+{ // Install the source of random bytes of the context in the calling thread, returning the current one
+    randombytes_source source = {ctx->rng, ctx->rng_state};
+
+    return randombytes_swap_source(source);
+}
+
+
+static int ctx_use_workspace(const sike_ctx *ctx)
+{
+    return (ctx->workspace != NULL && ctx->scheme->workspace_bytes != 0);
+}
+
+
+int sike_kem_keypair(const sike_ctx *ctx, unsigned char *pk, unsigned char *sk)
+{ // Key generation with the parameter set and source of random bytes of the context
+    randombytes_source previous = ctx_source_begin(ctx);
+    int ret;
+
+    if (ctx_use_workspace(ctx)) {
+        ret = ctx->scheme->keypair_ws(pk, sk, ctx->workspace);
+    } else {
+        ret = ctx->scheme->keypair(pk, sk);
+    }
+    randombytes_swap_source(previous);
+    return ret;
+}
+
+
+int sike_kem_enc(const sike_ctx *ctx, unsigned char *ct, unsigned char *ss, const unsigned char *pk)
+{ // Encapsulation with the parameter set and source of random bytes of the context
+    randombytes_source previous = ctx_source_begin(ctx);
+    int ret;
+
+    if (ctx_use_workspace(ctx)) {
+        ret = ctx->scheme->enc_ws(ct, ss, pk, ctx->workspace);
+    } else {
+        ret = ctx->scheme->enc(ct, ss, pk);
+    }
+    randombytes_swap_source(previous);
+    return ret;
+}
+
+
+int sike_kem_dec(const sike_ctx *ctx, unsigned char *ss, const unsigned char *ct, const unsigned char *sk)
+{ // Decapsulation with the parameter set of the context, which does not take random bytes
+    if (ctx_use_workspace(ctx))
+        return ctx->scheme->dec_ws(ss, ct, sk, ctx->workspace);
+    return ctx->scheme->dec(ss, ct, sk);
+}
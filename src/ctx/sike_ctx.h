@@ -0,0 +1,71 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/PQCrypto-SIDH
+* Released under MIT license
+*
+* Abstract: reentrant KEM interface over the parameter sets, with a source of random bytes per context
+*********************************************************************************************/
+
+#ifndef SIKE_CTX_H
+#define SIKE_CTX_H
+
+#include <stddef.h>
+
+
+// Parameter-set descriptor: the sizes and KEM functions of one library variant
+typedef struct {
+    const char *name;                   // CRYPTO_ALGNAME, e.g., "SIKEp434" or "SIKEp751_compressed"
+    size_t secret_key_bytes;            // CRYPTO_SECRETKEYBYTES
+    size_t public_key_bytes;            // CRYPTO_PUBLICKEYBYTES
+    size_t ciphertext_bytes;            // CRYPTO_CIPHERTEXTBYTES
+    size_t shared_secret_bytes;         // CRYPTO_BYTES
+    size_t workspace_bytes;             // Size of the workspace of keypair_ws, enc_ws and dec_ws, 0 if the variant has none
+    int (*keypair)(unsigned char *pk, unsigned char *sk);
+    int (*enc)(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+    int (*dec)(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
+    int (*keypair_ws)(unsigned char *pk, unsigned char *sk, void *workspace);                         // NULL if the variant has none
+    int (*enc_ws)(unsigned char *ct, unsigned char *ss, const unsigned char *pk, void *workspace);    // NULL if the variant has none
+    size_t keypair_coin_bytes;          // CRYPTO_KEYPAIRCOINBYTES
+    size_t enc_coin_bytes;              // CRYPTO_ENCCOINBYTES
+    int (*keypair_derand)(unsigned char *pk, unsigned char *sk, const unsigned char *coins);
+    int (*enc_derand)(unsigned char *ct, unsigned char *ss, const unsigned char *pk, const unsigned char *coins);
+    int (*dec_ws)(unsigned char *ss, const unsigned char *ct, const unsigned char *sk, void *workspace);       // NULL if the variant has none
+} sike_scheme;
+
+// Descriptors of the library variants. A program linked with libsike.a can use all of them, one linked with
+// the library of a single variant (e.g., lib434comp/libsidh.a) only the one of that variant.
+extern const sike_scheme sike_scheme_SIKEp434;
+extern const sike_scheme sike_scheme_SIKEp503;
+extern const sike_scheme sike_scheme_SIKEp610;
+extern const sike_scheme sike_scheme_SIKEp751;
+extern const sike_scheme sike_scheme_SIKEp434_compressed;
+extern const sike_scheme sike_scheme_SIKEp503_compressed;
+extern const sike_scheme sike_scheme_SIKEp610_compressed;
+extern const sike_scheme sike_scheme_SIKEp751_compressed;
+
+// Source of random bytes of a context: writes "nbytes" random bytes to out and returns 0 on success
+typedef int (*sike_rng_fn)(void *rng_state, unsigned char *out, unsigned long long nbytes);
+
+// Context: a parameter set, a source of random bytes and an optional workspace. The functions do not modify it,
+// so that a context can be shared by threads if its source is thread-safe and it has no workspace.
+typedef struct {
+    const sike_scheme *scheme;
+    sike_rng_fn rng;                    // NULL selects the system generator of randombytes (/dev/urandom or BCryptGenRandom)
+    void *rng_state;
+    void *workspace;                    // NULL or scheme->workspace_bytes bytes with any alignment, used if scheme->workspace_bytes != 0
+} sike_ctx;
+
+
+// Initialize a context. Returns 0 on success, 1 if scheme is NULL.
+int sike_ctx_init(sike_ctx *ctx, const sike_scheme *scheme, sike_rng_fn rng, void *rng_state, void *workspace);
+
+// Key generation, encapsulation and decapsulation with the parameter set of the context, with the arguments and return
+// values of crypto_kem_keypair, crypto_kem_enc and crypto_kem_dec. Random bytes are taken from the source of the context.
+int sike_kem_keypair(const sike_ctx *ctx, unsigned char *pk, unsigned char *sk);
+int sike_kem_enc(const sike_ctx *ctx, unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+int sike_kem_dec(const sike_ctx *ctx, unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
+
+
+#endif
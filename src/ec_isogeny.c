@@ -327,6 +327,7 @@ static void LADDER3PT(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xPQ, con
     digit_t mask;
     int i, nbits, bit, swap, prevbit = 0;
 
+    STATS_BEGIN(SIKE_PHASE_LADDER);
     if (AliceOrBob == ALICE) {
         nbits = OALICE_BITS;
     } else {
@@ -362,6 +363,7 @@ static void LADDER3PT(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xPQ, con
     swap = 0 ^ prevbit;
     mask = 0 - (digit_t)swap;
     swap_points(R, R2, mask);
+    STATS_END(SIKE_PHASE_LADDER);
 }
 
 
@@ -686,6 +688,7 @@ static void Ladder3pt_dual(const point_proj_t *Rs, const digit_t* m, const unsig
     digit_t mask;
     int i, nbits, bit, swap, prevbit = 0;
 
+    STATS_BEGIN(SIKE_PHASE_LADDER);
     if (AliceOrBob == ALICE) {
         nbits = OALICE_BITS;
     } else {
@@ -712,6 +715,7 @@ static void Ladder3pt_dual(const point_proj_t *Rs, const digit_t* m, const unsig
     swap = 0 ^ prevbit;
     mask = 0 - (digit_t)swap;
     swap_points(R, R2, mask);
+    STATS_END(SIKE_PHASE_LADDER);
 }
 
 #endif
\ No newline at end of file
@@ -9,6 +9,7 @@
 *********************************************************************************************/
 
 #include <string.h>
+#include <time.h>
 
 
 void clear_words(void* mem, digit_t nwords)
@@ -140,6 +141,7 @@ void copy_words(const digit_t* a, digit_t* c, const unsigned int nwords)
 
 void fpmul_mont(const digit_t* ma, const digit_t* mb, digit_t* mc)
 { // Multiprecision multiplication, c = a*b mod p.
+    OPCOUNT(fp_mul);
 #if defined(_MULX_) && defined(_ADX_) && (OS_TARGET == OS_NIX) && (NBITS_FIELD != 751)
     fpmul(ma, mb, mc);
 #else
@@ -153,12 +155,13 @@ void fpmul_mont(const digit_t* ma, const digit_t* mb, digit_t* mc)
 
 void fpsqr_mont(const digit_t* ma, digit_t* mc)
 { // Multiprecision squaring, c = a^2 mod p.
+    OPCOUNT(fp_sqr);
 #if defined(_MULX_) && defined(_ADX_) && (OS_TARGET == OS_NIX) && (NBITS_FIELD != 751)
-    fpmul(ma, ma, mc);
+    fpsqr(ma, mc);
 #else
     dfelm_t temp = {0};
 
-    mp_mul(ma, ma, temp, NWORDS_FIELD);
+    mp_sqr(ma, temp, NWORDS_FIELD);
     rdc_mont(temp, mc);
 #endif
 }
@@ -168,6 +171,7 @@ void fpinv_mont(digit_t* a)
 { // Field inversion using Montgomery arithmetic, a = a^(-1)*R mod p.
     felm_t tt;
 
+    OPCOUNT(fp_inv);
     fpcopy(a, tt);
     fpinv_chain_mont(tt);
     fpsqr_mont(tt, tt);
@@ -199,6 +203,7 @@ void fp2neg(f2elm_t a)
 
 inline void fp2add(const f2elm_t a, const f2elm_t b, f2elm_t c)           
 { // GF(p^2) addition, c = a+b in GF(p^2).
+    OPCOUNT(fp2_add);
     fpadd(a[0], b[0], c[0]);
     fpadd(a[1], b[1], c[1]);
 }
@@ -206,6 +211,7 @@ inline void fp2add(const f2elm_t a, const f2elm_t b, f2elm_t c)
 
 inline void fp2sub(const f2elm_t a, const f2elm_t b, f2elm_t c)          
 { // GF(p^2) subtraction, c = a-b in GF(p^2).
+    OPCOUNT(fp2_sub);
     fpsub(a[0], b[0], c[0]);
     fpsub(a[1], b[1], c[1]);
 }
@@ -269,6 +275,7 @@ void fp2sqr_mont(const f2elm_t a, f2elm_t c)
 { // GF(p^2) squaring using Montgomery arithmetic, c = a^2 in GF(p^2).
   // Inputs: a = a0+a1*i, where a0, a1 are in [0, 2*p-1] 
   // Output: c = c0+c1*i, where c0, c1 are in [0, 2*p-1]  
+    OPCOUNT(fp2_sqr);
 #if defined(_MULX_) && defined(_ADX_) && (OS_TARGET == OS_NIX) && (NBITS_FIELD != 751)
     dfelm_t tt1; 
     
@@ -335,6 +342,7 @@ void fp2mul_mont(const f2elm_t a, const f2elm_t b, f2elm_t c)
 { // GF(p^2) multiplication using Montgomery arithmetic, c = a*b in GF(p^2).
   // Inputs: a = a0+a1*i and b = b0+b1*i, where a0, a1, b0, b1 are in [0, 2*p-1] 
   // Output: c = c0+c1*i, where c0, c1 are in [0, 2*p-1] 
+    OPCOUNT(fp2_mul);
 #if defined(_MULX_) && defined(_ADX_) && (OS_TARGET == OS_NIX) && (NBITS_FIELD != 751)
     felm_t t1;
     
@@ -781,6 +789,7 @@ void fp2inv_mont(f2elm_t a)
 {// GF(p^2) inversion using Montgomery arithmetic, a = (a0-i*a1)/(a0^2+a1^2).
     f2elm_t t1;
 
+    OPCOUNT(fp2_inv);
     fpsqr_mont(a[0], t1[0]);                         // t10 = a0^2
     fpsqr_mont(a[1], t1[1]);                         // t11 = a1^2
     fpadd(t1[0], t1[1], t1[0]);                      // t10 = a0^2+a1^2
@@ -888,6 +897,156 @@ unsigned char is_sqr_fp2(const f2elm_t a, felm_t s)
     return 1;
 }
 
+
+#if defined(_OPCOUNT_)
+
+THREAD_LOCAL opcount_t opcount_ops;                            // Operations executed so far by this thread
+static THREAD_LOCAL opcount_t opcount_records[OPCOUNT_NCALLS]; // Operations executed by each counted call of this thread
+
+
+opcount_scope_t opcount_enter(opcount_call call)
+{ // Start of a counted call
+    opcount_scope_t scope;
+
+    scope.call = call;
+    scope.start = opcount_ops;
+    return scope;
+}
+
+
+void opcount_leave(opcount_scope_t *scope)
+{ // End of a counted call: add the operations executed since opcount_enter() to the record of the call
+    uint64_t *record = (uint64_t*)&opcount_records[scope->call];
+    const uint64_t *now = (const uint64_t*)&opcount_ops, *start = (const uint64_t*)&scope->start;
+
+    opcount_records[scope->call].calls++;
+    for (unsigned int i = 1; i < sizeof(opcount_t)/sizeof(uint64_t); i++) {
+        record[i] += now[i] - start[i];
+    }
+}
+
+
+void opcount_merge(const opcount_t *ops)
+{ // Add the operations counted by another thread to this thread
+    uint64_t *now = (uint64_t*)&opcount_ops;
+    const uint64_t *add = (const uint64_t*)ops;
+
+    for (unsigned int i = 1; i < sizeof(opcount_t)/sizeof(uint64_t); i++) {
+        now[i] += add[i];
+    }
+}
+
+#endif
+
+
+int opcount_get(unsigned int call, opcount_t *ops)
+{ // Operations executed by the calls "call" (see opcount_call) of the calling thread since the last opcount_reset().
+  // Returns 1, with ops set to zero, if "call" is invalid or if the library was not built with OPCOUNT=TRUE.
+    memset(ops, 0, sizeof(opcount_t));
+#if defined(_OPCOUNT_)
+    if (call < OPCOUNT_NCALLS) {
+        *ops = opcount_records[call];
+        return 0;
+    }
+#endif
+    (void)call;
+    return 1;
+}
+
+
+void opcount_reset(void)
+{ // Clear the operation counts of the calling thread
+#if defined(_OPCOUNT_)
+    memset(opcount_records, 0, sizeof(opcount_records));
+#endif
+}
+
+
+volatile int stats_enabled = 0;            // Phase timers of all threads enabled
+THREAD_LOCAL sike_stats_t stats_thread;    // Phases timed in this thread
+
+
+uint64_t stats_ticks(void)
+{ // Timestamp counter: TSC on x86 and x64, virtual counter on ARMv8 and CLOCK_MONOTONIC in nanoseconds on other Unix-like platforms
+#if (TARGET == TARGET_AMD64 || TARGET == TARGET_x86) && (COMPILER == COMPILER_VC)
+    return __rdtsc();
+#elif (TARGET == TARGET_AMD64 || TARGET == TARGET_x86)
+    uint32_t lo, hi;
+
+    __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+    return ((uint64_t)hi << 32) | lo;
+#elif (TARGET == TARGET_ARM64) && (COMPILER == COMPILER_GCC || COMPILER == COMPILER_CLANG)
+    uint64_t t;
+
+    __asm__ __volatile__ ("mrs %0, cntvct_el0" : "=r" (t));
+    return t;
+#elif (OS_TARGET == OS_NIX)
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000000 + (uint64_t)ts.tv_nsec;
+#else
+    return 0;
+#endif
+}
+
+
+void stats_add(sike_phase phase, uint64_t start)
+{ // End of a timed phase that started at "start"
+    stats_thread.calls[phase]++;
+    stats_thread.ticks[phase] += stats_ticks() - start;
+}
+
+
+void sike_stats_enable(int enable)
+{ // Enable (enable != 0) or disable the phase timers of all threads
+    stats_enabled = (enable != 0);
+}
+
+
+void sike_stats_snapshot(sike_stats_t *stats)
+{ // Phases timed by the calling thread since the last sike_stats_reset()
+    *stats = stats_thread;
+}
+
+
+void sike_stats_reset(void)
+{ // Clear the phase timers of the calling thread
+    memset(&stats_thread, 0, sizeof(sike_stats_t));
+}
+
+
+#if defined(_USDT_)
+
+THREAD_LOCAL uint64_t usdt_call_id;    // ID of the outermost traced call running in this thread
+static uint64_t usdt_calls;            // Number of outermost traced calls of all threads
+
+
+usdt_scope_t usdt_enter(unsigned int call)
+{ // Start of a traced call. An outermost call gets a new ID, which nested calls and phases report too. Without a tracer attached,
+  // no ID is drawn, so that the calls of different threads do not share the cache line of usdt_calls
+    usdt_scope_t scope;
+
+    scope.call = call;
+    scope.outer = (usdt_call_id == 0 && USDT_TRACED);
+    if (scope.outer) {
+        usdt_call_id = __atomic_add_fetch(&usdt_calls, 1, __ATOMIC_RELAXED);
+    }
+    USDT_PROBE3(sike, call_start, USDT_PARAMS, usdt_call_id, call);
+    return scope;
+}
+
+
+void usdt_leave(usdt_scope_t *scope)
+{ // End of a traced call
+    USDT_PROBE3(sike, call_end, USDT_PARAMS, usdt_call_id, scope->call);
+    if (scope->outer) {
+        usdt_call_id = 0;
+    }
+}
+
+#endif
+
 #ifdef COMPRESS
 
 static inline unsigned int is_felm_one(const felm_t x)
@@ -954,6 +1113,11 @@ void fp2_conj(const f2elm_t v, f2elm_t r)
 
 void sqr_Fp2_cycl(f2elm_t a, const felm_t one)
 { // Cyclotomic squaring on elements of norm 1, using a^(p+1) = 1.
+#if defined(_MULX_) && defined(_ADX_) && (OS_TARGET == OS_NIX) && (NBITS_FIELD != 751)
+  // With a0^2 + a1^2 = 1, a^2 = (a0+a1)(a0-a1) + 2*a0*a1*i is computed faster by the fused GF(p^2) squaring kernels
+    UNREFERENCED_PARAMETER(one);
+    fp2sqr_mont(a, a);
+#else
      felm_t t0;
  
      fpadd(a[0], a[1], t0);              // t0 = a0 + a1
@@ -962,6 +1126,7 @@ void sqr_Fp2_cycl(f2elm_t a, const felm_t one)
      fpsqr_mont(a[0], t0);               // t0 = a0^2
      fpadd(t0, t0, t0);                  // t0 = t0 + t0
      fpsub(t0, one, a[0]);               // a0 = t0 - 1
+#endif
 }
 
 
@@ -1169,6 +1334,7 @@ void fpinv_mont_bingcd(digit_t* a)
     felm_t x, t;
     unsigned int k;
 
+    OPCOUNT(fp_inv);
     if (is_felm_zero(a) == true)
         return;
 
@@ -1188,6 +1354,7 @@ void fp2inv_mont_bingcd(f2elm_t a)
  // This uses the binary GCD for inversion in fp and is NOT constant time!!!
     f2elm_t t1;
 
+    OPCOUNT(fp2_inv);
     fpsqr_mont(a[0], t1[0]);             // t10 = a0^2
     fpsqr_mont(a[1], t1[1]);             // t11 = a1^2
     fpadd(t1[0], t1[1], t1[0]);          // t10 = a0^2+a1^2
@@ -1271,27 +1438,77 @@ void Montgomery_multiply_mod_order(const digit_t* ma, const digit_t* mb, digit_t
   // ma, mb and mc are assumed to be in Montgomery representation.
   // The Montgomery constant r' = -r^(-1) mod 2^(log_2(r)) is the value "Montgomery_rprime", where r is the order.  
   // Assume log_2(r) is a multiple of RADIX bits
-    unsigned int i, cout = 0, bout = 0;
-    digit_t mask, P[2*NWORDS_ORDER] = {0}, Q[2*NWORDS_ORDER] = {0}, temp[2*NWORDS_ORDER] = {0};
+  // The reduction is interleaved word by word (CIOS), for which only the lowest word r'[0] = -r^(-1) mod 2^RADIX is needed.
+  // ma and mb may also be in [0, 2*order-1] as long as 2*order <= 2^(log_2(r)).
+    unsigned int i, j, bout;
+    digit_t mask, m, u, t[NWORDS_ORDER+2] = {0};
+#if (TARGET == TARGET_AMD64 || TARGET == TARGET_ARM64) && (OS_TARGET == OS_NIX) && !defined(GENERIC_IMPLEMENTATION)
+    uint128_t uv;    // Native double-digit accumulator: a*b + t + u never overflows, so no carries need to be tracked
 
-    multiply(ma, mb, P, NWORDS_ORDER);                 // P = ma * mb
-    multiply(P, Montgomery_rprime, Q, NWORDS_ORDER);   // Q = P * r' mod 2^(log_2(r))
-    multiply(Q, order, temp, NWORDS_ORDER);            // temp = Q * r
-    cout = mp_add(P, temp, temp, 2*NWORDS_ORDER);      // (cout, temp) = P + Q * r     
+    for (i = 0; i < NWORDS_ORDER; i++) {
+        u = 0;                                         // t = t + ma*mb[i]
+        for (j = 0; j < NWORDS_ORDER; j++) {
+            uv = (uint128_t)ma[j]*mb[i] + t[j] + u;
+            t[j] = (digit_t)uv;
+            u = (digit_t)(uv >> RADIX);
+        }
+        uv = (uint128_t)t[NWORDS_ORDER] + u;
+        t[NWORDS_ORDER] = (digit_t)uv;
+        t[NWORDS_ORDER+1] = (digit_t)(uv >> RADIX);
+
+        m = t[0]*Montgomery_rprime[0];                 // t = (t + m*r)/2^RADIX, with m = t*r' mod 2^RADIX
+        uv = (uint128_t)m*order[0] + t[0];
+        u = (digit_t)(uv >> RADIX);
+        for (j = 1; j < NWORDS_ORDER; j++) {
+            uv = (uint128_t)m*order[j] + t[j] + u;
+            t[j-1] = (digit_t)uv;
+            u = (digit_t)(uv >> RADIX);
+        }
+        uv = (uint128_t)t[NWORDS_ORDER] + u;
+        t[NWORDS_ORDER-1] = (digit_t)uv;
+        t[NWORDS_ORDER] = t[NWORDS_ORDER+1] + (digit_t)(uv >> RADIX);
+    }
+#else
+    unsigned int carry;
+    digit_t v, UV[2];
 
-    for (i = 0; i < NWORDS_ORDER; i++) {               // (cout, mc) = (P + Q * r)/2^(log_2(r))
-        mc[i] = temp[NWORDS_ORDER+i];
+    for (i = 0; i < NWORDS_ORDER; i++) {
+        u = 0;                                         // t = t + ma*mb[i]
+        for (j = 0; j < NWORDS_ORDER; j++) {
+            MUL(ma[j], mb[i], UV+1, UV[0]);
+            ADDC(0, UV[0], u, carry, v);
+            u = UV[1] + (digit_t)carry;
+            ADDC(0, t[j], v, carry, t[j]);
+            u += carry;
+        }
+        ADDC(0, t[NWORDS_ORDER], u, carry, t[NWORDS_ORDER]);
+        t[NWORDS_ORDER+1] = (digit_t)carry;
+
+        m = t[0]*Montgomery_rprime[0];                 // t = (t + m*r)/2^RADIX, with m = t*r' mod 2^RADIX
+        MUL(m, order[0], UV+1, UV[0]);
+        ADDC(0, t[0], UV[0], carry, v);
+        u = UV[1] + (digit_t)carry;
+        for (j = 1; j < NWORDS_ORDER; j++) {
+            MUL(m, order[j], UV+1, UV[0]);
+            ADDC(0, UV[0], u, carry, v);
+            u = UV[1] + (digit_t)carry;
+            ADDC(0, t[j], v, carry, t[j-1]);
+            u += carry;
+        }
+        ADDC(0, t[NWORDS_ORDER], u, carry, t[NWORDS_ORDER-1]);
+        t[NWORDS_ORDER] = t[NWORDS_ORDER+1] + (digit_t)carry;
     }
+#endif
 
     // Final, constant-time subtraction     
-    bout = mp_sub(mc, order, mc, NWORDS_ORDER);        // (cout, mc) = (cout, mc) - r
-    mask = (digit_t)cout - (digit_t)bout;              // if (cout, mc) >= 0 then mask = 0x00..0, else if (cout, mc) < 0 then mask = 0xFF..F
+    bout = mp_sub(t, order, mc, NWORDS_ORDER);         // (t[NWORDS_ORDER], mc) = (t[NWORDS_ORDER], t) - r
+    mask = t[NWORDS_ORDER] - (digit_t)bout;            // if (t[NWORDS_ORDER], mc) >= 0 then mask = 0x00..0, else if (t[NWORDS_ORDER], mc) < 0 then mask = 0xFF..F
     
-    for (i = 0; i < NWORDS_ORDER; i++) {               // temp = mask & r
-        temp[i] = (order[i] & mask);
+    for (i = 0; i < NWORDS_ORDER; i++) {               // t = mask & r
+        t[i] = (order[i] & mask);
     }
     
-    mp_add(mc, temp, mc, NWORDS_ORDER);                //  mc = mc + (mask & r)
+    mp_add(mc, t, mc, NWORDS_ORDER);                   //  mc = mc + (mask & r)
 }
 
 
@@ -1425,6 +1642,44 @@ void Montgomery_inversion_mod_order_bingcd(const digit_t* a, digit_t* c, const d
 }
 
 
+void Montgomery_inversion_mod_orderB(const digit_t* ma, digit_t* mc, const digit_t* order, const digit_t* Montgomery_rprime)
+{ // Constant-time Montgomery inversion modulo Bob's order r = 3^OBOB_EXPON, mc = ma^(-1) mod order in Montgomery representation.
+  // Uses ma^(-1) = ma^(2*3^(e-1)-1) with e = OBOB_EXPON. The powers s_k = ma^((3^k-1)/2) satisfy s_(j+k) = s_j^(3^k)*s_k,
+  // so s_(e-1) is built along the bits of e-1 with about e cubings, and ma^(-1) = s_(e-1)^4*ma.
+  // ma in [0, 2*order-1], mc in [0, order-1]. mc = 0 if ma = 0 mod 3. ma and mc can be the same variable.
+    unsigned int i, k, bit;
+    digit_t a[NWORDS_ORDER], s[NWORDS_ORDER], t[NWORDS_ORDER], u[NWORDS_ORDER];
+
+    copy_words(ma, a, NWORDS_ORDER);
+    copy_words(a, s, NWORDS_ORDER);                    // s = s_1 = ma
+    k = 1;
+    for (bit = 1; ((OBOB_EXPON-1) >> bit) != 0; bit++);
+    while (bit-- > 1) {
+        copy_words(s, t, NWORDS_ORDER);                // s_2k = s_k^(3^k)*s_k
+        for (i = 0; i < k; i++) {
+            Montgomery_multiply_mod_order(s, s, u, order, Montgomery_rprime);
+            Montgomery_multiply_mod_order(s, u, s, order, Montgomery_rprime);
+        }
+        Montgomery_multiply_mod_order(s, t, s, order, Montgomery_rprime);
+        k *= 2;
+        if (((OBOB_EXPON-1) >> (bit-1)) & 1) {         // s_(k+1) = s_k^3*s_1
+            Montgomery_multiply_mod_order(s, s, u, order, Montgomery_rprime);
+            Montgomery_multiply_mod_order(s, u, s, order, Montgomery_rprime);
+            Montgomery_multiply_mod_order(s, a, s, order, Montgomery_rprime);
+            k += 1;
+        }
+    }
+    Montgomery_multiply_mod_order(s, s, s, order, Montgomery_rprime);
+    Montgomery_multiply_mod_order(s, s, s, order, Montgomery_rprime);
+    Montgomery_multiply_mod_order(s, a, mc, order, Montgomery_rprime);    // mc = s_(e-1)^4*ma
+
+    clear_words((void*)a, NWORDS_ORDER);
+    clear_words((void*)s, NWORDS_ORDER);
+    clear_words((void*)t, NWORDS_ORDER);
+    clear_words((void*)u, NWORDS_ORDER);
+}
+
+
 void inv_mod_orderA(const digit_t* a, digit_t* c)
 { // Inversion of an odd integer modulo an even integer of the form 2^m.
   // Algorithm 3: Explicit Quadratic Modular inverse modulo 2^m from Dumas'12: http://arxiv.org/pdf/1209.6626.pdf
@@ -48,6 +48,9 @@ void digit_x_digit(const digit_t a, const digit_t b, digit_t* c);
 // Multiprecision comba multiply, c = a*b, where lng(a) = lng(b) = nwords.
 void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int nwords);
 
+// Multiprecision squaring, c = a^2, where lng(a) = nwords. Each cross product a[i]*a[j] is computed once.
+void mp_sqr(const digit_t* a, digit_t* c, const unsigned int nwords);
+
 /************ Montgomery reduction and conversion functions *************/
 
 // Montgomery reduction, c = a mod p
@@ -109,5 +112,97 @@ void inv_3_way(f2elm_t z1, f2elm_t z2, f2elm_t z3);
 // Given the x-coordinates of P, Q, and R, returns the value A corresponding to the Montgomery curve E_A: y^2=x^3+A*x^2+x such that R=Q-P on E_A.
 void get_A(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xR, f2elm_t A);
 
+/************ Operation counting (OPCOUNT=TRUE) *************/
+
+#if defined(_OPCOUNT_)
+    #if !defined(__GNUC__)
+        #error -- "OPCOUNT requires GCC or clang"
+    #endif
+    #include "opcount.h"
+
+typedef struct { opcount_call call; opcount_t start; } opcount_scope_t;
+
+// Field operations executed so far by the calling thread
+extern THREAD_LOCAL opcount_t opcount_ops;
+
+// Start and end of a counted call. The operations executed in between are added to the record of the call
+opcount_scope_t opcount_enter(opcount_call call);
+void opcount_leave(opcount_scope_t *scope);
+
+// Add the operations counted by another thread, e.g., a worker that ran part of a call, to the calling thread
+void opcount_merge(const opcount_t *ops);
+
+    #define OPCOUNT(op)            (opcount_ops.op++)
+    #define OPCOUNT_SCOPE(call)    opcount_scope_t opcount_scope __attribute__((cleanup(opcount_leave))) = opcount_enter(call)
+#else
+    #define OPCOUNT(op)
+    #define OPCOUNT_SCOPE(call)
+#endif
+
+
+/************ Statically defined tracepoints (USDT=TRUE) *************/
+
+// Probes of provider "sike", all with arguments (parameter set, call ID, call or phase):
+//   call_start, call_end:   traced calls (USDT_SCOPE), the third argument is an opcount_call
+//   phase_start, phase_end: phases of the phase timers (STATS_BEGIN, STATS_END), the third argument is a sike_phase
+// The parameter set is the bit length of the prime (434, 503, 610 or 751), plus 1000 for the compressed variants. The call ID
+// is unique in the process and identifies the outermost traced call, e.g., crypto_kem_enc for its key generation and phases.
+// IDs are only drawn while a tracer is attached to one of the probes, as told by their semaphores, and are 0 otherwise.
+#if defined(_USDT_)
+    #if !defined(__GNUC__) || !defined(__ELF__) || !(defined(__x86_64__) || defined(__aarch64__))
+        #error -- "USDT requires GCC or clang and an x64 or ARMv8 ELF target"
+    #endif
+    #include "usdt.h"
+
+    #if defined(COMPRESS)
+        #define USDT_PARAMS    (1000 + NBITS_FIELD)
+    #else
+        #define USDT_PARAMS    NBITS_FIELD
+    #endif
+
+USDT_SEMAPHORE(sike, call_start);
+USDT_SEMAPHORE(sike, call_end);
+USDT_SEMAPHORE(sike, phase_start);
+USDT_SEMAPHORE(sike, phase_end);
+
+    #define USDT_TRACED    (USDT_ACTIVE(sike, call_start) || USDT_ACTIVE(sike, call_end) || USDT_ACTIVE(sike, phase_start) || USDT_ACTIVE(sike, phase_end))
+
+typedef struct { unsigned int call; unsigned int outer; } usdt_scope_t;
+
+// ID of the outermost traced call running in this thread, 0 if none
+extern THREAD_LOCAL uint64_t usdt_call_id;
+
+// Start and end of a traced call
+usdt_scope_t usdt_enter(unsigned int call);
+void usdt_leave(usdt_scope_t *scope);
+
+    #define USDT_SCOPE(call)            usdt_scope_t usdt_scope __attribute__((cleanup(usdt_leave))) = usdt_enter(call)
+    #define USDT_PHASE(probe, phase)    USDT_PROBE3(sike, probe, USDT_PARAMS, usdt_call_id, phase);
+#else
+    #define USDT_SCOPE(call)
+    #define USDT_PHASE(probe, phase)
+#endif
+
+
+/************ Phase timers *************/
+
+#include "sike_stats.h"
+
+// Phase timers are enabled at runtime by sike_stats_enable(). When disabled, a phase costs two tests of stats_enabled
+extern volatile int stats_enabled;
+extern THREAD_LOCAL sike_stats_t stats_thread;
+
+// Timestamp counter, see sike_stats_t. Returns 0 on platforms without a counter
+uint64_t stats_ticks(void);
+
+// Add the time elapsed since "start" to the phase
+void stats_add(sike_phase phase, uint64_t start);
+
+// Timing of the code between STATS_BEGIN(phase) and STATS_END(phase), or of the statement "..." with STATS_PHASE(phase, ...)
+// The phases are also traced by the USDT probes phase_start and phase_end
+#define STATS_BEGIN(phase)         USDT_PHASE(phase_start, phase) uint64_t stats_start_##phase = (stats_enabled ? stats_ticks() : 0)
+#define STATS_END(phase)           do { if (stats_start_##phase != 0) stats_add(phase, stats_start_##phase); USDT_PHASE(phase_end, phase) } while (0)
+#define STATS_PHASE(phase, ...)    do { STATS_BEGIN(phase); __VA_ARGS__; STATS_END(phase); } while (0)
+
 
 #endif
@@ -0,0 +1,331 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/PQCrypto-SIDH
+* Released under MIT license
+*
+* Abstract: persistent store of KEM key pairs, encrypted at rest and taken once (POSIX only)
+*********************************************************************************************/
+
+#include <string.h>
+#if defined(__NIX__)
+    #include <stdio.h>
+    #include <stdlib.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <errno.h>
+#endif
+
+typedef char keystore_expanded_pk_size[(sizeof(f2elm_t[4]) == CRYPTO_EXPANDEDPKBYTES) ? 1 : -1];
+
+#define KEYSTORE_WORDS(bytes)    (((bytes) + sizeof(digit_t) - 1)/sizeof(digit_t))    // Buffers that hold keys are erased with clear_words
+
+
+#if defined(__NIX__)
+// Key store: a header and "count" slots of KEYSTORE_SLOT_BYTES bytes, each one holding a key pair, i.e., its secret key (which ends with
+// the public key) and the encoding of the coefficient A of the curve of the public key. The data of a slot is encrypted with a key stream
+// and authenticated with a tag, both given by SHAKE256 over a domain byte, the key of the store, a random nonce of the store and the index
+// of the slot. The header is authenticated likewise. A slot is taken by moving its state from KEYSTORE_LIVE to KEYSTORE_TAKEN with an
+// atomic operation on the shared mapping, so that the threads and processes sharing a store never take the same key pair, and it is then
+// erased and written back to the file. A store is only accepted by the library variant and byte order that wrote it.
+
+#define KEYSTORE_MAGIC         "SIKEKEY"
+#define KEYSTORE_VERSION       1
+#define KEYSTORE_BYTE_ORDER    0x01020304
+#define KEYSTORE_NONCEBYTES    16
+#define KEYSTORE_TAGBYTES      32
+#define KEYSTORE_DATABYTES     (CRYPTO_SECRETKEYBYTES + FP2_ENCODED_BYTES)    // Secret key and encoding of A
+#define KEYSTORE_LIVE          0x4556494C59454B53ULL                           // Slot states. Taken slots end up zero.
+#define KEYSTORE_TAKEN         0x4E454B4154594B53ULL
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;                         // KEYSTORE_BYTE_ORDER in the byte order of the writer
+    char scheme[32];                             // CRYPTO_ALGNAME
+    uint32_t count;                              // Number of slots
+    uint32_t slot_bytes;
+    uint64_t bytes;                              // Size of the store
+    unsigned char nonce[KEYSTORE_NONCEBYTES];
+    unsigned char tag[KEYSTORE_TAGBYTES];        // Tag of the preceding fields
+} keystore_header;
+
+typedef struct {
+    uint64_t state;
+    uint64_t index;
+    unsigned char tag[KEYSTORE_TAGBYTES];        // Tag of the encrypted data
+    unsigned char data[KEYSTORE_DATABYTES];
+} keystore_slot;
+
+#define KEYSTORE_HEADER_BYTES    ((sizeof(keystore_header) + CACHE_LINE_BYTES - 1) & ~(size_t)(CACHE_LINE_BYTES - 1))
+#define KEYSTORE_SLOT_BYTES      ((sizeof(keystore_slot) + CACHE_LINE_BYTES - 1) & ~(size_t)(CACHE_LINE_BYTES - 1))
+
+
+static void keystore_shake(unsigned char *out, size_t outlen, unsigned char domain, const unsigned char *key, const unsigned char *nonce,
+                           uint64_t index, const unsigned char *in, size_t inlen)
+{ // out = SHAKE256(domain || key || nonce || index || in), with the index in 8 bytes little endian and inlen <= KEYSTORE_DATABYTES
+    digit_t words[KEYSTORE_WORDS(1 + SIKE_KEYSTORE_KEYBYTES + KEYSTORE_NONCEBYTES + 8 + KEYSTORE_DATABYTES)];
+    unsigned char *buf = (unsigned char*)words;
+    const size_t n = 1 + SIKE_KEYSTORE_KEYBYTES + KEYSTORE_NONCEBYTES + 8;
+
+    buf[0] = domain;
+    memcpy(buf + 1, key, SIKE_KEYSTORE_KEYBYTES);
+    memcpy(buf + 1 + SIKE_KEYSTORE_KEYBYTES, nonce, KEYSTORE_NONCEBYTES);
+    for (int i = 0; i < 8; i++) {
+        buf[n - 8 + i] = (unsigned char)(index >> 8*i);
+    }
+    if (inlen != 0) memcpy(buf + n, in, inlen);
+    shake256(out, outlen, buf, n + inlen);
+    clear_words((void*)words, sizeof(words)/sizeof(digit_t));
+}
+
+
+static void keystore_crypt(unsigned char *data, const unsigned char *key, const unsigned char *nonce, uint64_t index)
+{ // Encrypt or decrypt the data of the slot "index" in place
+    digit_t words[KEYSTORE_WORDS(KEYSTORE_DATABYTES)];
+    unsigned char *stream = (unsigned char*)words;
+
+    keystore_shake(stream, KEYSTORE_DATABYTES, 'E', key, nonce, index, NULL, 0);
+    for (size_t i = 0; i < KEYSTORE_DATABYTES; i++) {
+        data[i] ^= stream[i];
+    }
+    clear_words((void*)words, KEYSTORE_WORDS(KEYSTORE_DATABYTES));
+}
+
+
+static void keystore_slot_tag(unsigned char *tag, const keystore_slot *slot, const unsigned char *key, const unsigned char *nonce, uint64_t index)
+{
+    keystore_shake(tag, KEYSTORE_TAGBYTES, 'T', key, nonce, index, slot->data, KEYSTORE_DATABYTES);
+}
+
+
+static void keystore_header_tag(unsigned char *tag, const keystore_header *header, const unsigned char *key)
+{
+    keystore_shake(tag, KEYSTORE_TAGBYTES, 'H', key, header->nonce, 0, (const unsigned char*)header, offsetof(keystore_header, nonce));
+}
+
+
+static size_t keystore_prefix(keystore_header *header, unsigned int count)
+{ // Header of a store with "count" slots, without nonce and tag. Returns the size of the store.
+    size_t bytes = KEYSTORE_HEADER_BYTES + (size_t)count*KEYSTORE_SLOT_BYTES;
+
+    memset(header, 0, sizeof(keystore_header));
+    memcpy(header->magic, KEYSTORE_MAGIC, sizeof(KEYSTORE_MAGIC));
+    header->version = KEYSTORE_VERSION;
+    header->byte_order = KEYSTORE_BYTE_ORDER;
+    strncpy(header->scheme, CRYPTO_ALGNAME, sizeof(header->scheme) - 1);
+    header->count = count;
+    header->slot_bytes = (uint32_t)KEYSTORE_SLOT_BYTES;
+    header->bytes = bytes;
+    return bytes;
+}
+
+
+static keystore_slot* keystore_get_slot(unsigned char *map, unsigned int i)
+{
+    return (keystore_slot*)(map + KEYSTORE_HEADER_BYTES + (size_t)i*KEYSTORE_SLOT_BYTES);
+}
+
+
+static void keystore_erase_slot(keystore_slot *slot)
+{ // Erase a claimed slot, mark it as taken for good and write it back to the file
+    uintptr_t page = (uintptr_t)sysconf(_SC_PAGESIZE), start = (uintptr_t)slot & ~(page - 1);
+
+    clear_words((void*)slot->tag, KEYSTORE_WORDS(KEYSTORE_TAGBYTES + KEYSTORE_DATABYTES));    // Tag and data, up to the padding of the slot
+    slot->index = 0;
+    __atomic_store_n(&slot->state, 0, __ATOMIC_RELEASE);
+    msync((void*)start, (uintptr_t)slot + sizeof(keystore_slot) - start, MS_SYNC);
+}
+
+#endif
+
+
+int crypto_kem_keystore_write(const char *path, const unsigned char *key, const unsigned char *sks, unsigned int count)
+{ // Write "count" key pairs to the key store "path", encrypted with key (SIKE_KEYSTORE_KEYBYTES bytes). sks holds their secret keys
+  // (count*CRYPTO_SECRETKEYBYTES bytes), which end with the public keys. The store is created with mode 0600 under a temporary name, written
+  // to disk and then renamed, so that readers never see a partial store (POSIX only). Returns 0 on success.
+#if defined(__NIX__)
+    keystore_header *header;
+    unsigned char *image = NULL;
+    char *tmp = NULL;
+    size_t bytes, done = 0;
+    f2elm_t PKB[4];
+    int fd, status = 1;
+
+    if (count == 0) return 1;
+    bytes = KEYSTORE_HEADER_BYTES + (size_t)count*KEYSTORE_SLOT_BYTES;
+    image = (unsigned char*)calloc(bytes, 1);
+    tmp = (char*)malloc(strlen(path) + 8);
+    if (image == NULL || tmp == NULL) goto cleanup;
+
+    header = (keystore_header*)image;
+    keystore_prefix(header, count);
+    if (randombytes(header->nonce, KEYSTORE_NONCEBYTES) != 0) goto cleanup;
+    keystore_header_tag(header->tag, header, key);
+    for (unsigned int i = 0; i < count; i++) {
+        keystore_slot *slot = keystore_get_slot(image, i);
+        const unsigned char *sk = sks + (size_t)i*CRYPTO_SECRETKEYBYTES, *pk = sk + MSG_BYTES + SECRETKEY_B_BYTES;
+
+        fp2_decode(pk, PKB[0]);
+        fp2_decode(pk + FP2_ENCODED_BYTES, PKB[1]);
+        fp2_decode(pk + 2*FP2_ENCODED_BYTES, PKB[2]);
+        get_A(PKB[0], PKB[1], PKB[2], PKB[3]);
+        slot->state = KEYSTORE_LIVE;
+        slot->index = i;
+        memcpy(slot->data, sk, CRYPTO_SECRETKEYBYTES);
+        fp2_encode(PKB[3], slot->data + CRYPTO_SECRETKEYBYTES);
+        keystore_crypt(slot->data, key, header->nonce, i);
+        keystore_slot_tag(slot->tag, slot, key, header->nonce, i);
+    }
+
+    strcpy(tmp, path);
+    strcat(tmp, ".XXXXXX");
+    fd = mkstemp(tmp);
+    if (fd < 0) goto cleanup;
+    while (done < bytes) {
+        ssize_t n = write(fd, image + done, bytes - done);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        done += (size_t)n;
+    }
+    if (done == bytes && fchmod(fd, 0600) == 0 && fsync(fd) == 0) status = 0;
+    if (close(fd) != 0) status = 1;
+    if (status == 0 && rename(tmp, path) != 0) status = 1;
+    if (status != 0) unlink(tmp);
+
+cleanup:
+    free(image);
+    free(tmp);
+    return status;
+#else
+    UNREFERENCED_PARAMETER(path);
+    UNREFERENCED_PARAMETER(key);
+    UNREFERENCED_PARAMETER(sks);
+    UNREFERENCED_PARAMETER(count);
+    return 1;
+#endif
+}
+
+
+int crypto_kem_keystore_open(sike_keystore *store, const char *path, const unsigned char *key)
+{ // Map the key store "path" read-write and shared, after checking its format and the tag of its header under key (SIKE_KEYSTORE_KEYBYTES
+  // bytes) (POSIX only). Returns 0 on success, 1 if the store is missing or damaged, or if it was written with another key, by another library
+  // variant or with another byte order.
+#if defined(__NIX__)
+    keystore_header expected;
+    const keystore_header *header;
+    unsigned char tag[KEYSTORE_TAGBYTES];
+    unsigned char *map;
+    struct stat st;
+    int fd;
+
+    memset(store, 0, sizeof(sike_keystore));
+    fd = open(path, O_RDWR);
+    if (fd < 0) return 1;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < KEYSTORE_HEADER_BYTES) {
+        close(fd);
+        return 1;
+    }
+    map = (unsigned char*)mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return 1;
+
+    header = (const keystore_header*)map;
+    keystore_header_tag(tag, header, key);
+    if (keystore_prefix(&expected, header->count) != (size_t)st.st_size || memcmp(header, &expected, offsetof(keystore_header, nonce)) != 0 ||
+        ct_compare(tag, header->tag, KEYSTORE_TAGBYTES) != 0) {
+        munmap(map, (size_t)st.st_size);
+        return 1;
+    }
+    store->map = map;
+    store->bytes = (size_t)st.st_size;
+    store->count = header->count;
+    store->next = 0;
+    memcpy(store->key, key, SIKE_KEYSTORE_KEYBYTES);
+    return 0;
+#else
+    UNREFERENCED_PARAMETER(store);
+    UNREFERENCED_PARAMETER(path);
+    UNREFERENCED_PARAMETER(key);
+    return 1;
+#endif
+}
+
+
+int crypto_kem_keystore_take(sike_keystore *store, unsigned char *pk, unsigned char *sk, unsigned char *epk)
+{ // Take the next key pair of an open store: its public key pk, its secret key sk and, if epk is not NULL, its expanded public key
+  // (CRYPTO_EXPANDEDPKBYTES bytes, see crypto_kem_enc_expanded). Its slot is erased and written back to the file before returning, so that
+  // it is never taken again. Several threads can take key pairs from the same store. Returns 0 on success, SIKE_KEYSTORE_EMPTY if the store
+  // has no key pair left, or SIKE_KEYSTORE_CORRUPT if the slot fails its integrity check, in which case it is erased as well and the next
+  // call moves on to the following slot.
+#if defined(__NIX__)
+    const keystore_header *header = (const keystore_header*)store->map;
+    digit_t words[KEYSTORE_WORDS(KEYSTORE_DATABYTES)];
+    unsigned char *data = (unsigned char*)words, tag[KEYSTORE_TAGBYTES];
+    f2elm_t PKB[4];
+    unsigned int i;
+    int status = SIKE_KEYSTORE_CORRUPT;
+
+    if (store->map == NULL) return SIKE_KEYSTORE_EMPTY;
+    for (i = __atomic_load_n(&store->next, __ATOMIC_RELAXED); i < store->count; i++) {
+        keystore_slot *slot = keystore_get_slot(store->map, i);
+        uint64_t live = KEYSTORE_LIVE;
+
+        if (!__atomic_compare_exchange_n(&slot->state, &live, KEYSTORE_TAKEN, 0, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) continue;
+        keystore_slot_tag(tag, slot, store->key, header->nonce, i);
+        if (slot->index == i && ct_compare(tag, slot->tag, KEYSTORE_TAGBYTES) == 0) {
+            memcpy(data, slot->data, KEYSTORE_DATABYTES);
+            keystore_crypt(data, store->key, header->nonce, i);
+            memcpy(sk, data, CRYPTO_SECRETKEYBYTES);
+            memcpy(pk, data + MSG_BYTES + SECRETKEY_B_BYTES, CRYPTO_PUBLICKEYBYTES);
+            if (epk != NULL) {
+                fp2_decode(pk, PKB[0]);
+                fp2_decode(pk + FP2_ENCODED_BYTES, PKB[1]);
+                fp2_decode(pk + 2*FP2_ENCODED_BYTES, PKB[2]);
+                fp2_decode(data + CRYPTO_SECRETKEYBYTES, PKB[3]);
+                memcpy(epk, PKB, sizeof(PKB));
+            }
+            clear_words((void*)words, KEYSTORE_WORDS(KEYSTORE_DATABYTES));
+            status = 0;
+        }
+        keystore_erase_slot(slot);
+        __atomic_store_n(&store->next, i + 1, __ATOMIC_RELAXED);    // Hint for the next search
+        return status;
+    }
+    __atomic_store_n(&store->next, store->count, __ATOMIC_RELAXED);
+    return SIKE_KEYSTORE_EMPTY;
+#else
+    UNREFERENCED_PARAMETER(store);
+    UNREFERENCED_PARAMETER(pk);
+    UNREFERENCED_PARAMETER(sk);
+    UNREFERENCED_PARAMETER(epk);
+    return SIKE_KEYSTORE_EMPTY;
+#endif
+}
+
+
+unsigned int crypto_kem_keystore_remaining(const sike_keystore *store)
+{ // Number of key pairs left in an open store, which accounts for those taken by other processes
+    unsigned int remaining = 0;
+
+#if defined(__NIX__)
+    for (unsigned int i = 0; store->map != NULL && i < store->count; i++) {
+        if (__atomic_load_n(&keystore_get_slot(store->map, i)->state, __ATOMIC_RELAXED) == KEYSTORE_LIVE) remaining++;
+    }
+#else
+    UNREFERENCED_PARAMETER(store);
+#endif
+    return remaining;
+}
+
+
+void crypto_kem_keystore_close(sike_keystore *store)
+{ // Unmap a store and erase its key
+#if defined(__NIX__)
+    if (store->map != NULL) munmap(store->map, store->bytes);
+#endif
+    clear_words((void*)store, sizeof(sike_keystore)/sizeof(digit_t));
+}
@@ -0,0 +1,33 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/PQCrypto-SIDH
+* Released under MIT license
+*
+* Abstract: persistent store of KEM key pairs (POSIX only)
+*********************************************************************************************/
+
+#ifndef KEYSTORE_H
+#define KEYSTORE_H
+
+#include <stddef.h>
+
+
+#define SIKE_KEYSTORE_KEYBYTES    32    // Size of the key that encrypts a store
+
+// Return values of crypto_kem_keystore_take_SIKEpXXX other than 0
+#define SIKE_KEYSTORE_EMPTY        1    // No key pair left, or the store is not open
+#define SIKE_KEYSTORE_CORRUPT      2    // The slot of the next key pair failed its integrity check and was erased
+
+// Key store opened by crypto_kem_keystore_open_SIKEpXXX. Its members are private to the library.
+typedef struct {
+    unsigned char *map;                 // Shared mapping of the store
+    size_t bytes;
+    unsigned int count;                 // Number of slots
+    unsigned int next;                  // The slots before "next" have been taken
+    unsigned char key[SIKE_KEYSTORE_KEYBYTES];
+} sike_keystore;
+
+
+#endif
@@ -0,0 +1,54 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/PQCrypto-SIDH
+* Released under MIT license
+*
+* Abstract: field operation counts (library built with OPCOUNT=TRUE)
+*********************************************************************************************/
+
+#ifndef OPCOUNT_H
+#define OPCOUNT_H
+
+#include <stdint.h>
+
+
+// Top-level calls and compression stages for which the field operations are accumulated.
+// Nested calls are also counted by their callers, e.g., crypto_kem_keypair includes EphemeralKeyGeneration_B (or _A with compression).
+typedef enum {
+    OPCOUNT_KEYGEN_A,              // EphemeralKeyGeneration_A
+    OPCOUNT_KEYGEN_B,              // EphemeralKeyGeneration_B
+    OPCOUNT_AGREEMENT_A,           // EphemeralSecretAgreement_A
+    OPCOUNT_AGREEMENT_B,           // EphemeralSecretAgreement_B
+    OPCOUNT_KEM_KEYPAIR,           // crypto_kem_keypair
+    OPCOUNT_KEM_ENC,               // crypto_kem_enc
+    OPCOUNT_KEM_DEC,               // crypto_kem_dec
+    OPCOUNT_BASIS,                 // Compression: torsion basis generation
+    OPCOUNT_PAIRINGS,              // Compression: Tate pairings
+    OPCOUNT_DLOGS,                 // Compression: discrete logarithms
+    OPCOUNT_COMPRESS,              // Compression: coefficients of the compressed public key
+    OPCOUNT_DECOMPRESS,            // Compression: public key decompression
+    OPCOUNT_NCALLS
+} opcount_call;
+
+// Number of calls and of field operations executed by them. Each function counts its own invocations, including those made by
+// other counted functions: e.g., fp2mul_mont adds 1 to fp2_mul and 3 to mp_mul and 2 to rdc, inversions add their multiplications.
+typedef struct {
+    uint64_t calls;
+    uint64_t fp_mul;               // fpmul_mont
+    uint64_t fp_sqr;               // fpsqr_mont
+    uint64_t fp_add;               // fpadd
+    uint64_t fp_sub;               // fpsub
+    uint64_t fp_inv;               // fpinv_mont, fpinv_mont_bingcd
+    uint64_t fp2_mul;              // fp2mul_mont
+    uint64_t fp2_sqr;              // fp2sqr_mont
+    uint64_t fp2_add;              // fp2add
+    uint64_t fp2_sub;              // fp2sub
+    uint64_t fp2_inv;              // fp2inv_mont, fp2inv_mont_bingcd
+    uint64_t mp_mul;               // Integer multiplications and squarings of field elements (excluding the fused MULX/ADX kernels)
+    uint64_t rdc;                  // Montgomery reductions, rdc_mont (idem)
+} opcount_t;
+
+
+#endif
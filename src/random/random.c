@@ -1,10 +1,12 @@
 /********************************************************************************************
 * Hardware-based random number generation function
 *
-* It uses /dev/urandom in Linux and CNG's BCryptGenRandom function in Windows
+* It uses /dev/urandom in Linux and CNG's BCryptGenRandom function in Windows, unless the calling
+* thread has set its own source with randombytes_swap_source
 *********************************************************************************************/ 
 
 #include "random.h"
+#include "../config.h"
 #include <stdlib.h>
 #if defined(__WINDOWS__)
     #include <windows.h>
@@ -18,10 +20,25 @@
 #define passed 0 
 #define failed 1
 
+static THREAD_LOCAL randombytes_source source;
+
+
+randombytes_source randombytes_swap_source(randombytes_source new_source)
+{ // Replace the source of random bytes of the calling thread
+    randombytes_source previous = source;
+
+    source = new_source;
+    return previous;
+}
+
 
 int randombytes(unsigned char* random_array, unsigned long long nbytes)
 { // Generation of "nbytes" of random values
     
+    if (source.fn != NULL) {
+        return (source.fn(source.state, random_array, nbytes) == 0) ? passed : failed;
+    }
+
 #if defined(__WINDOWS__)   
     if (!BCRYPT_SUCCESS(BCryptGenRandom(NULL, random_array, (unsigned long)nbytes, BCRYPT_USE_SYSTEM_PREFERRED_RNG))) {
         return failed;
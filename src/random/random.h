@@ -2,8 +2,19 @@
 #define RANDOM_H
 
 
+// Source of random bytes: writes "nbytes" random bytes to random_array and returns 0 on success
+typedef struct {
+    int (*fn)(void *state, unsigned char *random_array, unsigned long long nbytes);
+    void *state;
+} randombytes_source;
+
+
 // Generate random bytes and output the result to random_array
 int randombytes(unsigned char* random_array, unsigned long long nbytes);
 
+// Replace the source of random bytes of the calling thread and return the previous one. 
+// A source with fn = NULL selects the system generator, which is the initial source of every thread.
+randombytes_source randombytes_swap_source(randombytes_source source);
+
 
 #endif
\ No newline at end of file
@@ -56,6 +56,8 @@ int EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* Pu
     unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_ALICE], npts = 0, ii = 0;
     digit_t SecretKeyA[NWORDS_ORDER] = {0};
 
+    OPCOUNT_SCOPE(OPCOUNT_KEYGEN_A);
+    USDT_SCOPE(OPCOUNT_KEYGEN_A);
     // Initialize basis points
     init_basis((digit_t*)A_gen, XPA, XQA, XRA);
     init_basis((digit_t*)B_gen, phiP->X, phiQ->X, phiR->X);
@@ -74,6 +76,7 @@ int EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* Pu
     decode_to_digits(PrivateKeyA, SecretKeyA, SECRETKEY_A_BYTES, NWORDS_ORDER);
     LADDER3PT(XPA, XQA, XRA, SecretKeyA, ALICE, R, A);       
 
+    STATS_BEGIN(SIKE_PHASE_TRAVERSAL);
 #if (OALICE_BITS % 2 == 1)
     point_proj_t S;
 
@@ -116,6 +119,8 @@ int EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* Pu
     eval_4_isog(phiQ, coeff);
     eval_4_isog(phiR, coeff);
 
+    STATS_END(SIKE_PHASE_TRAVERSAL);
+    STATS_BEGIN(SIKE_PHASE_JINV);
     inv_3_way(phiP->Z, phiQ->Z, phiR->Z);
     fp2mul_mont(phiP->X, phiP->Z, phiP->X);
     fp2mul_mont(phiQ->X, phiQ->Z, phiQ->X);
@@ -125,6 +130,7 @@ int EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* Pu
     fp2_encode(phiP->X, PublicKeyA);
     fp2_encode(phiQ->X, PublicKeyA + FP2_ENCODED_BYTES);
     fp2_encode(phiR->X, PublicKeyA + 2*FP2_ENCODED_BYTES);
+    STATS_END(SIKE_PHASE_JINV);
 
     return 0;
 }
@@ -139,6 +145,8 @@ int EphemeralKeyGeneration_B(const unsigned char* PrivateKeyB, unsigned char* Pu
     unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_BOB], npts = 0, ii = 0;
     digit_t SecretKeyB[NWORDS_ORDER] = {0};
 
+    OPCOUNT_SCOPE(OPCOUNT_KEYGEN_B);
+    USDT_SCOPE(OPCOUNT_KEYGEN_B);
     // Initialize basis points
     init_basis((digit_t*)B_gen, XPB, XQB, XRB);
     init_basis((digit_t*)A_gen, phiP->X, phiQ->X, phiR->X);
@@ -158,6 +166,7 @@ int EphemeralKeyGeneration_B(const unsigned char* PrivateKeyB, unsigned char* Pu
     LADDER3PT(XPB, XQB, XRB, SecretKeyB, BOB, R, A);
     
     // Traverse tree
+    STATS_BEGIN(SIKE_PHASE_TRAVERSAL);
     index = 0;  
     for (row = 1; row < MAX_Bob; row++) {
         while (index < MAX_Bob-row) {
@@ -188,6 +197,8 @@ int EphemeralKeyGeneration_B(const unsigned char* PrivateKeyB, unsigned char* Pu
     eval_3_isog(phiQ, coeff);
     eval_3_isog(phiR, coeff);
 
+    STATS_END(SIKE_PHASE_TRAVERSAL);
+    STATS_BEGIN(SIKE_PHASE_JINV);
     inv_3_way(phiP->Z, phiQ->Z, phiR->Z);
     fp2mul_mont(phiP->X, phiP->Z, phiP->X);
     fp2mul_mont(phiQ->X, phiQ->Z, phiQ->X);
@@ -197,38 +208,30 @@ int EphemeralKeyGeneration_B(const unsigned char* PrivateKeyB, unsigned char* Pu
     fp2_encode(phiP->X, PublicKeyB);
     fp2_encode(phiQ->X, PublicKeyB + FP2_ENCODED_BYTES);
     fp2_encode(phiR->X, PublicKeyB + 2*FP2_ENCODED_BYTES);
+    STATS_END(SIKE_PHASE_JINV);
 
     return 0;
 }
 
 
-int EphemeralSecretAgreement_A(const unsigned char* PrivateKeyA, const unsigned char* PublicKeyB, unsigned char* SharedSecretA)
-{ // Alice's ephemeral shared secret computation
-  // It produces a shared secret key SharedSecretA using her secret key PrivateKeyA and Bob's public key PublicKeyB
-  // Inputs: Alice's PrivateKeyA is an integer in the range [0, oA-1]. 
-  //         Bob's PublicKeyB consists of 3 elements in GF(p^2) encoded by removing leading 0 bytes.
-  // Output: a shared secret SharedSecretA that consists of one element in GF(p^2) encoded by removing leading 0 bytes.  
+static void SecretAgreement_A(const unsigned char* PrivateKeyA, const f2elm_t* PKB, unsigned char* SharedSecretA)
+{ // Alice's shared secret computation from Bob's decoded public key PKB = {x(P), x(Q), x(P-Q), A}, A being the coefficient of its curve
     point_proj_t R, pts[MAX_INT_POINTS_ALICE];
-    f2elm_t coeff[3], PKB[3], jinv;
-    f2elm_t A24plus = {0}, C24 = {0}, A = {0};
+    f2elm_t coeff[3], jinv;
+    f2elm_t A24plus = {0}, C24 = {0};
     unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_ALICE], npts = 0, ii = 0;
     digit_t SecretKeyA[NWORDS_ORDER] = {0};
-      
-    // Initialize images of Bob's basis
-    fp2_decode(PublicKeyB, PKB[0]);
-    fp2_decode(PublicKeyB + FP2_ENCODED_BYTES, PKB[1]);
-    fp2_decode(PublicKeyB + 2*FP2_ENCODED_BYTES, PKB[2]);
 
     // Initialize constants: A24plus = A+2C, C24 = 4C, where C=1
-    get_A(PKB[0], PKB[1], PKB[2], A);
     mp_add((digit_t*)&Montgomery_one, (digit_t*)&Montgomery_one, C24[0], NWORDS_FIELD);
-    mp2_add(A, C24, A24plus);
+    mp2_add(PKB[3], C24, A24plus);
     mp_add(C24[0], C24[0], C24[0], NWORDS_FIELD);
 
     // Retrieve kernel point
     decode_to_digits(PrivateKeyA, SecretKeyA, SECRETKEY_A_BYTES, NWORDS_ORDER);
-    LADDER3PT(PKB[0], PKB[1], PKB[2], SecretKeyA, ALICE, R, A);    
+    LADDER3PT(PKB[0], PKB[1], PKB[2], SecretKeyA, ALICE, R, PKB[3]);    
 
+    STATS_BEGIN(SIKE_PHASE_TRAVERSAL);
 #if (OALICE_BITS % 2 == 1)
     point_proj_t S;
 
@@ -264,9 +267,31 @@ int EphemeralSecretAgreement_A(const unsigned char* PrivateKeyA, const unsigned
     mp2_add(A24plus, A24plus, A24plus);                                                
     fp2sub(A24plus, C24, A24plus); 
     fp2add(A24plus, A24plus, A24plus);                    
+    STATS_END(SIKE_PHASE_TRAVERSAL);
+    STATS_BEGIN(SIKE_PHASE_JINV);
     j_inv(A24plus, C24, jinv);
     fp2_encode(jinv, SharedSecretA);    // Format shared secret
+    STATS_END(SIKE_PHASE_JINV);
+}
 
+
+int EphemeralSecretAgreement_A(const unsigned char* PrivateKeyA, const unsigned char* PublicKeyB, unsigned char* SharedSecretA)
+{ // Alice's ephemeral shared secret computation
+  // It produces a shared secret key SharedSecretA using her secret key PrivateKeyA and Bob's public key PublicKeyB
+  // Inputs: Alice's PrivateKeyA is an integer in the range [0, oA-1]. 
+  //         Bob's PublicKeyB consists of 3 elements in GF(p^2) encoded by removing leading 0 bytes.
+  // Output: a shared secret SharedSecretA that consists of one element in GF(p^2) encoded by removing leading 0 bytes.  
+    f2elm_t PKB[4] = {0};
+      
+    OPCOUNT_SCOPE(OPCOUNT_AGREEMENT_A);
+    USDT_SCOPE(OPCOUNT_AGREEMENT_A);
+    // Initialize images of Bob's basis and the coefficient A of his curve
+    fp2_decode(PublicKeyB, PKB[0]);
+    fp2_decode(PublicKeyB + FP2_ENCODED_BYTES, PKB[1]);
+    fp2_decode(PublicKeyB + 2*FP2_ENCODED_BYTES, PKB[2]);
+    get_A(PKB[0], PKB[1], PKB[2], PKB[3]);
+
+    SecretAgreement_A(PrivateKeyA, (const f2elm_t*)PKB, SharedSecretA);
     return 0;
 }
 
@@ -327,6 +352,8 @@ int EphemeralSecretAgreement_B_extended(const unsigned char* PrivateKeyB, const
     unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_BOB], npts = 0, ii = 0;
     digit_t SecretKeyB[NWORDS_ORDER] = {0};
       
+    OPCOUNT_SCOPE(OPCOUNT_AGREEMENT_B);
+    USDT_SCOPE(OPCOUNT_AGREEMENT_B);
     // Initialize images of Alice's basis
     fp2_decode(PublicKeyA, PKB[0]);
     fp2_decode(PublicKeyA + FP2_ENCODED_BYTES, PKB[1]);
@@ -340,7 +367,10 @@ int EphemeralSecretAgreement_B_extended(const unsigned char* PrivateKeyB, const
 
     if (sike == 1) {
 #if defined(PK_VALIDATION)  // Validation of public key
-        if (publickey_validation(PKB, A, A24plus, A24minus) == 1)
+        int invalid;
+
+        STATS_PHASE(SIKE_PHASE_VALIDATION, invalid = publickey_validation(PKB, A, A24plus, A24minus));
+        if (invalid == 1)
             return 1;
 #endif
     }
@@ -350,6 +380,7 @@ int EphemeralSecretAgreement_B_extended(const unsigned char* PrivateKeyB, const
     LADDER3PT(PKB[0], PKB[1], PKB[2], SecretKeyB, BOB, R, A);
     
     // Traverse tree
+    STATS_BEGIN(SIKE_PHASE_TRAVERSAL);
     index = 0;  
     for (row = 1; row < MAX_Bob; row++) {
         while (index < MAX_Bob-row) {
@@ -376,8 +407,11 @@ int EphemeralSecretAgreement_B_extended(const unsigned char* PrivateKeyB, const
     fp2add(A24plus, A24minus, A);                 
     fp2add(A, A, A);
     fp2sub(A24plus, A24minus, A24plus);                   
+    STATS_END(SIKE_PHASE_TRAVERSAL);
+    STATS_BEGIN(SIKE_PHASE_JINV);
     j_inv(A, A24plus, jinv);
     fp2_encode(jinv, SharedSecretB);    // Format shared secret
+    STATS_END(SIKE_PHASE_JINV);
 
     return 0;
 }
@@ -10,6 +10,7 @@
 
 #include <string.h>
 #include "sha3/fips202.h"
+#include "ctx/sike_ctx.h"
 
 #ifdef DO_VALGRIND_CHECK
 #include <valgrind/memcheck.h>
@@ -20,10 +21,27 @@ int crypto_kem_keypair(unsigned char *pk, unsigned char *sk)
 { // SIKE's key generation
   // Outputs: secret key sk (CRYPTO_SECRETKEYBYTES = MSG_BYTES + SECRETKEY_B_BYTES + CRYPTO_PUBLICKEYBYTES bytes)
   //          public key pk (CRYPTO_PUBLICKEYBYTES bytes) 
+    digit_t coins[NBYTES_TO_NWORDS(CRYPTO_KEYPAIRCOINBYTES)];    // s||SK, in words to be cleared
+    int ret = 1;
+
+    if (randombytes((unsigned char*)coins, MSG_BYTES) == 0 && random_mod_order_B((unsigned char*)coins + MSG_BYTES) == 0)
+        ret = crypto_kem_keypair_derand(pk, sk, (unsigned char*)coins);
+    clear_words((void*)coins, NBYTES_TO_NWORDS(CRYPTO_KEYPAIRCOINBYTES));
+    return ret;
+}
+
+
+int crypto_kem_keypair_derand(unsigned char *pk, unsigned char *sk, const unsigned char *coins)
+{ // SIKE's key generation with the random bytes given by the caller
+  // Input:   coins s||SK           (CRYPTO_KEYPAIRCOINBYTES = MSG_BYTES + SECRETKEY_B_BYTES bytes)
+  // Outputs: secret key sk (CRYPTO_SECRETKEYBYTES = MSG_BYTES + SECRETKEY_B_BYTES + CRYPTO_PUBLICKEYBYTES bytes)
+  //          public key pk (CRYPTO_PUBLICKEYBYTES bytes) 
+    OPCOUNT_SCOPE(OPCOUNT_KEM_KEYPAIR);
+    USDT_SCOPE(OPCOUNT_KEM_KEYPAIR);
 
     // Generate lower portion of secret key sk <- s||SK
-    if (randombytes(sk, MSG_BYTES) != 0 || random_mod_order_B(sk + MSG_BYTES) != 0)
-        return 1;
+    memcpy(sk, coins, MSG_BYTES + SECRETKEY_B_BYTES);
+    sk[MSG_BYTES + SECRETKEY_B_BYTES - 1] &= MASK_BOB;    // Masking last byte as in random_mod_order_B
 #ifdef DO_VALGRIND_CHECK
     VALGRIND_MAKE_MEM_UNDEFINED(sk, MSG_BYTES + SECRETKEY_B_BYTES);
 #endif
@@ -46,32 +64,49 @@ int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk
   // Input:   public key pk         (CRYPTO_PUBLICKEYBYTES bytes)
   // Outputs: shared secret ss      (CRYPTO_BYTES bytes)
   //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = CRYPTO_PUBLICKEYBYTES + MSG_BYTES bytes)
+    digit_t coins[NBYTES_TO_NWORDS(CRYPTO_ENCCOINBYTES)];    // m, in words to be cleared
+    int ret = 1;
+
+    if (randombytes((unsigned char*)coins, MSG_BYTES) == 0)
+        ret = crypto_kem_enc_derand(ct, ss, pk, (unsigned char*)coins);
+    clear_words((void*)coins, NBYTES_TO_NWORDS(CRYPTO_ENCCOINBYTES));
+    return ret;
+}
+
+
+static int kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk, const f2elm_t *epk, const unsigned char *coins)
+{ // SIKE's encapsulation with the random bytes given by the caller, and with the decoded public key epk = {x(P), x(Q), x(P-Q), A} if it is not NULL
     unsigned char ephemeralsk[SECRETKEY_A_BYTES];
     unsigned char jinvariant[FP2_ENCODED_BYTES];
     unsigned char h[MSG_BYTES];
     unsigned char temp[CRYPTO_CIPHERTEXTBYTES+MSG_BYTES];
 
+    OPCOUNT_SCOPE(OPCOUNT_KEM_ENC);
+    USDT_SCOPE(OPCOUNT_KEM_ENC);
     // Generate ephemeralsk <- G(m||pk) mod oA 
-    if (randombytes(temp, MSG_BYTES) != 0)
-        return 1;
+    memcpy(temp, coins, MSG_BYTES);
 #ifdef DO_VALGRIND_CHECK
     VALGRIND_MAKE_MEM_UNDEFINED(temp, MSG_BYTES);
 #endif
     memcpy(&temp[MSG_BYTES], pk, CRYPTO_PUBLICKEYBYTES);
-    shake256(ephemeralsk, SECRETKEY_A_BYTES, temp, CRYPTO_PUBLICKEYBYTES+MSG_BYTES);
+    STATS_PHASE(SIKE_PHASE_HASH, shake256(ephemeralsk, SECRETKEY_A_BYTES, temp, CRYPTO_PUBLICKEYBYTES+MSG_BYTES));
     ephemeralsk[SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
 
     // Encrypt
     EphemeralKeyGeneration_A(ephemeralsk, ct);
-    EphemeralSecretAgreement_A(ephemeralsk, pk, jinvariant);
-    shake256(h, MSG_BYTES, jinvariant, FP2_ENCODED_BYTES);
+    if (epk == NULL) {
+        EphemeralSecretAgreement_A(ephemeralsk, pk, jinvariant);
+    } else {
+        SecretAgreement_A(ephemeralsk, epk, jinvariant);
+    }
+    STATS_PHASE(SIKE_PHASE_HASH, shake256(h, MSG_BYTES, jinvariant, FP2_ENCODED_BYTES));
     for (int i = 0; i < MSG_BYTES; i++) {
         ct[i + CRYPTO_PUBLICKEYBYTES] = temp[i] ^ h[i];
     }
 
     // Generate shared secret ss <- H(m||ct)
     memcpy(&temp[MSG_BYTES], ct, CRYPTO_CIPHERTEXTBYTES);
-    shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES+MSG_BYTES);
+    STATS_PHASE(SIKE_PHASE_HASH, shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES+MSG_BYTES));
 
 #ifdef DO_VALGRIND_CHECK
     VALGRIND_MAKE_MEM_DEFINED(temp, MSG_BYTES);
@@ -80,6 +115,52 @@ int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk
 }
 
 
+int crypto_kem_enc_derand(unsigned char *ct, unsigned char *ss, const unsigned char *pk, const unsigned char *coins)
+{ // SIKE's encapsulation with the random bytes given by the caller
+  // Input:   public key pk         (CRYPTO_PUBLICKEYBYTES bytes)
+  //          coins m               (CRYPTO_ENCCOINBYTES = MSG_BYTES bytes)
+  // Outputs: shared secret ss      (CRYPTO_BYTES bytes)
+  //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = CRYPTO_PUBLICKEYBYTES + MSG_BYTES bytes)
+    return kem_enc(ct, ss, pk, NULL, coins);
+}
+
+
+int crypto_kem_expand_pk(unsigned char *epk, const unsigned char *pk)
+{ // Expanded public key: the elements of pk and the coefficient A of its curve in the internal representation
+  // Input:   public key pk          (CRYPTO_PUBLICKEYBYTES bytes)
+  // Output:  expanded public key epk (CRYPTO_EXPANDEDPKBYTES bytes)
+    f2elm_t PKB[4];
+    unsigned char a[FP2_ENCODED_BYTES];
+
+    fp2_decode(pk, PKB[0]);
+    fp2_decode(pk + FP2_ENCODED_BYTES, PKB[1]);
+    fp2_decode(pk + 2*FP2_ENCODED_BYTES, PKB[2]);
+    get_A(PKB[0], PKB[1], PKB[2], PKB[3]);
+    fp2_encode(PKB[3], a);                 // Same representation of A as in a key store
+    fp2_decode(a, PKB[3]);
+    memcpy(epk, PKB, sizeof(PKB));
+    return 0;
+}
+
+
+int crypto_kem_enc_expanded(unsigned char *ct, unsigned char *ss, const unsigned char *pk, const unsigned char *epk)
+{ // SIKE's encapsulation with the expanded public key epk of pk, which saves its decoding and the computation of A
+  // Input:   public key pk          (CRYPTO_PUBLICKEYBYTES bytes)
+  //          expanded public key epk (CRYPTO_EXPANDEDPKBYTES bytes, from crypto_kem_expand_pk(epk, pk))
+  // Outputs: shared secret ss       (CRYPTO_BYTES bytes)
+  //          ciphertext message ct  (CRYPTO_CIPHERTEXTBYTES bytes)
+    digit_t coins[NBYTES_TO_NWORDS(CRYPTO_ENCCOINBYTES)];    // m, in words to be cleared
+    f2elm_t PKB[4];
+    int ret = 1;
+
+    memcpy(PKB, epk, sizeof(PKB));    // epk has no alignment requirement
+    if (randombytes((unsigned char*)coins, MSG_BYTES) == 0)
+        ret = kem_enc(ct, ss, pk, (const f2elm_t*)PKB, (unsigned char*)coins);
+    clear_words((void*)coins, NBYTES_TO_NWORDS(CRYPTO_ENCCOINBYTES));
+    return ret;
+}
+
+
 int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk)
 { // SIKE's decapsulation
   // Input:   secret key sk         (CRYPTO_SECRETKEYBYTES = MSG_BYTES + SECRETKEY_B_BYTES + CRYPTO_PUBLICKEYBYTES bytes)
@@ -91,6 +172,10 @@ int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned ch
     unsigned char c0_[CRYPTO_PUBLICKEYBYTES];
     unsigned char temp[CRYPTO_CIPHERTEXTBYTES+MSG_BYTES];
     int8_t selector = -1;
+
+    OPCOUNT_SCOPE(OPCOUNT_KEM_DEC);
+    USDT_SCOPE(OPCOUNT_KEM_DEC);
+
 #ifdef DO_VALGRIND_CHECK
     VALGRIND_MAKE_MEM_UNDEFINED(sk, MSG_BYTES + SECRETKEY_B_BYTES);
     VALGRIND_MAKE_MEM_DEFINED(ct, CRYPTO_CIPHERTEXTBYTES);
@@ -103,14 +188,14 @@ int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned ch
 #ifdef DO_VALGRIND_CHECK
     VALGRIND_MAKE_MEM_UNDEFINED(ct, CRYPTO_CIPHERTEXTBYTES);
 #endif
-    shake256(h_, MSG_BYTES, jinvariant_, FP2_ENCODED_BYTES);
+    STATS_PHASE(SIKE_PHASE_HASH, shake256(h_, MSG_BYTES, jinvariant_, FP2_ENCODED_BYTES));
     for (int i = 0; i < MSG_BYTES; i++) {
         temp[i] = ct[i + CRYPTO_PUBLICKEYBYTES] ^ h_[i];
     }
 
     // Generate ephemeralsk_ <- G(m||pk) mod oA
     memcpy(&temp[MSG_BYTES], &sk[MSG_BYTES + SECRETKEY_B_BYTES], CRYPTO_PUBLICKEYBYTES);
-    shake256(ephemeralsk_, SECRETKEY_A_BYTES, temp, CRYPTO_PUBLICKEYBYTES+MSG_BYTES);
+    STATS_PHASE(SIKE_PHASE_HASH, shake256(ephemeralsk_, SECRETKEY_A_BYTES, temp, CRYPTO_PUBLICKEYBYTES+MSG_BYTES));
     ephemeralsk_[SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
     
     // Generate shared secret ss <- H(m||ct), or output ss <- H(s||ct) in case of ct verification failure
@@ -120,11 +205,17 @@ int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned ch
 Hashing:
     ct_cmov(temp, sk, MSG_BYTES, selector);
     memcpy(&temp[MSG_BYTES], ct, CRYPTO_CIPHERTEXTBYTES);
-    shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES+MSG_BYTES);
+    STATS_PHASE(SIKE_PHASE_HASH, shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES+MSG_BYTES));
     
 #ifdef DO_VALGRIND_CHECK
     VALGRIND_MAKE_MEM_DEFINED(sk, MSG_BYTES + SECRETKEY_B_BYTES);
     VALGRIND_MAKE_MEM_DEFINED(ct, CRYPTO_CIPHERTEXTBYTES);
 #endif
     return 0;
-}
\ No newline at end of file
+}
+
+
+// Parameter-set descriptor of the context interface
+const sike_scheme kem_scheme = {CRYPTO_ALGNAME, CRYPTO_SECRETKEYBYTES, CRYPTO_PUBLICKEYBYTES, CRYPTO_CIPHERTEXTBYTES, CRYPTO_BYTES, 0,
+                                crypto_kem_keypair, crypto_kem_enc, crypto_kem_dec, NULL, NULL,
+                                CRYPTO_KEYPAIRCOINBYTES, CRYPTO_ENCCOINBYTES, crypto_kem_keypair_derand, crypto_kem_enc_derand, NULL};
\ No newline at end of file
@@ -0,0 +1,39 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/PQCrypto-SIDH
+* Released under MIT license
+*
+* Abstract: per-phase timers
+*********************************************************************************************/
+
+#ifndef SIKE_STATS_H
+#define SIKE_STATS_H
+
+#include <stdint.h>
+
+
+// Phases of the key generation, shared secret and KEM functions that are timed when the timers are enabled.
+// The phases do not overlap, e.g., the ladder of a public key decompression is not counted in the decompression time.
+typedef enum {
+    SIKE_PHASE_LADDER,             // Three-point ladders computing the isogeny kernels
+    SIKE_PHASE_TRAVERSAL,          // Traversal of the isogeny tree
+    SIKE_PHASE_VALIDATION,         // Public key validation
+    SIKE_PHASE_JINV,               // j-invariant or normalization of the public key, and encoding
+    SIKE_PHASE_HASH,               // SHAKE256 hashing of the KEM
+    SIKE_PHASE_BASIS,              // Compression: torsion basis generation
+    SIKE_PHASE_PAIRINGS,           // Compression: Tate pairings
+    SIKE_PHASE_DLOGS,              // Compression: discrete logarithms
+    SIKE_PHASE_NPHASES
+} sike_phase;
+
+// Number of executions and time spent in each phase by a thread. The time is given in ticks of the timestamp counter:
+// cycles of the TSC on x86 and x64, ticks of the virtual counter cntvct_el0 on ARMv8 and nanoseconds on other Unix-like platforms.
+typedef struct {
+    uint64_t calls[SIKE_PHASE_NPHASES];
+    uint64_t ticks[SIKE_PHASE_NPHASES];
+} sike_stats_t;
+
+
+#endif
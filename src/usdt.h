@@ -0,0 +1,59 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/PQCrypto-SIDH
+* Released under MIT license
+*
+* Abstract: statically defined tracepoints (library built with USDT=TRUE)
+*********************************************************************************************/
+
+#ifndef USDT_H
+#define USDT_H
+
+#include <stdint.h>
+
+
+// Probes in the format of systemtap's <sys/sdt.h> (version 3 notes in the ELF section .note.stapsdt), to which perf, bpftrace
+// and bcc attach as usdt:<binary>:provider:name. A probe is a nop whose address and argument locations are recorded in the note,
+// so that a probe costs one nop and the evaluation of its arguments when no tracer is attached. x64 and ARMv8 ELF targets only.
+// Arguments: a1 (int), a2 (uint64_t, passed in a register since thread-local operands are not understood by the tracers) and a3 (int).
+// Each probe has a semaphore, a counter in the section .probes that the tracers increment while they are attached to the probe,
+// so that work done only for the tracers can be skipped otherwise (USDT_ACTIVE). It is defined once per translation unit by
+// USDT_SEMAPHORE.
+
+#define USDT_STR(x)    #x
+
+#define USDT_SEMAPHORE(provider, name)                                                      \
+    static volatile unsigned short provider##_##name##_semaphore __attribute__((used, section(".probes")))
+
+#define USDT_ACTIVE(provider, name)    __builtin_expect(provider##_##name##_semaphore != 0, 0)
+
+#define USDT_PROBE3(provider, name, a1, a2, a3)                                             \
+    __asm__ __volatile__ (                                                                  \
+        "990: nop\n"                                                                        \
+        ".pushsection .note.stapsdt,\"?\",\"note\"\n"                                       \
+        ".balign 4\n"                                                                       \
+        ".4byte 992f-991f, 994f-993f, 3\n"                                                  \
+        "991: .asciz \"stapsdt\"\n"                                                         \
+        "992: .balign 4\n"                                                                  \
+        "993: .8byte 990b\n"                                                                \
+        ".8byte _.stapsdt.base\n"                                                           \
+        ".8byte " USDT_STR(provider) "_" USDT_STR(name) "_semaphore\n"                      \
+        ".asciz \"" USDT_STR(provider) "\"\n"                                               \
+        ".asciz \"" USDT_STR(name) "\"\n"                                                   \
+        ".asciz \"-4@%[usdt_a1] 8@%[usdt_a2] -4@%[usdt_a3]\"\n"                             \
+        "994: .balign 4\n"                                                                  \
+        ".popsection\n"                                                                     \
+        ".ifndef _.stapsdt.base\n"                                                          \
+        ".pushsection .stapsdt.base,\"aG\",\"progbits\",.stapsdt.base,comdat\n"             \
+        ".weak _.stapsdt.base\n"                                                            \
+        ".hidden _.stapsdt.base\n"                                                          \
+        "_.stapsdt.base: .space 1\n"                                                        \
+        ".size _.stapsdt.base, 1\n"                                                         \
+        ".popsection\n"                                                                     \
+        ".endif\n"                                                                          \
+        :: [usdt_a1] "nor" ((int)(a1)), [usdt_a2] "r" ((uint64_t)(a2)), [usdt_a3] "nor" ((int)(a3)))
+
+
+#endif
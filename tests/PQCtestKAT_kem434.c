@@ -35,6 +35,7 @@ main()
     int                 done;
     unsigned char       pk[CRYPTO_PUBLICKEYBYTES], sk[CRYPTO_SECRETKEYBYTES], pk_rsp[CRYPTO_PUBLICKEYBYTES], sk_rsp[CRYPTO_SECRETKEYBYTES];
     int                 ret_val;
+    unsigned char       keypair_coins[CRYPTO_KEYPAIRCOINBYTES], enc_coins[CRYPTO_ENCCOINBYTES];
     
     sprintf(fn_rsp, "KAT/PQCkemKAT_%d.rsp", CRYPTO_SECRETKEYBYTES);
     if ( (fp_rsp = fopen(fn_rsp, "r")) == NULL ) {
@@ -118,6 +119,22 @@ main()
             return KAT_CRYPTO_FAILURE;
         }
 
+        // Derandomized key generation and encapsulation, with the DRBG output read by crypto_kem_keypair (s, then SK) and crypto_kem_enc (m)
+        randombytes_init(seed, NULL, 256);
+        randombytes(keypair_coins, CRYPTO_ENCCOINBYTES);
+        randombytes(keypair_coins + CRYPTO_ENCCOINBYTES, CRYPTO_KEYPAIRCOINBYTES - CRYPTO_ENCCOINBYTES);
+        randombytes(enc_coins, CRYPTO_ENCCOINBYTES);
+        if ( (ret_val = crypto_kem_keypair_derand_SIKEp434(pk, sk, keypair_coins)) != 0 ||
+             (ret_val = crypto_kem_enc_derand_SIKEp434(ct, ss, pk, enc_coins)) != 0) {
+            printf("crypto_kem_keypair_derand or crypto_kem_enc_derand returned <%d>\n", ret_val);
+            return KAT_CRYPTO_FAILURE;
+        }
+        if (memcmp(pk, pk_rsp, CRYPTO_PUBLICKEYBYTES) != 0 || memcmp(sk, sk_rsp, CRYPTO_SECRETKEYBYTES) != 0 ||
+            memcmp(ct, ct_rsp, CRYPTO_CIPHERTEXTBYTES) != 0 || memcmp(ss, ss_rsp, CRYPTO_BYTES) != 0) {
+            printf("ERROR: derandomized outputs are different from <%s>\n", fn_rsp);
+            return KAT_VERIFICATION_ERROR;
+        }
+
     } while ( !done );
     
     fclose(fp_rsp);
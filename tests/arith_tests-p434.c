@@ -163,6 +163,11 @@ bool fp_test()
         fpmul434_mont(ma, ma, mc);                             // c = a*a 
         if (compare_words(mb, mc, NWORDS_FIELD)!=0) { passed=0; break; }
 
+        fpcopy434(ma, md); fpneg434(md);                       // d = 2*p434 - a, in [p434, 2*p434-1]
+        fpsqr434_mont(md, mb);                                 // b = d^2
+        fpmul434_mont(md, md, mc);                             // c = d*d 
+        if (compare_words(mb, mc, NWORDS_FIELD)!=0) { passed=0; break; }
+
         fpzero434(a); to_mont(a, ma);
         fpsqr434_mont(ma, md);                                 // d = 0^2 
         if (compare_words(ma, md, NWORDS_FIELD)!=0) { passed=0; break; }
@@ -396,6 +401,18 @@ bool fp_run()
     printf("  GF(p) multiplication runs in .................................... %7lld ", cycles/BENCH_LOOPS); print_unit;
     printf("\n");
 
+    // GF(p) squaring using p434
+    cycles = 0;
+    for (n=0; n<BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        fpsqr434_mont(a, c);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  GF(p) squaring runs in .......................................... %7lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
     // GF(p) inversion
     cycles = 0;
     for (n=0; n<SMALL_BENCH_LOOPS; n++)
@@ -163,6 +163,11 @@ bool fp_test()
         fpmul503_mont(ma, ma, mc);                             // c = a*a 
         if (compare_words(mb, mc, NWORDS_FIELD)!=0) { passed=0; break; }
 
+        fpcopy503(ma, md); fpneg503(md);                       // d = 2*p503 - a, in [p503, 2*p503-1]
+        fpsqr503_mont(md, mb);                                 // b = d^2
+        fpmul503_mont(md, md, mc);                             // c = d*d 
+        if (compare_words(mb, mc, NWORDS_FIELD)!=0) { passed=0; break; }
+
         fpzero503(a); to_mont(a, ma);
         fpsqr503_mont(ma, md);                                 // d = 0^2 
         if (compare_words(ma, md, NWORDS_FIELD)!=0) { passed=0; break; }
@@ -396,6 +401,18 @@ bool fp_run()
     printf("  GF(p) multiplication runs in .................................... %7lld ", cycles/BENCH_LOOPS); print_unit;
     printf("\n");
 
+    // GF(p) squaring using p503
+    cycles = 0;
+    for (n=0; n<BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        fpsqr503_mont(a, c);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  GF(p) squaring runs in .......................................... %7lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
     // GF(p) inversion
     cycles = 0;
     for (n=0; n<SMALL_BENCH_LOOPS; n++)
@@ -164,6 +164,11 @@ bool fp_test()
         fpmul610_mont(ma, ma, mc);                             // c = a*a 
         if (compare_words(mb, mc, NWORDS_FIELD)!=0) { passed=0; break; }
 
+        fpcopy610(ma, md); fpneg610(md);                       // d = 2*p610 - a, in [p610, 2*p610-1]
+        fpsqr610_mont(md, mb);                                 // b = d^2
+        fpmul610_mont(md, md, mc);                             // c = d*d 
+        if (compare_words(mb, mc, NWORDS_FIELD)!=0) { passed=0; break; }
+
         fpzero610(a); to_mont(a, ma);
         fpsqr610_mont(ma, md);                                 // d = 0^2 
         if (compare_words(ma, md, NWORDS_FIELD)!=0) { passed=0; break; }
@@ -397,6 +402,18 @@ bool fp_run()
     printf("  GF(p) multiplication runs in .................................... %7lld ", cycles/BENCH_LOOPS); print_unit;
     printf("\n");
 
+    // GF(p) squaring using p610
+    cycles = 0;
+    for (n=0; n<BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        fpsqr610_mont(a, c);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  GF(p) squaring runs in .......................................... %7lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
     // GF(p) inversion
     cycles = 0;
     for (n=0; n<SMALL_BENCH_LOOPS; n++)
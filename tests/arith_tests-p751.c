@@ -164,6 +164,11 @@ bool fp_test()
         fpmul751_mont(ma, ma, mc);                             // c = a*a 
         if (compare_words(mb, mc, NWORDS_FIELD)!=0) { passed=0; break; }
 
+        fpcopy751(ma, md); fpneg751(md);                       // d = 2*p751 - a, in [p751, 2*p751-1]
+        fpsqr751_mont(md, mb);                                 // b = d^2
+        fpmul751_mont(md, md, mc);                             // c = d*d 
+        if (compare_words(mb, mc, NWORDS_FIELD)!=0) { passed=0; break; }
+
         fpzero751(a); to_mont(a, ma);
         fpsqr751_mont(ma, md);                                 // d = 0^2 
         if (compare_words(ma, md, NWORDS_FIELD)!=0) { passed=0; break; }
@@ -398,6 +403,18 @@ bool fp_run()
     printf("  GF(p) multiplication runs in .................................... %7lld ", cycles/BENCH_LOOPS); print_unit;
     printf("\n");
 
+    // GF(p) squaring using p751
+    cycles = 0;
+    for (n=0; n<BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        fpsqr751_mont(a, c);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  GF(p) squaring runs in .......................................... %7lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
     // GF(p) reduction using p751
     cycles = 0;
     for (n=0; n<BENCH_LOOPS; n++)
@@ -0,0 +1,22 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/PQCrypto-SIDH
+* Released under MIT license
+*
+* Abstract: benchmark suite for SIDHp434 and SIKEp434
+*********************************************************************************************/ 
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../src/P434/P434.c"
+
+
+#define SCHEME_NAME       "SIKEp434"
+
+#define fprandom_test     fprandom434_test
+#define fp2random_test    fp2random434_test
+
+#include "bench_sike.c"
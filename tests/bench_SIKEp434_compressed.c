@@ -0,0 +1,22 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/PQCrypto-SIDH
+* Released under MIT license
+*
+* Abstract: benchmark suite for SIDHp434_compressed and SIKEp434_compressed
+*********************************************************************************************/ 
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../src/P434/P434_compressed.c"
+
+
+#define SCHEME_NAME       "SIKEp434_compressed"
+
+#define fprandom_test     fprandom434_test
+#define fp2random_test    fp2random434_test
+
+#include "bench_sike.c"
@@ -0,0 +1,22 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/PQCrypto-SIDH
+* Released under MIT license
+*
+* Abstract: benchmark suite for SIDHp503 and SIKEp503
+*********************************************************************************************/ 
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../src/P503/P503.c"
+
+
+#define SCHEME_NAME       "SIKEp503"
+
+#define fprandom_test     fprandom503_test
+#define fp2random_test    fp2random503_test
+
+#include "bench_sike.c"
@@ -0,0 +1,22 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/PQCrypto-SIDH
+* Released under MIT license
+*
+* Abstract: benchmark suite for SIDHp610 and SIKEp610
+*********************************************************************************************/ 
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../src/P610/P610.c"
+
+
+#define SCHEME_NAME       "SIKEp610"
+
+#define fprandom_test     fprandom610_test
+#define fp2random_test    fp2random610_test
+
+#include "bench_sike.c"
@@ -0,0 +1,22 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/PQCrypto-SIDH
+* Released under MIT license
+*
+* Abstract: benchmark suite for SIDHp751_compressed and SIKEp751_compressed
+*********************************************************************************************/ 
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../src/P751/P751_compressed.c"
+
+
+#define SCHEME_NAME       "SIKEp751_compressed"
+
+#define fprandom_test     fprandom751_test
+#define fp2random_test    fp2random751_test
+
+#include "bench_sike.c"
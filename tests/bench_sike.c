@@ -0,0 +1,1252 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/PQCrypto-SIDH
+* Released under MIT license
+*
+* Abstract: benchmark suite covering field arithmetic, curve/isogeny functions, compression,
+*           SIDH and SIKE. This file is included by the bench_XXX.c file of each library variant.
+*
+* Usage: sike_bench [--filter=substr[,substr...]] [--format=text|json|csv] [--no-header]
+*                   [--cpu=n] [--samples=n] [--warmup=n] [--list]
+*        sike_bench --threads=n [--duration=s] [--pin] [--smt=on|off] [--format=text|json|csv]
+*        sike_bench --cold=flush|thrash [--thrash-mb=n] [--hugepages] [other options of the first form]
+*        sike_bench --pages [--filter=...] [--format=text|json|csv]
+*        sike_bench --tables [--filter=...] [--format=text|json|csv]
+*        sike_bench --footprint [--filter=...] [--format=text|json|csv]
+*
+* With --threads, the throughput mode runs 1, 2, 4, ..., n threads doing keypair/enc/dec loops 
+* for a fixed duration each, and reports aggregate throughput, per-thread latencies and scaling
+* efficiency with respect to the single-thread run.
+*
+* With --tables, the sizes of the read-only tables are listed (--filter matches the table names). For the
+* compressed variants, this gives the memory side of the Pohlig-Hellman window sizes W_2 and W_3 whose time
+* side is reported by the solve_dlog benchmarks (see the dlog_curve_pXXX targets of the Makefile).
+*
+* With --footprint, each selected function is called on a thread whose stack is painted beforehand, and the bytes of stack
+* it wrote are reported (the maximum over a few calls, excluding the thread start-up), followed by the sizes of the read-only
+* tables of each source file. Unlike -fstack-usage, this includes the assembly kernels and the frames of all callees.
+*
+* With --hugepages, the compressed variants read the pairing and Pohlig-Hellman tables from a copy in huge pages
+* (see tables_hugepages()), to be compared with the default layout in .rodata under --cold.
+*
+* comp/tables_map gives the cost of mapping and checking a table store of the compressed variants (see tables_map()),
+* and in builds with RUNTIME_TABLES=TRUE, comp/tables_generate gives the start-up cost of computing the tables, to be set
+* against the per-operation benchmarks.
+*********************************************************************************************/
+
+#include <stdlib.h>
+#include <math.h>
+#if defined(__NIX__)
+    #include <pthread.h>
+    #include <stdatomic.h>
+    #include <unistd.h>
+#endif
+#if defined(__linux__)
+    #include <signal.h>
+    #include <sys/mman.h>
+#endif
+#if (TARGET == TARGET_AMD64 || TARGET == TARGET_x86) && !defined(_MSC_VER)
+    #include <emmintrin.h>
+#endif
+
+
+// Benchmark parameters: default number of samples per layer. Cheap functions are timed in batches per sample.
+#if defined(GENERIC_IMPLEMENTATION) || (OS_TARGET == OS_WIN) || (TARGET == TARGET_ARM)
+    #define SAMPLES_ARITH      1000
+    #define SAMPLES_CURVE       100
+    #define SAMPLES_PROTOCOL     10
+#else
+    #define SAMPLES_ARITH     10000
+    #define SAMPLES_CURVE      1000
+    #define SAMPLES_PROTOCOL    100
+#endif
+#define BATCH_ARITH         100       // Calls per sample for field operations
+#define BATCH_CURVE          10       // Calls per sample for point and isogeny operations
+
+#define CACHE_LINE          64
+#define THRASH_MB           64        // Default size of the buffer swept by --cold=thrash
+
+typedef enum { FORMAT_TEXT, FORMAT_JSON, FORMAT_CSV } bench_format;
+
+typedef enum { COLD_NONE, COLD_FLUSH, COLD_THRASH } bench_cold;
+
+typedef struct {
+    const char *layer;
+    const char *name;
+    void (*run)(unsigned int n);      // Executes the benchmarked function n times
+    unsigned int batch;               // Calls per sample
+    unsigned int samples;             // Default number of samples
+} bench_entry;
+
+typedef struct {
+    double median, p90, p99, min, mean, stddev;
+} bench_stats;
+
+typedef struct {
+    const char *filter;
+    bench_format format;
+    int header;
+    int cpu;
+    unsigned int samples;             // 0 selects the per-benchmark default
+    unsigned int warmup;              // Warmup samples, 0 selects 10% of the samples
+    int list;
+    unsigned int threads;             // Maximum number of threads in throughput mode, 0 disables it
+    double duration;                  // Seconds per thread count in throughput mode
+    int pin;
+    int smt;                          // Use all hardware threads of a core when pinning
+    bench_cold cold;                  // Eviction method of the cold-cache rows
+    unsigned int thrash_mb;
+    int pages;                        // Page-touch accounting mode
+    int tables;                       // Table size listing mode
+    int hugepages;                    // Use the huge-page copy of the compression tables
+    int footprint;                    // Stack and table footprint mode
+} bench_options;
+
+typedef struct {
+    const char *name;
+    const void *addr;
+    size_t bytes;
+    const char *file;                 // Source file of the table
+} bench_table;
+
+
+// Operands shared by the benchmarks. Results are fed back as inputs to keep the calls dependent.
+static felm_t fa, fb, fc;
+static f2elm_t f2a, f2b, f2c;
+static f2elm_t A24, C24, A, C, coeff[5];
+static point_proj_t P, Q;
+static digit_t scalar[NWORDS_ORDER];
+static unsigned char PrivateKeyA[SIDH_SECRETKEYBYTES_A], PrivateKeyB[SIDH_SECRETKEYBYTES_B];
+static unsigned char PublicKeyA[SIDH_PUBLICKEYBYTES], PublicKeyB[SIDH_PUBLICKEYBYTES];
+static unsigned char SharedSecret[SIDH_BYTES];
+static unsigned char sk[CRYPTO_SECRETKEYBYTES], pk[CRYPTO_PUBLICKEYBYTES];
+static unsigned char ct[CRYPTO_CIPHERTEXTBYTES], ss[CRYPTO_BYTES];
+#ifdef COMPRESS
+static point_t PP, QQ;
+static point_full_proj_t Qj[t_points];
+static f2elm_t fpair[2*t_points], r2, r3;
+static pairing_scratch_t pscratch;
+static int D[DLEN_2 > DLEN_3 ? DLEN_2 : DLEN_3];
+static digit_t dlog[NWORDS_ORDER];
+#endif
+
+
+static void bench_fpadd(unsigned int n)          { while (n--) fpadd(fa, fc, fc); }
+static void bench_fpsub(unsigned int n)          { while (n--) fpsub(fa, fc, fc); }
+static void bench_fpmul(unsigned int n)          { while (n--) fpmul_mont(fa, fc, fc); }
+static void bench_fpsqr(unsigned int n)          { while (n--) fpsqr_mont(fc, fc); }
+static void bench_fpinv(unsigned int n)          { while (n--) fpinv_mont(fc); }
+static void bench_fp2add(unsigned int n)         { while (n--) fp2add(f2a, f2c, f2c); }
+static void bench_fp2sub(unsigned int n)         { while (n--) fp2sub(f2a, f2c, f2c); }
+static void bench_fp2mul(unsigned int n)         { while (n--) fp2mul_mont(f2a, f2c, f2c); }
+static void bench_fp2sqr(unsigned int n)         { while (n--) fp2sqr_mont(f2c, f2c); }
+static void bench_fp2inv(unsigned int n)         { while (n--) fp2inv_mont(f2c); }
+static void bench_xDBL(unsigned int n)           { while (n--) xDBL(P, P, A24, C24); }
+static void bench_xTPL(unsigned int n)           { while (n--) xTPL(P, P, A24, C24); }
+static void bench_get_4_isog(unsigned int n)     { while (n--) get_4_isog(P, A, C, coeff); }
+static void bench_eval_4_isog(unsigned int n)    { while (n--) eval_4_isog(Q, coeff); }
+static void bench_get_3_isog(unsigned int n)     { while (n--) get_3_isog(P, A, C, coeff); }
+static void bench_eval_3_isog(unsigned int n)    { while (n--) eval_3_isog(Q, coeff); }
+static void bench_j_inv(unsigned int n)          { while (n--) j_inv(A, C, f2c); }
+static void bench_ladder3pt(unsigned int n)      { while (n--) LADDER3PT(f2a, f2b, f2c, scalar, ALICE, P, A); }
+#ifdef COMPRESS
+static void bench_tate2(unsigned int n)          { while (n--) Tate2_pairings(PP, QQ, Qj, fpair, &pscratch); }
+static void bench_tate3(unsigned int n)          { while (n--) Tate3_pairings(Qj, fpair, &pscratch); }
+static void bench_dlog2(unsigned int n)          { while (n--) solve_dlog(r2, D, dlog, 2); }
+static void bench_dlog3(unsigned int n)          { while (n--) solve_dlog(r3, D, dlog, 3); }
+#endif
+#if defined(COMPRESS) && defined(_RUNTIME_TABLES_)
+static void bench_tables_generate(unsigned int n) { while (n--) tables_generate(); }
+#endif
+#if defined(COMPRESS) && defined(__NIX__)
+static char tables_store[64];
+
+static void bench_tables_map(unsigned int n)
+{
+    compression_tables t;
+
+    while (n--) {
+        if (tables_store_map(tables_store, &t) == 0) munmap(t.file_map, t.file_bytes);
+    }
+}
+
+static void remove_tables_store(void)
+{
+    unlink(tables_store);
+}
+#endif
+static void bench_keygen_A(unsigned int n)       { while (n--) EphemeralKeyGeneration_A(PrivateKeyA, PublicKeyA); }
+static void bench_keygen_B(unsigned int n)       { while (n--) EphemeralKeyGeneration_B(PrivateKeyB, PublicKeyB); }
+static void bench_shared_A(unsigned int n)       { while (n--) EphemeralSecretAgreement_A(PrivateKeyA, PublicKeyB, SharedSecret); }
+static void bench_shared_B(unsigned int n)       { while (n--) EphemeralSecretAgreement_B(PrivateKeyB, PublicKeyA, SharedSecret); }
+static void bench_kem_keypair(unsigned int n)    { while (n--) crypto_kem_keypair(pk, sk); }
+static void bench_kem_enc(unsigned int n)        { while (n--) crypto_kem_enc(ct, ss, pk); }
+static void bench_kem_dec(unsigned int n)        { while (n--) crypto_kem_dec(ss, ct, sk); }
+static unsigned char keypair_coins[CRYPTO_KEYPAIRCOINBYTES], enc_coins[CRYPTO_ENCCOINBYTES];
+static void bench_kem_keypair_derand(unsigned int n) { while (n--) crypto_kem_keypair_derand(pk, sk, keypair_coins); }
+static void bench_kem_enc_derand(unsigned int n) { while (n--) crypto_kem_enc_derand(ct, ss, pk, enc_coins); }
+#ifndef COMPRESS
+static unsigned char epk[CRYPTO_EXPANDEDPKBYTES];
+
+static void bench_kem_expand_pk(unsigned int n)  { while (n--) crypto_kem_expand_pk(epk, pk); }
+static void bench_kem_enc_expanded(unsigned int n) { while (n--) crypto_kem_enc_expanded(ct, ss, pk, epk); }
+#endif
+#ifdef COMPRESS
+static unsigned char *workspace;
+
+static void bench_kem_keypair_ws(unsigned int n) { while (n--) crypto_kem_keypair_ws(pk, sk, workspace); }
+static void bench_kem_enc_ws(unsigned int n)     { while (n--) crypto_kem_enc_ws(ct, ss, pk, workspace); }
+static void bench_kem_dec_ws(unsigned int n)     { while (n--) crypto_kem_dec_ws(ss, ct, sk, workspace); }
+static void bench_shared_A_ws(unsigned int n)    { while (n--) EphemeralSecretAgreement_A_ws(PrivateKeyA, PublicKeyB, SharedSecret, workspace); }
+static void bench_shared_B_ws(unsigned int n)    { while (n--) EphemeralSecretAgreement_B_ws(PrivateKeyB, PublicKeyA, SharedSecret, workspace); }
+
+static unsigned char PublicKeyA_[SIDH_PUBLICKEYBYTES], UncompressedPublicKeyA[SIDH_PUBLICKEYBYTES_UNCOMPRESSED];
+
+static void bench_decompress_A(unsigned int n)   { while (n--) PublicKeyDecompression_A(PublicKeyA, UncompressedPublicKeyA); }
+static void bench_compress_A(unsigned int n)     { while (n--) PublicKeyCompression_A(UncompressedPublicKeyA, &PublicKeyA[SIDH_PUBLICKEYBYTES - SIDH_BASISHINTBYTES], PublicKeyA_); }
+#endif
+
+
+static const bench_entry benchmarks[] = {
+    {"fp",    "fpadd",                      bench_fpadd,       BATCH_ARITH, SAMPLES_ARITH},
+    {"fp",    "fpsub",                      bench_fpsub,       BATCH_ARITH, SAMPLES_ARITH},
+    {"fp",    "fpmul_mont",                 bench_fpmul,       BATCH_ARITH, SAMPLES_ARITH},
+    {"fp",    "fpsqr_mont",                 bench_fpsqr,       BATCH_ARITH, SAMPLES_ARITH},
+    {"fp",    "fpinv_mont",                 bench_fpinv,       1,           SAMPLES_CURVE},
+    {"fp2",   "fp2add",                     bench_fp2add,      BATCH_ARITH, SAMPLES_ARITH},
+    {"fp2",   "fp2sub",                     bench_fp2sub,      BATCH_ARITH, SAMPLES_ARITH},
+    {"fp2",   "fp2mul_mont",                bench_fp2mul,      BATCH_ARITH, SAMPLES_ARITH},
+    {"fp2",   "fp2sqr_mont",                bench_fp2sqr,      BATCH_ARITH, SAMPLES_ARITH},
+    {"fp2",   "fp2inv_mont",                bench_fp2inv,      1,           SAMPLES_CURVE},
+    {"ec",    "xDBL",                       bench_xDBL,        BATCH_CURVE, SAMPLES_CURVE},
+    {"ec",    "xTPL",                       bench_xTPL,        BATCH_CURVE, SAMPLES_CURVE},
+    {"ec",    "get_4_isog",                 bench_get_4_isog,  BATCH_CURVE, SAMPLES_CURVE},
+    {"ec",    "eval_4_isog",                bench_eval_4_isog, BATCH_CURVE, SAMPLES_CURVE},
+    {"ec",    "get_3_isog",                 bench_get_3_isog,  BATCH_CURVE, SAMPLES_CURVE},
+    {"ec",    "eval_3_isog",                bench_eval_3_isog, BATCH_CURVE, SAMPLES_CURVE},
+    {"ec",    "j_inv",                      bench_j_inv,       1,           SAMPLES_CURVE},
+    {"ec",    "LADDER3PT",                  bench_ladder3pt,   1,           SAMPLES_PROTOCOL},
+#ifdef COMPRESS
+    {"comp",  "Tate2_pairings",             bench_tate2,       1,           SAMPLES_PROTOCOL},
+    {"comp",  "Tate3_pairings",             bench_tate3,       1,           SAMPLES_PROTOCOL},
+    {"comp",  "solve_dlog_2",               bench_dlog2,       1,           SAMPLES_PROTOCOL},
+    {"comp",  "solve_dlog_3",               bench_dlog3,       1,           SAMPLES_PROTOCOL},
+#endif
+#if defined(COMPRESS) && defined(_RUNTIME_TABLES_)
+    {"comp",  "tables_generate",            bench_tables_generate, 1,       SAMPLES_PROTOCOL},
+#endif
+#if defined(COMPRESS) && defined(__NIX__)
+    {"comp",  "tables_map",                 bench_tables_map,  1,           SAMPLES_PROTOCOL},
+#endif
+    {"sidh",  "EphemeralKeyGeneration_A",   bench_keygen_A,    1,           SAMPLES_PROTOCOL},
+    {"sidh",  "EphemeralKeyGeneration_B",   bench_keygen_B,    1,           SAMPLES_PROTOCOL},
+    {"sidh",  "EphemeralSecretAgreement_A", bench_shared_A,    1,           SAMPLES_PROTOCOL},
+    {"sidh",  "EphemeralSecretAgreement_B", bench_shared_B,    1,           SAMPLES_PROTOCOL},
+#ifdef COMPRESS
+    {"sidh",  "PublicKeyDecompression_A",   bench_decompress_A, 1,          SAMPLES_PROTOCOL},
+    {"sidh",  "PublicKeyCompression_A",     bench_compress_A,  1,           SAMPLES_PROTOCOL},
+    {"sidh",  "EphemeralSecretAgreement_A_ws", bench_shared_A_ws, 1,         SAMPLES_PROTOCOL},
+    {"sidh",  "EphemeralSecretAgreement_B_ws", bench_shared_B_ws, 1,         SAMPLES_PROTOCOL},
+#endif
+    {"kem",   "crypto_kem_keypair",         bench_kem_keypair, 1,           SAMPLES_PROTOCOL},
+    {"kem",   "crypto_kem_enc",             bench_kem_enc,     1,           SAMPLES_PROTOCOL},
+    {"kem",   "crypto_kem_dec",             bench_kem_dec,     1,           SAMPLES_PROTOCOL},
+    {"kem",   "crypto_kem_keypair_derand",  bench_kem_keypair_derand, 1,    SAMPLES_PROTOCOL},
+    {"kem",   "crypto_kem_enc_derand",      bench_kem_enc_derand, 1,        SAMPLES_PROTOCOL},
+#ifndef COMPRESS
+    {"kem",   "crypto_kem_expand_pk",       bench_kem_expand_pk, 1,         SAMPLES_PROTOCOL},
+    {"kem",   "crypto_kem_enc_expanded",    bench_kem_enc_expanded, 1,      SAMPLES_PROTOCOL},
+#endif
+#ifdef COMPRESS
+    {"kem",   "crypto_kem_keypair_ws",      bench_kem_keypair_ws, 1,        SAMPLES_PROTOCOL},
+    {"kem",   "crypto_kem_enc_ws",          bench_kem_enc_ws,  1,           SAMPLES_PROTOCOL},
+    {"kem",   "crypto_kem_dec_ws",          bench_kem_dec_ws,  1,           SAMPLES_PROTOCOL},
+#endif
+};
+#define NUM_BENCHMARKS    (sizeof(benchmarks)/sizeof(bench_entry))
+
+
+// Read-only tables of the library variant: working set evicted by --cold=flush and tracked by --pages
+#define BENCH_TABLE(t, file)    {#t, t, sizeof(t), file}
+
+#define FILE_PARAMS    "parameters"     // PXXX.c or PXXX_compressed.c
+#define FILE_PAIR      "pair_tables"    // PXXX_compressed_pair_tables.c
+#define FILE_DLOG      "dlog_tables"    // PXXX_compressed_dlog_tables.c
+
+static const bench_table tables[] = {
+    BENCH_TABLE(A_gen, FILE_PARAMS),
+    BENCH_TABLE(B_gen, FILE_PARAMS),
+    BENCH_TABLE(strat_Alice, FILE_PARAMS),
+    BENCH_TABLE(strat_Bob, FILE_PARAMS),
+#ifdef COMPRESS
+    BENCH_TABLE(T_tate3, FILE_PAIR),
+    BENCH_TABLE(T_tate2_firststep_P, FILE_PAIR),
+    BENCH_TABLE(T_tate2_P, FILE_PAIR),
+    BENCH_TABLE(T_tate2_firststep_Q, FILE_PAIR),
+    BENCH_TABLE(T_tate2_Q, FILE_PAIR),
+    BENCH_TABLE(ph2_Texp, FILE_DLOG),
+    BENCH_TABLE(ph2_Log, FILE_DLOG),
+    BENCH_TABLE(ph2_G, FILE_DLOG),
+    BENCH_TABLE(ph2_CT, FILE_DLOG),
+#if (OBOB_EXPON % W_3 == 0)
+    BENCH_TABLE(ph3_T, FILE_DLOG),
+#else
+    BENCH_TABLE(ph3_T1, FILE_DLOG),
+    BENCH_TABLE(ph3_T2, FILE_DLOG),
+#endif
+    BENCH_TABLE(ph2_path, FILE_PARAMS),
+    BENCH_TABLE(ph3_path, FILE_PARAMS),
+    BENCH_TABLE(table_r_qr, FILE_PARAMS),
+    BENCH_TABLE(table_r_qnr, FILE_PARAMS),
+    BENCH_TABLE(table_v_qr, FILE_PARAMS),
+    BENCH_TABLE(table_v_qnr, FILE_PARAMS),
+    BENCH_TABLE(v_3_torsion, FILE_PARAMS),
+    BENCH_TABLE(A_basis_zero, FILE_PARAMS),
+    BENCH_TABLE(B_basis_zero, FILE_PARAMS),
+    BENCH_TABLE(B_gen_3_tors, FILE_PARAMS),
+#endif
+};
+#define NUM_TABLES    (sizeof(tables)/sizeof(bench_table))
+
+
+static void bench_setup(void)
+{ // Random operands and valid keys/ciphertexts for the protocol-level benchmarks
+    fprandom_test(fa); fprandom_test(fb); fprandom_test(fc);
+    fp2random_test((digit_t*)f2a); fp2random_test((digit_t*)f2b); fp2random_test((digit_t*)f2c);
+    fp2random_test((digit_t*)A24); fp2random_test((digit_t*)C24);
+    fp2random_test((digit_t*)A); fp2random_test((digit_t*)C);
+    fp2random_test((digit_t*)P->X); fp2random_test((digit_t*)P->Z);
+    fp2random_test((digit_t*)Q->X); fp2random_test((digit_t*)Q->Z);
+    for (int i = 0; i < 5; i++) fp2random_test((digit_t*)coeff[i]);
+    random_mod_order_A((unsigned char*)scalar);
+
+#ifdef COMPRESS
+    fp2random_test((digit_t*)PP->x); fp2random_test((digit_t*)PP->y);
+    fp2random_test((digit_t*)QQ->x); fp2random_test((digit_t*)QQ->y);
+    for (int j = 0; j < t_points; j++) {
+        fp2random_test((digit_t*)Qj[j]->X); fp2random_test((digit_t*)Qj[j]->Y); fp2random_test((digit_t*)Qj[j]->Z);
+    }
+    Tate2_pairings(PP, QQ, Qj, fpair, &pscratch);  // Pairing values lie in the subgroup of order 2^eA
+    fp2copy(fpair[0], r2);
+    Tate3_pairings(Qj, fpair, &pscratch);          // Pairing values lie in the subgroup of order 3^eB
+    fp2copy(fpair[0], r3);
+#endif
+#if defined(COMPRESS) && defined(__NIX__)
+    snprintf(tables_store, sizeof(tables_store), "%s/sike_bench_tables.%d", P_tmpdir, (int)getpid());
+    if (tables_write(tables_store) == 0) atexit(remove_tables_store);    // Read by tables_map
+#endif
+
+#ifdef COMPRESS
+    workspace = (unsigned char*)malloc(crypto_kem_workspace_size());
+    if (workspace == NULL) exit(FAILED);
+#endif
+
+    random_mod_order_A(PrivateKeyA);
+    random_mod_order_B(PrivateKeyB);
+    EphemeralKeyGeneration_A(PrivateKeyA, PublicKeyA);
+    EphemeralKeyGeneration_B(PrivateKeyB, PublicKeyB);
+#ifdef COMPRESS
+    PublicKeyDecompression_A(PublicKeyA, UncompressedPublicKeyA);
+#endif
+    crypto_kem_keypair(pk, sk);
+    crypto_kem_enc(ct, ss, pk);
+#ifndef COMPRESS
+    crypto_kem_expand_pk(epk, pk);
+#endif
+    randombytes(keypair_coins, CRYPTO_KEYPAIRCOINBYTES);
+    randombytes(enc_coins, CRYPTO_ENCCOINBYTES);
+}
+
+
+static int compare_doubles(const void *a, const void *b)
+{
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+
+static double percentile(const double *sorted, unsigned int n, double p)
+{ // Nearest-rank percentile of sorted samples
+    unsigned int rank = (unsigned int)ceil(p/100*n);
+
+    return sorted[(rank == 0) ? 0 : rank - 1];
+}
+
+
+static void compute_stats(double *samples, unsigned int n, bench_stats *stats)
+{ // Sorts the samples in place
+    double sum = 0, var = 0;
+    unsigned int i;
+
+    qsort(samples, n, sizeof(double), compare_doubles);
+    for (i = 0; i < n; i++) sum += samples[i];
+    stats->mean = sum/n;
+    for (i = 0; i < n; i++) var += (samples[i] - stats->mean)*(samples[i] - stats->mean);
+    stats->stddev = (n > 1) ? sqrt(var/(n - 1)) : 0;
+    stats->min = samples[0];
+    stats->median = (n % 2 == 1) ? samples[n/2] : (samples[n/2 - 1] + samples[n/2])/2;
+    stats->p90 = percentile(samples, n, 90);
+    stats->p99 = percentile(samples, n, 99);
+}
+
+
+static int filter_match(const char *filter, const char *full)
+{ // Comma-separated list of substrings matched against "full"
+    const char *start = filter, *end;
+    size_t len;
+
+    if (filter == NULL) return 1;
+    while (*start != '\0') {
+        end = strchr(start, ',');
+        len = (end == NULL) ? strlen(start) : (size_t)(end - start);
+        for (const char *s = full; len != 0 && strlen(s) >= len; s++) {
+            if (strncmp(s, start, len) == 0) return 1;
+        }
+        if (end == NULL) break;
+        start = end + 1;
+    }
+    return 0;
+}
+
+
+static int bench_selected(const char *filter, const bench_entry *bench)
+{ // Benchmarks are matched by "layer/name"
+    char full[128];
+
+    snprintf(full, sizeof(full), "%s/%s", bench->layer, bench->name);
+    return filter_match(filter, full);
+}
+
+
+static void print_result(const bench_options *opt, const bench_entry *bench, const char *cache, unsigned int n, unsigned int batch, const bench_stats *cyc, double ns_per_cycle)
+{
+    switch (opt->format) {
+    case FORMAT_JSON:
+        printf("{\"scheme\": \"%s\", \"layer\": \"%s\", \"name\": \"%s\", \"cache\": \"%s\", \"samples\": %u, \"batch\": %u, "
+               "\"median_cycles\": %.1f, \"p90_cycles\": %.1f, \"p99_cycles\": %.1f, \"min_cycles\": %.1f, \"stddev_cycles\": %.1f, "
+               "\"median_ns\": %.1f, \"p90_ns\": %.1f, \"p99_ns\": %.1f, \"min_ns\": %.1f, \"stddev_ns\": %.1f}\n",
+               SCHEME_NAME, bench->layer, bench->name, cache, n, batch,
+               cyc->median, cyc->p90, cyc->p99, cyc->min, cyc->stddev,
+               cyc->median*ns_per_cycle, cyc->p90*ns_per_cycle, cyc->p99*ns_per_cycle, cyc->min*ns_per_cycle, cyc->stddev*ns_per_cycle);
+        break;
+    case FORMAT_CSV:
+        printf("%s,%s,%s,%s,%u,%u,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f\n",
+               SCHEME_NAME, bench->layer, bench->name, cache, n, batch,
+               cyc->median, cyc->p90, cyc->p99, cyc->min, cyc->stddev,
+               cyc->median*ns_per_cycle, cyc->p90*ns_per_cycle, cyc->p99*ns_per_cycle, cyc->min*ns_per_cycle, cyc->stddev*ns_per_cycle);
+        break;
+    default:
+        printf("  %-5s %-29s %-5s %12.0f %12.0f %12.0f %12.0f %10.1f %12.0f\n", bench->layer, bench->name, cache,
+               cyc->median, cyc->p90, cyc->p99, cyc->min, cyc->stddev, cyc->median*ns_per_cycle);
+    }
+}
+
+
+/*********************************** Cold-cache mode ************************************/
+
+#if (TARGET == TARGET_AMD64 || TARGET == TARGET_x86) && !defined(_MSC_VER)
+    #define CACHE_FLUSH_SUPPORTED
+    #define cache_flush_line(p)    _mm_clflush(p)
+    #define cache_flush_fence()    _mm_mfence()
+#elif (TARGET == TARGET_ARM64) && defined(__GNUC__)
+    #define CACHE_FLUSH_SUPPORTED
+    #define cache_flush_line(p)    __asm__ __volatile__("dc civac, %0" : : "r"(p) : "memory")
+    #define cache_flush_fence()    __asm__ __volatile__("dsb ish" : : : "memory")
+#endif
+
+static unsigned char *thrash_buffer;
+static size_t thrash_bytes;
+
+
+static void evict_tables(const bench_options *opt)
+{ // Evict the table working set before a cold-cache call
+    if (opt->cold == COLD_FLUSH) {
+#if defined(CACHE_FLUSH_SUPPORTED)
+        for (unsigned int t = 0; t < NUM_TABLES; t++) {
+            const unsigned char *start = (const unsigned char*)((uintptr_t)tables[t].addr & ~(uintptr_t)(CACHE_LINE - 1));
+            const unsigned char *end = (const unsigned char*)tables[t].addr + tables[t].bytes;
+            for (const unsigned char *line = start; line < end; line += CACHE_LINE) {
+                cache_flush_line(line);
+            }
+        }
+#ifdef COMPRESS
+        for (size_t i = 0; i < comp_tables.region_bytes; i += CACHE_LINE) {
+            cache_flush_line((const unsigned char*)comp_tables.region + i);
+        }
+#endif
+        cache_flush_fence();
+#endif
+    } else {
+        // Sweep a buffer larger than the last-level cache, which also evicts code and stack
+        for (size_t i = 0; i < thrash_bytes; i += CACHE_LINE) {
+            thrash_buffer[i]++;
+        }
+    }
+}
+
+
+static void run_cold(const bench_options *opt, const bench_entry *bench, unsigned int n, double ns_per_cycle)
+{ // Single calls preceded by an eviction. Eviction is expensive, so the number of samples is capped by default.
+    int64_t cycles1, cycles2;
+    double *samples;
+    bench_stats stats;
+
+    if (opt->samples == 0 && n > SAMPLES_PROTOCOL) n = SAMPLES_PROTOCOL;
+    samples = (double*)malloc(n*sizeof(double));
+    if (samples == NULL) return;
+
+    for (unsigned int i = 0; i < n; i++) {
+        evict_tables(opt);
+        cycles1 = cpucycles();
+        bench->run(1);
+        cycles2 = cpucycles();
+        samples[i] = (double)(cycles2 - cycles1);
+    }
+
+    compute_stats(samples, n, &stats);
+    print_result(opt, bench, "cold", n, 1, &stats, ns_per_cycle);
+    free(samples);
+}
+
+
+static int run_benchmark(const bench_options *opt, const bench_entry *bench)
+{ // Warmup followed by "samples" timed samples of "batch" calls each
+    unsigned int i, n = (opt->samples != 0) ? opt->samples : bench->samples;
+    unsigned int warmup = (opt->warmup != 0) ? opt->warmup : n/10 + 1;
+    int64_t cycles1, cycles2, ns1, ns2, total_cycles = 0;
+    double *samples, ns_per_cycle;
+    bench_stats stats;
+
+    samples = (double*)malloc(n*sizeof(double));
+    if (samples == NULL) return FAILED;
+
+    for (i = 0; i < warmup; i++) {
+        bench->run(bench->batch);
+    }
+
+    ns1 = nanoseconds();
+    for (i = 0; i < n; i++) {
+        cycles1 = cpucycles();
+        bench->run(bench->batch);
+        cycles2 = cpucycles();
+        samples[i] = (double)(cycles2 - cycles1)/bench->batch;
+        total_cycles += cycles2 - cycles1;
+    }
+    ns2 = nanoseconds();
+    ns_per_cycle = (total_cycles > 0) ? (double)(ns2 - ns1)/total_cycles : 0;
+
+    compute_stats(samples, n, &stats);
+    print_result(opt, bench, "warm", n, bench->batch, &stats, ns_per_cycle);
+    free(samples);
+
+    if (opt->cold != COLD_NONE) {
+        run_cold(opt, bench, n, ns_per_cycle);
+    }
+
+    return PASSED;
+}
+
+
+static int run_tables(const bench_options *opt)
+{ // Lists the sizes of the read-only tables matched by the filter
+    size_t total = 0;
+#ifdef COMPRESS
+    const int w2 = W_2, w3 = W_3;
+#else
+    const int w2 = 0, w3 = 0;                 // Pohlig-Hellman is only used by the compressed variants
+#endif
+
+    if (opt->format == FORMAT_TEXT) {
+        printf("\n\nREAD-ONLY TABLES OF %s", SCHEME_NAME);
+        if (w2 != 0) printf(" (W_2 = %d, W_3 = %d)", w2, w3);
+        printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+        printf("  %-20s %10s\n", "table", "bytes");
+    } else if (opt->format == FORMAT_CSV && opt->header) {
+        printf("scheme,w2,w3,table,bytes\n");
+    }
+
+    for (unsigned int t = 0; t < NUM_TABLES; t++) {
+        if (!filter_match(opt->filter, tables[t].name)) continue;
+        total += tables[t].bytes;
+        switch (opt->format) {
+        case FORMAT_JSON:
+            printf("{\"scheme\": \"%s\", \"mode\": \"tables\", \"w2\": %d, \"w3\": %d, \"table\": \"%s\", \"bytes\": %zu}\n",
+                   SCHEME_NAME, w2, w3, tables[t].name, tables[t].bytes);
+            break;
+        case FORMAT_CSV:
+            printf("%s,%d,%d,%s,%zu\n", SCHEME_NAME, w2, w3, tables[t].name, tables[t].bytes);
+            break;
+        default:
+            printf("  %-20s %10zu\n", tables[t].name, tables[t].bytes);
+        }
+    }
+    if (opt->format == FORMAT_TEXT) {
+        printf("  %-20s %10zu\n\n", "total", total);
+    }
+    return PASSED;
+}
+
+#if defined(__linux__)
+/********************************* Page-touch accounting *********************************/
+
+static size_t page_size;
+static uintptr_t pages_lo;                 // Page-aligned start of the lowest table
+static unsigned char *page_touched;        // One flag per page from pages_lo to the end of the highest table
+
+
+static int page_in_tables(uintptr_t page)
+{
+    for (unsigned int t = 0; t < NUM_TABLES; t++) {
+        uintptr_t start = (uintptr_t)tables[t].addr & ~(uintptr_t)(page_size - 1);
+        if (page >= start && page < (uintptr_t)tables[t].addr + tables[t].bytes) return 1;
+    }
+    return 0;
+}
+
+
+static void page_fault_handler(int sig, siginfo_t *info, void *context)
+{ // First access to a protected table page: record it and make the page readable again.
+  // Any other fault, or a second fault on the same page (e.g., a write), is handled by the default action.
+    uintptr_t page = (uintptr_t)info->si_addr & ~(uintptr_t)(page_size - 1);
+    (void)context;
+
+    if (page < pages_lo || !page_in_tables(page) || page_touched[(page - pages_lo)/page_size]) {
+        signal(sig, SIG_DFL);
+        return;
+    }
+    page_touched[(page - pages_lo)/page_size] = 1;
+    mprotect((void*)page, page_size, PROT_READ);
+}
+
+
+static int protect_tables(int prot)
+{
+    for (unsigned int t = 0; t < NUM_TABLES; t++) {
+        uintptr_t start = (uintptr_t)tables[t].addr & ~(uintptr_t)(page_size - 1);
+        uintptr_t end = ((uintptr_t)tables[t].addr + tables[t].bytes + page_size - 1) & ~(uintptr_t)(page_size - 1);
+        if (mprotect((void*)start, end - start, prot) != 0) return FAILED;
+    }
+    return PASSED;
+}
+
+
+static int run_pages(const bench_options *opt)
+{ // Pages of each table touched by a single call of each selected benchmark
+    struct sigaction action, previous;
+    uintptr_t hi = 0;
+    size_t npages;
+    int status = PASSED;
+
+    page_size = (size_t)sysconf(_SC_PAGESIZE);
+    pages_lo = UINTPTR_MAX;
+    for (unsigned int t = 0; t < NUM_TABLES; t++) {
+        uintptr_t start = (uintptr_t)tables[t].addr & ~(uintptr_t)(page_size - 1);
+        if (start < pages_lo) pages_lo = start;
+        if ((uintptr_t)tables[t].addr + tables[t].bytes > hi) hi = (uintptr_t)tables[t].addr + tables[t].bytes;
+    }
+    npages = (hi - pages_lo + page_size - 1)/page_size;
+    page_touched = (unsigned char*)malloc(npages);
+    if (page_touched == NULL) return FAILED;
+
+    memset(&action, 0, sizeof(action));
+    action.sa_sigaction = page_fault_handler;
+    action.sa_flags = SA_SIGINFO;
+    sigemptyset(&action.sa_mask);
+
+    if (opt->format == FORMAT_TEXT) {
+        printf("\n\nTABLE PAGES TOUCHED BY ONE CALL IN %s (%zu-byte pages)\n", SCHEME_NAME, page_size);
+        printf("--------------------------------------------------------------------------------------------------------\n\n");
+        printf("  %-5s %-29s %-20s %10s %8s %8s\n", "layer", "function", "table", "bytes", "pages", "touched");
+    } else if (opt->format == FORMAT_CSV && opt->header) {
+        printf("scheme,layer,name,table,bytes,pages,touched_pages\n");
+    }
+
+    for (unsigned int i = 0; i < NUM_BENCHMARKS && status == PASSED; i++) {
+        const bench_entry *bench = &benchmarks[i];
+        size_t total_pages = 0, total_touched = 0;
+
+        if (!bench_selected(opt->filter, bench)) continue;
+        if (opt->format == FORMAT_TEXT) printf("  %-5s %s\n", bench->layer, bench->name);
+        bench->run(1);                            // Warm up lazily mapped pages outside the tables
+        memset(page_touched, 0, npages);
+        sigaction(SIGSEGV, &action, &previous);
+        if (protect_tables(PROT_NONE) != PASSED) {
+            status = FAILED;
+        } else {
+            bench->run(1);
+        }
+        if (protect_tables(PROT_READ) != PASSED) status = FAILED;
+        sigaction(SIGSEGV, &previous, NULL);
+        if (status != PASSED) {
+            fprintf(stderr, "Could not change the protection of the tables\n");
+            break;
+        }
+
+        for (unsigned int t = 0; t < NUM_TABLES; t++) {
+            size_t first = (((uintptr_t)tables[t].addr & ~(uintptr_t)(page_size - 1)) - pages_lo)/page_size;
+            size_t last = ((uintptr_t)tables[t].addr + tables[t].bytes - 1 - pages_lo)/page_size;
+            size_t touched = 0;
+            for (size_t k = first; k <= last; k++) touched += page_touched[k];
+            total_pages += last - first + 1;
+            total_touched += touched;
+
+            switch (opt->format) {
+            case FORMAT_JSON:
+                printf("{\"scheme\": \"%s\", \"mode\": \"pages\", \"layer\": \"%s\", \"name\": \"%s\", \"table\": \"%s\", "
+                       "\"bytes\": %zu, \"pages\": %zu, \"touched_pages\": %zu}\n",
+                       SCHEME_NAME, bench->layer, bench->name, tables[t].name, tables[t].bytes, last - first + 1, touched);
+                break;
+            case FORMAT_CSV:
+                printf("%s,%s,%s,%s,%zu,%zu,%zu\n", SCHEME_NAME, bench->layer, bench->name, tables[t].name, tables[t].bytes, last - first + 1, touched);
+                break;
+            default:
+                if (touched != 0) {
+                    printf("  %-5s %-29s %-20s %10zu %8zu %8zu\n", "", "", tables[t].name, tables[t].bytes, last - first + 1, touched);
+                }
+            }
+        }
+        if (opt->format == FORMAT_TEXT) {
+            printf("  %-5s %-29s %-20s %10s %8zu %8zu\n\n", "", "", "total", "", total_pages, total_touched);
+        }
+        fflush(stdout);
+    }
+
+    free(page_touched);
+    return status;
+}
+#endif
+
+#if defined(__NIX__)
+/************************************ Footprint mode *************************************/
+
+#define FOOTPRINT_STACK    (1 << 20)  // Stack of the measuring thread
+#define FOOTPRINT_CALLS    3          // Calls per function, the largest stack use is reported
+
+static const unsigned char footprint_paint[2] = {0xA5, 0x5A};
+
+
+static void* footprint_worker(void *arg)
+{ // A NULL benchmark measures the thread start-up alone
+    const bench_entry *bench = (const bench_entry*)arg;
+
+    if (bench != NULL) bench->run(1);
+    return NULL;
+}
+
+
+static size_t stack_used(const bench_entry *bench, unsigned char *stack)
+{ // Bytes of the stack written by a thread running one call, i.e., below the highest byte that differs from the paint.
+  // The thread is run once per paint, so that data equal to one of them is not mistaken for unused stack.
+  // Stacks grow downwards on all the supported targets. Returns 0 if the thread could not be run.
+    pthread_attr_t attr;
+    pthread_t thread;
+    size_t i, used = 0;
+
+    for (unsigned int p = 0; p < sizeof(footprint_paint); p++) {
+        memset(stack, footprint_paint[p], FOOTPRINT_STACK);
+        if (pthread_attr_init(&attr) != 0) return 0;
+        if (pthread_attr_setstack(&attr, stack, FOOTPRINT_STACK) != 0 || pthread_create(&thread, &attr, footprint_worker, (void*)bench) != 0) {
+            pthread_attr_destroy(&attr);
+            return 0;
+        }
+        pthread_join(thread, NULL);
+        pthread_attr_destroy(&attr);
+
+        for (i = 0; i < FOOTPRINT_STACK && stack[i] == footprint_paint[p]; i++);
+        if (FOOTPRINT_STACK - i > used) used = FOOTPRINT_STACK - i;
+    }
+    return used;
+}
+
+
+static int run_footprint(const bench_options *opt)
+{ // Stack used by one call of each selected benchmark, and bytes of the read-only tables of each source file
+    static const char *files[3] = {FILE_PARAMS, FILE_PAIR, FILE_DLOG};
+    unsigned char *stack;
+    size_t base, used, bytes, total = 0;
+
+    if (posix_memalign((void**)&stack, 4096, FOOTPRINT_STACK) != 0) return FAILED;
+    base = stack_used(NULL, stack);           // Thread descriptor, thread-local storage and start-up frames
+    if (base == 0) {
+        fprintf(stderr, "Could not run a thread on a painted stack\n");
+        free(stack);
+        return FAILED;
+    }
+
+    if (opt->format == FORMAT_TEXT) {
+        printf("\n\nFOOTPRINT OF %s\n", SCHEME_NAME);
+        printf("--------------------------------------------------------------------------------------------------------\n\n");
+        printf("  %-5s %-29s %12s\n", "layer", "function", "stack bytes");
+    } else if (opt->format == FORMAT_CSV && opt->header) {
+        printf("scheme,kind,layer,name,bytes\n");
+    }
+
+    for (unsigned int i = 0; i < NUM_BENCHMARKS; i++) {
+        const bench_entry *bench = &benchmarks[i];
+
+        if (!bench_selected(opt->filter, bench)) continue;
+        used = 0;
+        for (unsigned int k = 0; k < FOOTPRINT_CALLS; k++) {
+            size_t u = stack_used(bench, stack);
+            if (u > used) used = u;
+        }
+        used = (used > base) ? used - base : 0;
+
+        switch (opt->format) {
+        case FORMAT_JSON:
+            printf("{\"scheme\": \"%s\", \"mode\": \"footprint\", \"kind\": \"stack\", \"layer\": \"%s\", \"name\": \"%s\", \"bytes\": %zu}\n",
+                   SCHEME_NAME, bench->layer, bench->name, used);
+            break;
+        case FORMAT_CSV:
+            printf("%s,stack,%s,%s,%zu\n", SCHEME_NAME, bench->layer, bench->name, used);
+            break;
+        default:
+            printf("  %-5s %-29s %12zu\n", bench->layer, bench->name, used);
+        }
+        fflush(stdout);
+    }
+    free(stack);
+
+    if (opt->format == FORMAT_TEXT) {
+        printf("\n  %-33s %12s\n", "read-only tables", "bytes");
+    }
+    for (unsigned int f = 0; f < sizeof(files)/sizeof(files[0]); f++) {
+        bytes = 0;
+        for (unsigned int t = 0; t < NUM_TABLES; t++) {
+            if (strcmp(tables[t].file, files[f]) == 0) bytes += tables[t].bytes;
+        }
+        if (bytes == 0) continue;
+        total += bytes;
+
+        switch (opt->format) {
+        case FORMAT_JSON:
+            printf("{\"scheme\": \"%s\", \"mode\": \"footprint\", \"kind\": \"rodata\", \"layer\": \"tables\", \"name\": \"%s\", \"bytes\": %zu}\n",
+                   SCHEME_NAME, files[f], bytes);
+            break;
+        case FORMAT_CSV:
+            printf("%s,rodata,tables,%s,%zu\n", SCHEME_NAME, files[f], bytes);
+            break;
+        default:
+            printf("  %-33s %12zu\n", files[f], bytes);
+        }
+    }
+    if (opt->format == FORMAT_TEXT) {
+        printf("  %-33s %12zu\n\n", "total", total);
+    }
+    return PASSED;
+}
+
+
+/************************************ Throughput mode ************************************/
+
+#define KEM_OPS    3                  // keypair, enc, dec
+
+static const char *kem_op_names[KEM_OPS] = {"keypair", "enc", "dec"};
+
+typedef struct {
+    int64_t *lat;                     // Latencies in ns
+    size_t n, capacity;
+    unsigned long long dropped;       // Samples beyond the capacity
+} latency_log;
+
+typedef struct {
+    int cpu;                          // -1 if not pinned
+    unsigned long long iterations;
+    unsigned int errors;
+    latency_log log[KEM_OPS];
+} throughput_thread;
+
+static atomic_uint threads_ready;
+static atomic_int threads_go;
+static int64_t throughput_deadline;
+
+
+static void log_latency(latency_log *log, int64_t ns)
+{ // The logs are allocated before the threads start, so that the timed loop does not allocate. Samples beyond their capacity are dropped.
+    if (log->n < log->capacity) {
+        log->lat[log->n++] = ns;
+    } else {
+        log->dropped++;
+    }
+}
+
+
+static void* throughput_worker(void *arg)
+{ // Mixed keypair/enc/dec loop until the deadline
+    throughput_thread *t = (throughput_thread*)arg;
+    unsigned char sk_[CRYPTO_SECRETKEYBYTES], pk_[CRYPTO_PUBLICKEYBYTES];
+    unsigned char ct_[CRYPTO_CIPHERTEXTBYTES], ss1[CRYPTO_BYTES], ss2[CRYPTO_BYTES];
+    int64_t t0, t1, t2, t3;
+
+    if (t->cpu >= 0) pin_to_cpu(t->cpu);
+    atomic_fetch_add(&threads_ready, 1);
+    while (!atomic_load(&threads_go)) {}
+
+    do {
+        t0 = nanoseconds();
+        crypto_kem_keypair(pk_, sk_);
+        t1 = nanoseconds();
+        crypto_kem_enc(ct_, ss1, pk_);
+        t2 = nanoseconds();
+        crypto_kem_dec(ss2, ct_, sk_);
+        t3 = nanoseconds();
+        if (memcmp(ss1, ss2, CRYPTO_BYTES) != 0) t->errors++;
+        log_latency(&t->log[0], t1 - t0);
+        log_latency(&t->log[1], t2 - t1);
+        log_latency(&t->log[2], t3 - t2);
+        t->iterations++;
+    } while (t3 < throughput_deadline);
+
+    return NULL;
+}
+
+
+static size_t throughput_capacity(const bench_options *opt)
+{ // Upper bound on the iterations of a thread in one step: twice those of a single thread at the rate of a calibration iteration, the
+  // fastest of two, on the calling thread. Threads sharing the cores run slower than a single one.
+    unsigned char sk_[CRYPTO_SECRETKEYBYTES], pk_[CRYPTO_PUBLICKEYBYTES];
+    unsigned char ct_[CRYPTO_CIPHERTEXTBYTES], ss_[CRYPTO_BYTES];
+    int64_t t0, ns, best = INT64_MAX;
+
+    for (int i = 0; i < 2; i++) {
+        t0 = nanoseconds();
+        crypto_kem_keypair(pk_, sk_);
+        crypto_kem_enc(ct_, ss_, pk_);
+        crypto_kem_dec(ss_, ct_, sk_);
+        ns = nanoseconds() - t0;
+        if (ns < best) best = ns;
+    }
+    if (best <= 0) best = 1;
+    return (size_t)(2*opt->duration*1e9/best) + 16;
+}
+
+
+static unsigned int throughput_cpus(const bench_options *opt, int *cpus, unsigned int max)
+{ // Logical CPUs used for pinning, skipping the SMT siblings of a core if requested
+    long ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+    unsigned int n = 0;
+
+    for (int cpu = 0; cpu < ncpus && n < max; cpu++) {
+        if (!opt->smt) {
+            char path[96];
+            int first = cpu;
+            FILE *f;
+            snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/thread_siblings_list", cpu);
+            f = fopen(path, "r");
+            if (f != NULL) {
+                if (fscanf(f, "%d", &first) != 1) first = cpu;
+                fclose(f);
+            }
+            if (first != cpu) continue;     // Not the first hardware thread of its core
+        }
+        cpus[n++] = cpu;
+    }
+    return n;
+}
+
+
+static double latency_percentile(latency_log *log, double p)
+{
+    double *sorted, r;
+
+    if (log->n == 0) return 0;
+    sorted = (double*)malloc(log->n*sizeof(double));
+    if (sorted == NULL) return 0;
+    for (size_t i = 0; i < log->n; i++) sorted[i] = (double)log->lat[i];
+    qsort(sorted, log->n, sizeof(double), compare_doubles);
+    r = percentile(sorted, (unsigned int)log->n, p);
+    free(sorted);
+    return r;
+}
+
+
+static int run_throughput_step(const bench_options *opt, const int *cpus, unsigned int ncpus, unsigned int nthreads, size_t capacity, double *base)
+{ // Run "nthreads" threads for the configured duration and report the results, with latency logs of "capacity" samples per thread and operation
+    throughput_thread *t = (throughput_thread*)calloc(nthreads, sizeof(throughput_thread));
+    pthread_t *tid = (pthread_t*)calloc(nthreads, sizeof(pthread_t));
+    unsigned long long iterations = 0, dropped = 0;
+    unsigned int i, k, started, errors = 0;
+    double seconds, ops, efficiency;
+    int64_t start, end;
+    int status = PASSED;
+
+    if (t == NULL || tid == NULL) {
+        free(t); free(tid);
+        return FAILED;
+    }
+    for (i = 0; i < nthreads; i++) {
+        for (k = 0; k < KEM_OPS; k++) {
+            t[i].log[k].lat = (int64_t*)malloc(capacity*sizeof(int64_t));
+            if (t[i].log[k].lat == NULL) {
+                status = FAILED;
+                goto cleanup;
+            }
+            t[i].log[k].capacity = capacity;
+        }
+    }
+    atomic_store(&threads_ready, 0);
+    atomic_store(&threads_go, 0);
+    throughput_deadline = INT64_MAX;
+    for (started = 0; started < nthreads; started++) {
+        t[started].cpu = (opt->pin && ncpus != 0) ? cpus[started % ncpus] : -1;
+        if (pthread_create(&tid[started], NULL, throughput_worker, &t[started]) != 0) {
+            status = FAILED;
+            break;
+        }
+    }
+    while (atomic_load(&threads_ready) != started) {}
+    start = nanoseconds();
+    throughput_deadline = start + (int64_t)(opt->duration*1e9);
+    atomic_store(&threads_go, 1);
+    for (i = 0; i < started; i++) {
+        pthread_join(tid[i], NULL);
+        iterations += t[i].iterations;
+        errors += t[i].errors;
+        for (k = 0; k < KEM_OPS; k++) dropped += t[i].log[k].dropped;
+    }
+    end = nanoseconds();
+    if (status != PASSED || errors != 0) {
+        status = FAILED;
+        goto cleanup;
+    }
+    if (dropped != 0) {
+        fprintf(stderr, "%llu latency samples beyond the logs were dropped with %u threads\n", dropped, nthreads);
+    }
+
+    seconds = (double)(end - start)/1e9;
+    ops = KEM_OPS*iterations/seconds;
+    if (nthreads == 1) *base = ops;
+    efficiency = (*base > 0) ? ops/(nthreads*(*base)) : 0;
+
+    for (i = 0; i < nthreads; i++) {
+        double tops = KEM_OPS*t[i].iterations/seconds, p50[KEM_OPS], p99[KEM_OPS];
+        for (k = 0; k < KEM_OPS; k++) {
+            p50[k] = latency_percentile(&t[i].log[k], 50);
+            p99[k] = latency_percentile(&t[i].log[k], 99);
+        }
+        switch (opt->format) {
+        case FORMAT_JSON:
+            printf("{\"scheme\": \"%s\", \"mode\": \"throughput\", \"threads\": %u, \"thread\": %u, \"cpu\": %d, \"ops_per_sec\": %.1f, "
+                   "\"total_ops_per_sec\": %.1f, \"efficiency\": %.3f", SCHEME_NAME, nthreads, i, t[i].cpu, tops, ops, efficiency);
+            for (k = 0; k < KEM_OPS; k++) printf(", \"%s_p50_ns\": %.0f, \"%s_p99_ns\": %.0f", kem_op_names[k], p50[k], kem_op_names[k], p99[k]);
+            printf("}\n");
+            break;
+        case FORMAT_CSV:
+            printf("%s,%u,%u,%d,%.1f,%.1f,%.3f", SCHEME_NAME, nthreads, i, t[i].cpu, tops, ops, efficiency);
+            for (k = 0; k < KEM_OPS; k++) printf(",%.0f,%.0f", p50[k], p99[k]);
+            printf("\n");
+            break;
+        default:
+            if (i == 0) printf("  %7u %12.1f %10.3f\n", nthreads, ops, efficiency);
+            printf("          thread %3u  cpu %3d  %10.1f ops/s ", i, t[i].cpu, tops);
+            for (k = 0; k < KEM_OPS; k++) printf("  %s %8.0f/%8.0f us", kem_op_names[k], p50[k]/1000, p99[k]/1000);
+            printf("\n");
+        }
+    }
+
+cleanup:
+    for (i = 0; i < nthreads; i++) {
+        for (k = 0; k < KEM_OPS; k++) free(t[i].log[k].lat);
+    }
+    free(t);
+    free(tid);
+    return status;
+}
+
+
+static int run_throughput(const bench_options *opt)
+{ // Scaling sweep over 1, 2, 4, ..., opt->threads threads
+    int *cpus = (int*)calloc(opt->threads, sizeof(int));
+    unsigned int n, ncpus;
+    size_t capacity;
+    double base = 0;
+    int status = PASSED;
+
+    if (cpus == NULL) return FAILED;
+    ncpus = throughput_cpus(opt, cpus, opt->threads);
+    if (opt->pin && ncpus < opt->threads) {
+        fprintf(stderr, "Only %u CPUs available for pinning, threads will share them\n", ncpus);
+    }
+
+    if (opt->format == FORMAT_TEXT) {
+        printf("\n\nTHROUGHPUT OF %s (keypair/enc/dec loops, %.1f s per step)\n", SCHEME_NAME, opt->duration);
+        printf("--------------------------------------------------------------------------------------------------------\n\n");
+        printf("  %7s %12s %10s     per thread: latency p50/p99\n", "threads", "ops/s", "efficiency");
+    } else if (opt->format == FORMAT_CSV && opt->header) {
+        printf("scheme,threads,thread,cpu,ops_per_sec,total_ops_per_sec,efficiency");
+        for (unsigned int k = 0; k < KEM_OPS; k++) printf(",%s_p50_ns,%s_p99_ns", kem_op_names[k], kem_op_names[k]);
+        printf("\n");
+    }
+
+    capacity = throughput_capacity(opt);
+    for (n = 1; status == PASSED; n = (2*n < opt->threads || n == opt->threads) ? 2*n : opt->threads) {
+        status = run_throughput_step(opt, cpus, ncpus, n, capacity, &base);
+        fflush(stdout);
+        if (n == opt->threads) break;
+    }
+    free(cpus);
+    return status;
+}
+#endif
+
+
+static int parse_options(int argc, char **argv, bench_options *opt)
+{
+    memset(opt, 0, sizeof(bench_options));
+    opt->format = FORMAT_TEXT;
+    opt->header = 1;
+    opt->cpu = -1;
+    opt->duration = 2;
+    opt->smt = 1;
+
+    for (int i = 1; i < argc; i++) {
+        if (strncmp(argv[i], "--filter=", 9) == 0) {
+            opt->filter = argv[i] + 9;
+        } else if (strcmp(argv[i], "--format=text") == 0) {
+            opt->format = FORMAT_TEXT;
+        } else if (strcmp(argv[i], "--format=json") == 0) {
+            opt->format = FORMAT_JSON;
+        } else if (strcmp(argv[i], "--format=csv") == 0) {
+            opt->format = FORMAT_CSV;
+        } else if (strcmp(argv[i], "--no-header") == 0) {
+            opt->header = 0;
+        } else if (strncmp(argv[i], "--cpu=", 6) == 0) {
+            opt->cpu = atoi(argv[i] + 6);
+        } else if (strncmp(argv[i], "--samples=", 10) == 0) {
+            opt->samples = (unsigned int)strtoul(argv[i] + 10, NULL, 10);
+        } else if (strncmp(argv[i], "--warmup=", 9) == 0) {
+            opt->warmup = (unsigned int)strtoul(argv[i] + 9, NULL, 10);
+        } else if (strcmp(argv[i], "--list") == 0) {
+            opt->list = 1;
+        } else if (strncmp(argv[i], "--threads=", 10) == 0) {
+            opt->threads = (unsigned int)strtoul(argv[i] + 10, NULL, 10);
+        } else if (strncmp(argv[i], "--duration=", 11) == 0) {
+            opt->duration = atof(argv[i] + 11);
+        } else if (strcmp(argv[i], "--pin") == 0) {
+            opt->pin = 1;
+        } else if (strcmp(argv[i], "--smt=on") == 0) {
+            opt->smt = 1;
+        } else if (strcmp(argv[i], "--smt=off") == 0) {
+            opt->smt = 0;
+            opt->pin = 1;
+        } else if (strcmp(argv[i], "--cold=flush") == 0) {
+            opt->cold = COLD_FLUSH;
+        } else if (strcmp(argv[i], "--cold=thrash") == 0) {
+            opt->cold = COLD_THRASH;
+        } else if (strncmp(argv[i], "--thrash-mb=", 12) == 0) {
+            opt->thrash_mb = (unsigned int)strtoul(argv[i] + 12, NULL, 10);
+        } else if (strcmp(argv[i], "--pages") == 0) {
+            opt->pages = 1;
+        } else if (strcmp(argv[i], "--tables") == 0) {
+            opt->tables = 1;
+        } else if (strcmp(argv[i], "--hugepages") == 0) {
+            opt->hugepages = 1;
+        } else if (strcmp(argv[i], "--footprint") == 0) {
+            opt->footprint = 1;
+        } else {
+            fprintf(stderr, "Usage: %s [--filter=substr[,substr...]] [--format=text|json|csv] [--no-header] [--cpu=n] [--samples=n] [--warmup=n] [--list]\n", argv[0]);
+            fprintf(stderr, "       %s --threads=n [--duration=s] [--pin] [--smt=on|off] [--format=text|json|csv] [--no-header]\n", argv[0]);
+            fprintf(stderr, "       %s --cold=flush|thrash [--thrash-mb=n] [--hugepages] [options of the first form]\n", argv[0]);
+            fprintf(stderr, "       %s --pages [--filter=substr[,substr...]] [--format=text|json|csv] [--no-header]\n", argv[0]);
+            fprintf(stderr, "       %s --tables [--filter=substr[,substr...]] [--format=text|json|csv] [--no-header]\n", argv[0]);
+            fprintf(stderr, "       %s --footprint [--filter=substr[,substr...]] [--format=text|json|csv] [--no-header]\n", argv[0]);
+            return FAILED;
+        }
+    }
+#if !defined(CACHE_FLUSH_SUPPORTED)
+    if (opt->cold == COLD_FLUSH) {
+        fprintf(stderr, "Cache-line flushes are not supported on this platform, using --cold=thrash\n");
+        opt->cold = COLD_THRASH;
+    }
+#endif
+    if (opt->thrash_mb == 0) opt->thrash_mb = THRASH_MB;
+    return PASSED;
+}
+
+
+int main(int argc, char **argv)
+{
+    bench_options opt;
+    unsigned int i;
+
+    if (parse_options(argc, argv, &opt) != PASSED) {
+        return FAILED;
+    }
+    if (opt.list) {
+        for (i = 0; i < NUM_BENCHMARKS; i++) printf("%s/%s\n", benchmarks[i].layer, benchmarks[i].name);
+        return PASSED;
+    }
+    if (opt.footprint) {
+#if defined(__NIX__)
+        bench_setup();
+        return run_footprint(&opt);
+#else
+        fprintf(stderr, "Footprint mode is not supported on this platform\n");
+        return FAILED;
+#endif
+    }
+    if (opt.tables) {
+        return run_tables(&opt);
+    }
+    if (opt.threads != 0) {
+#if defined(__NIX__)
+        return run_throughput(&opt);
+#else
+        fprintf(stderr, "Throughput mode is not supported on this platform\n");
+        return FAILED;
+#endif
+    }
+    if (opt.cpu >= 0 && pin_to_cpu(opt.cpu) != 0) {
+        fprintf(stderr, "Could not pin to CPU %d\n", opt.cpu);
+        return FAILED;
+    }
+    if (opt.hugepages) {
+#ifdef COMPRESS
+        if (tables_hugepages() != 0) {
+            fprintf(stderr, "Huge pages are not available\n");
+            return FAILED;
+        }
+#else
+        fprintf(stderr, "--hugepages only applies to the compressed variants\n");
+        return FAILED;
+#endif
+    }
+
+    bench_setup();
+
+    if (opt.pages) {
+#if defined(__linux__)
+        return run_pages(&opt);
+#else
+        fprintf(stderr, "Page-touch accounting is not supported on this platform\n");
+        return FAILED;
+#endif
+    }
+    if (opt.cold == COLD_THRASH) {
+        thrash_bytes = (size_t)opt.thrash_mb << 20;
+        thrash_buffer = (unsigned char*)calloc(thrash_bytes, 1);
+        if (thrash_buffer == NULL) return FAILED;
+    }
+
+    if (opt.format == FORMAT_TEXT) {
+        printf("\n\nBENCHMARKING %s\n", SCHEME_NAME);
+        printf("--------------------------------------------------------------------------------------------------------\n\n");
+        printf("  %-5s %-29s %-5s %12s %12s %12s %12s %10s %12s\n", "layer", "function", "cache", "median", "p90", "p99", "min", "stddev", "median");
+        printf("  %-5s %-29s %-5s %12s %12s %12s %12s %10s %12s\n", "", "", "", "(cycles)", "(cycles)", "(cycles)", "(cycles)", "(cycles)", "(ns)");
+    } else if (opt.format == FORMAT_CSV && opt.header) {
+        printf("scheme,layer,name,cache,samples,batch,median_cycles,p90_cycles,p99_cycles,min_cycles,stddev_cycles,median_ns,p90_ns,p99_ns,min_ns,stddev_ns\n");
+    }
+
+    for (i = 0; i < NUM_BENCHMARKS; i++) {
+        if (!bench_selected(opt.filter, &benchmarks[i])) continue;
+        if (run_benchmark(&opt, &benchmarks[i]) != PASSED) {
+            return FAILED;
+        }
+        fflush(stdout);
+    }
+    free(thrash_buffer);
+
+    return PASSED;
+}
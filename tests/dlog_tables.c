@@ -0,0 +1,251 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/PQCrypto-SIDH
+* Released under MIT license
+*
+* Abstract: generator of the Pohlig-Hellman paths and tables for any window sizes W_2 and W_3.
+*           This file is included by the dlog_tables_pXXX.c file of each prime.
+*
+* Usage: dlog_tables-pXXX [--w2=n] [--w3=n] [--verify]
+*        dlog_tables-pXXX --store=file
+*
+* The generated tables are written to stdout in the format of PXXX_compressed_dlog_tables.c.
+* The tables are computed from the torsion bases of the starting curve (see tables_gen.c).
+* With --verify, the pairing tables and the Pohlig-Hellman tables for the shipped window sizes
+* are recomputed and compared against the ones compiled into the library.
+* With --store, the precomputed tables of the library (for the window sizes it was compiled with)
+* are written to a table store to be mapped with tables_map() (see the tables_store_pXXX targets).
+*********************************************************************************************/
+
+#include <stdlib.h>
+#include <inttypes.h>
+
+
+typedef struct {
+    int w2, w3;
+    int dlen2, dlen3;
+    unsigned int *path2, *path3;
+    felm_t *Texp, *G, *CT2;              // Torus representation, i.e., x/y for the element [x:y]
+    int *Log;
+    f2elm_t *T, *T1, *T2;                // T for the case W_3 | eB, T1 and T2 otherwise
+    unsigned int nTexp, nLog, nG, nCT2, nT;
+    // Pairing tables
+    uint64_t tate3[(6*(OBOB_EXPON - 1) + 4)*NWORDS64_FIELD];
+    uint64_t tate2_firststep_P[4*NWORDS64_FIELD], tate2_P[3*(OALICE_BITS - 2)*NWORDS64_FIELD];
+    uint64_t tate2_firststep_Q[4*NWORDS64_FIELD], tate2_Q[3*(OALICE_BITS - 2)*NWORDS64_FIELD];
+} dlog_params;
+
+
+static int gen_tables(dlog_params *prm)
+{ // Pairing tables, then the Pohlig-Hellman tables for the generators g2 = e(PA,QA) and g3 = e(PB,QB)
+    int w = prm->w2, half;
+    f2elm_t g2, g3;
+
+    pairing_tables(prm->tate3, prm->tate2_firststep_P, prm->tate2_P, prm->tate2_firststep_Q, prm->tate2_Q, g2, g3);
+
+    if (w < 4 || OALICE_BITS % w != 0) {
+        fprintf(stderr, "W_2 must be at least 4 and divide eA = %d\n", OALICE_BITS);
+        return 1;
+    }
+    prm->dlen2 = OALICE_BITS/w;
+    prm->nCT2 = prm->dlen2*(1 << (w - 1));
+    prm->nTexp = (1 << (w - 3)) - 1;
+    prm->nLog = (1 << (w - 1)) - 1;
+    prm->nG = 1 << (w - 2);
+    prm->path2 = (unsigned int*)calloc(prm->dlen2 + 1, sizeof(unsigned int));
+    prm->CT2 = (felm_t*)calloc(prm->nCT2, sizeof(felm_t));
+    prm->Texp = (felm_t*)calloc(prm->nTexp, sizeof(felm_t));
+    prm->Log = (int*)calloc(prm->nLog, sizeof(int));
+    prm->G = (felm_t*)calloc(prm->nG, sizeof(felm_t));
+    if (ph2_tables(g2, w, prm->path2, prm->CT2, prm->Texp, prm->Log, prm->G) != 0) {
+        fprintf(stderr, "The tables for ell = 2 could not be computed\n");
+        return 1;
+    }
+
+    w = prm->w3;
+    if (w < 1 || w > 8) {
+        fprintf(stderr, "W_3 must be between 1 and 8\n");
+        return 1;
+    }
+    half = 1;
+    for (int i = 0; i < w; i++) half *= 3;
+    half >>= 1;
+    prm->dlen3 = (OBOB_EXPON + w - 1)/w;
+    prm->nT = prm->dlen3*half;
+    prm->path3 = (unsigned int*)calloc(prm->dlen3 + 1, sizeof(unsigned int));
+    if (OBOB_EXPON % w == 0) {
+        prm->T = (f2elm_t*)calloc(prm->nT, sizeof(f2elm_t));
+        if (ph3_tables(g3, w, prm->path3, prm->T, NULL) != 0) return 1;
+    } else {
+        prm->T1 = (f2elm_t*)calloc(prm->nT, sizeof(f2elm_t));
+        prm->T2 = (f2elm_t*)calloc(prm->nT, sizeof(f2elm_t));
+        if (ph3_tables(g3, w, prm->path3, prm->T1, prm->T2) != 0) return 1;
+    }
+    return 0;
+}
+
+
+/************************************** Output **************************************/
+
+static void print_words(const void *data, size_t nwords)
+{
+    const uint64_t *x = (const uint64_t*)data;
+
+    for (size_t i = 0; i < nwords; i++) {
+        printf("%s0x%" PRIX64 ",", (i % 8 == 0) ? "\n\t\t" : "", x[i]);
+    }
+    printf("\n");
+}
+
+
+static void print_path(const char *name, const char *len, const unsigned int *P, int n)
+{
+    printf("const unsigned int %s[%s] = {", name, len);
+    for (int i = 0; i <= n; i++) printf("%s%u%s", (i % 20 == 0) ? "\n\t" : "", P[i], (i < n) ? ", " : "");
+    printf("\n};\n\n");
+}
+
+
+static void print_tables(const dlog_params *prm)
+{
+    printf("/********************************************************************************************\n");
+    printf("* SIDH: an efficient supersingular isogeny cryptography library\n");
+    printf("* Copyright (c) Microsoft Corporation\n");
+    printf("*\n");
+    printf("* Website: https://github.com/microsoft/PQCrypto-SIDH\n");
+    printf("* Released under MIT license\n");
+    printf("*\n");
+    printf("* Abstract: precomputed tables for Pohlig-Hellman when using compression, W_2 = %d and W_3 = %d\n", prm->w2, prm->w3);
+    printf("*           Generated by dlog_tables-p%s, do not edit\n", DLOG_PRIME);
+    printf("*********************************************************************************************/ \n\n");
+    printf("#if (W_2 != %d) || (W_3 != %d)\n", prm->w2, prm->w3);
+    printf("    #error \"The Pohlig-Hellman tables were generated for W_2 = %d and W_3 = %d\"\n", prm->w2, prm->w3);
+    printf("#endif\n\n");
+
+    printf("// Fixed traversal strategies for Pohlig-Hellman discrete logs\n");
+    print_path("ph2_path", "PLEN_2", prm->path2, prm->dlen2);
+    print_path("ph3_path", "PLEN_3", prm->path3, prm->dlen3);
+
+    printf("// Texp table for ell=2, W2=%d, W2_1=%d\n", prm->w2, prm->w2 - 1);
+    printf("CACHE_ALIGN const uint64_t ph2_Texp[((1<<(W_2_1-2))-1)*NWORDS64_FIELD] = {");
+    print_words(prm->Texp, prm->nTexp*NWORDS64_FIELD);
+    printf("};\n\n");
+
+    printf("// Log table for ell=2, W2_1=%d\n", prm->w2 - 1);
+    printf("const int ph2_Log[(1<<(W_2_1))-1] = {");
+    for (unsigned int i = 0; i < prm->nLog; i++) printf("%s%d,", (i % 32 == 0) ? "\n\t\t" : " ", prm->Log[i]);
+    printf("\n};\n\n");
+
+    printf("// G table for ell=2, W2=W2_1+W2_2=%d\n", prm->w2);
+    printf("CACHE_ALIGN const uint64_t ph2_G[(1<<(W_2-2))*NWORDS64_FIELD] = {");
+    print_words(prm->G, prm->nG*NWORDS64_FIELD);
+    printf("};\n\n");
+
+    printf("// TORUS + SIGNED W2=%d\n", prm->w2);
+    printf("CACHE_ALIGN const uint64_t ph2_CT[DLEN_2*(ELL2_W >> 1)*NWORDS64_FIELD] = {");
+    print_words(prm->CT2, prm->nCT2*NWORDS64_FIELD);
+    printf("};\n\n");
+
+    printf("// FULL SIGNED W3=%d\n", prm->w3);
+    if (prm->T != NULL) {
+        printf("CACHE_ALIGN const uint64_t ph3_T[DLEN_3*(ELL3_W>>1)*2*NWORDS64_FIELD] = {");
+        print_words(prm->T, prm->nT*2*NWORDS64_FIELD);
+        printf("};\n");
+        printf("const uint64_t *ph3_T1 = {0};\n");
+        printf("const uint64_t *ph3_T2 = {0};\n");
+    } else {
+        printf("const uint64_t *ph3_T = {0};\n");
+        printf("CACHE_ALIGN const uint64_t ph3_T1[DLEN_3*(ELL3_W>>1)*2*NWORDS64_FIELD] = {");
+        print_words(prm->T1, prm->nT*2*NWORDS64_FIELD);
+        printf("};\n");
+        printf("CACHE_ALIGN const uint64_t ph3_T2[DLEN_3*(ELL3_W>>1)*2*NWORDS64_FIELD] = {");
+        print_words(prm->T2, prm->nT*2*NWORDS64_FIELD);
+        printf("};\n");
+    }
+}
+
+
+static int check(const char *name, const void *generated, const void *shipped, size_t bytes)
+{
+    int ok = (memcmp(generated, shipped, bytes) == 0);
+
+    printf("  %-20s %8zu bytes .............................. %s\n", name, bytes, ok ? "PASSED" : "FAILED");
+    return ok;
+}
+
+
+static int verify_tables(const dlog_params *prm)
+{ // Compare the tables generated for the shipped window sizes against the ones compiled into the library
+    int ok = 1;
+
+    printf("\n\nVERIFYING PAIRING AND POHLIG-HELLMAN TABLES FOR %s (W_2 = %d, W_3 = %d)\n", DLOG_PRIME_NAME, W_2, W_3);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+    ok &= check("T_tate3", prm->tate3, T_tate3, sizeof(T_tate3));
+    ok &= check("T_tate2_firststep_P", prm->tate2_firststep_P, T_tate2_firststep_P, sizeof(T_tate2_firststep_P));
+    ok &= check("T_tate2_P", prm->tate2_P, T_tate2_P, sizeof(T_tate2_P));
+    ok &= check("T_tate2_firststep_Q", prm->tate2_firststep_Q, T_tate2_firststep_Q, sizeof(T_tate2_firststep_Q));
+    ok &= check("T_tate2_Q", prm->tate2_Q, T_tate2_Q, sizeof(T_tate2_Q));
+    ok &= check("ph2_path", prm->path2, ph2_path, sizeof(ph2_path));
+    ok &= check("ph3_path", prm->path3, ph3_path, sizeof(ph3_path));
+    ok &= check("ph2_Texp", prm->Texp, ph2_Texp, sizeof(ph2_Texp));
+    ok &= check("ph2_Log", prm->Log, ph2_Log, sizeof(ph2_Log));
+    ok &= check("ph2_G", prm->G, ph2_G, sizeof(ph2_G));
+    // The last row of ph2_CT is never read by the traversal, and is zero in some of the shipped tables
+    ok &= check("ph2_CT", prm->CT2, ph2_CT, sizeof(ph2_CT) - (ELL2_W >> 1)*NWORDS64_FIELD*sizeof(uint64_t));
+#if (OBOB_EXPON % W_3 == 0)
+    ok &= check("ph3_T", prm->T, ph3_T, sizeof(ph3_T));
+#else
+    ok &= check("ph3_T1", prm->T1, ph3_T1, sizeof(ph3_T1));
+    ok &= check("ph3_T2", prm->T2, ph3_T2, sizeof(ph3_T2));
+#endif
+    return ok ? PASSED : FAILED;
+}
+
+
+int main(int argc, char **argv)
+{
+    static dlog_params prm;
+    const char *store = NULL;
+    int verify = 0;
+
+    prm.w2 = W_2;
+    prm.w3 = W_3;
+    for (int i = 1; i < argc; i++) {
+        if (strncmp(argv[i], "--w2=", 5) == 0) {
+            prm.w2 = atoi(argv[i] + 5);
+        } else if (strncmp(argv[i], "--w3=", 5) == 0) {
+            prm.w3 = atoi(argv[i] + 5);
+        } else if (strcmp(argv[i], "--verify") == 0) {
+            verify = 1;
+        } else if (strncmp(argv[i], "--store=", 8) == 0) {
+            store = argv[i] + 8;
+        } else {
+            fprintf(stderr, "Usage: %s [--w2=n] [--w3=n] [--verify]\n", argv[0]);
+            fprintf(stderr, "       %s --store=file\n", argv[0]);
+            return FAILED;
+        }
+    }
+    if (store != NULL) {
+        if (tables_write(store) != 0 || tables_map(store) != 0) {
+            fprintf(stderr, "Could not write the table store %s\n", store);
+            return FAILED;
+        }
+        printf("Table store of %s (W_2 = %d, W_3 = %d) written to %s\n", CRYPTO_ALGNAME, W_2, W_3, store);
+        return PASSED;
+    }
+    if (verify) {
+        prm.w2 = W_2;
+        prm.w3 = W_3;
+    }
+
+    if (gen_tables(&prm) != 0) {
+        return FAILED;
+    }
+    if (verify) {
+        return verify_tables(&prm);
+    }
+    print_tables(&prm);
+    return PASSED;
+}
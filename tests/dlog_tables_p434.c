@@ -0,0 +1,21 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/PQCrypto-SIDH
+* Released under MIT license
+*
+* Abstract: generator of the Pohlig-Hellman tables for SIDHp434_compressed and SIKEp434_compressed
+*********************************************************************************************/ 
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#define TABLES_GENERATOR
+#include "../src/P434/P434_compressed.c"
+
+
+#define DLOG_PRIME        "434"
+#define DLOG_PRIME_NAME   "p434"
+
+#include "dlog_tables.c"
@@ -0,0 +1,21 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/PQCrypto-SIDH
+* Released under MIT license
+*
+* Abstract: generator of the Pohlig-Hellman tables for SIDHp503_compressed and SIKEp503_compressed
+*********************************************************************************************/ 
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#define TABLES_GENERATOR
+#include "../src/P503/P503_compressed.c"
+
+
+#define DLOG_PRIME        "503"
+#define DLOG_PRIME_NAME   "p503"
+
+#include "dlog_tables.c"
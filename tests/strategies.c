@@ -0,0 +1,245 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/PQCrypto-SIDH
+* Released under MIT license
+*
+* Abstract: generator of the isogeny tree traversal strategies that store at most k points.
+*           This file is included by the strategies_pXXX.c file of each prime.
+*
+* Usage: strategies-pXXX --k=n[,n...] [--verify]
+*
+* For each bound k, the strategies strat_Alice and strat_Bob with the fewest operations among those that store at most k
+* intermediate points are written to stdout in the format of PXXX_strategies.c. With a single bound, the output is the
+* PXXX_strategies_generated.c file used for bounds without shipped strategies.
+* Operations are weighted by the multiplications in GF(p) of their multiplications (3) and squarings (2) in GF(p^2): a step
+* down the tree costs two xDBL (Alice) or one xTPL (Bob), and pushing a stored point through an isogeny costs one eval_4_isog
+* (Alice) or eval_3_isog (Bob).
+* With --verify, the strategies without bound are checked to cost no more than the shipped ones, the shipped ones to store
+* at most MAX_INT_POINTS_ALICE and MAX_INT_POINTS_BOB points, and the generated ones to traverse the whole tree storing at most k points.
+*********************************************************************************************/
+
+#include <stdlib.h>
+
+#define COST_FP2MUL     3
+#define COST_FP2SQR     2
+#define COST_ALICE_P    (2*(4*COST_FP2MUL + 2*COST_FP2SQR))    // 2 xDBL
+#define COST_ALICE_Q    (6*COST_FP2MUL + 2*COST_FP2SQR)        // eval_4_isog
+#define COST_BOB_P      (7*COST_FP2MUL + 5*COST_FP2SQR)        // xTPL
+#define COST_BOB_Q      (4*COST_FP2MUL + 2*COST_FP2SQR)        // eval_3_isog
+
+#define MAX_BOUNDS      16
+
+typedef struct {
+    const char *name;
+    int n;                               // Number of leaves, i.e., of isogenies
+    long long p, q;
+    const unsigned int *shipped;
+    int shipped_points;
+} strategy_params;
+
+
+static void strategy_moves(unsigned int *S, int *pos, const int *B, int k, int z, int j)
+{
+    int b;
+
+    if (z == 1) return;
+    b = B[z*(k + 1) + j];
+    S[(*pos)++] = (unsigned int)b;
+    strategy_moves(S, pos, B, k, z - b, j - 1);
+    strategy_moves(S, pos, B, k, b, j);
+}
+
+
+static int optimal_strategy(unsigned int *S, int n, int k, long long p, long long q, long long *cost)
+{ // Strategy with the fewest operations for a tree with n leaves that stores at most k points: a step down the tree costs p and
+  // pushing a stored point through an isogeny costs q. At a node with z leaves, the traversal stores the current point, moves b steps
+  // down to a subtree with z - b leaves traversed with at most k - 1 more points, and resumes from the stored point in a subtree with
+  // b leaves. S receives the n - 1 moves b in the order of sidh.c. Ties are resolved towards smaller moves.
+    long long *C = (long long*)calloc((size_t)(n + 1)*(k + 1), sizeof(long long));    // C[z*(k+1)+j] < 0: no strategy with j points
+    int *B = (int*)calloc((size_t)(n + 1)*(k + 1), sizeof(int));
+    int pos = 0;
+
+    if (C == NULL || B == NULL) {
+        free(C);
+        free(B);
+        return 1;
+    }
+    for (int z = 2; z <= n; z++) {
+        C[z*(k + 1)] = -1;
+        for (int j = 1; j <= k; j++) {
+            C[z*(k + 1) + j] = -1;
+            for (int b = 1; b < z; b++) {
+                long long left = C[(z - b)*(k + 1) + j - 1], c;
+                if (left < 0) continue;
+                c = left + C[b*(k + 1) + j] + b*p + (z - b)*q;
+                if (C[z*(k + 1) + j] < 0 || c < C[z*(k + 1) + j]) {
+                    C[z*(k + 1) + j] = c;
+                    B[z*(k + 1) + j] = b;
+                }
+            }
+        }
+    }
+    *cost = C[n*(k + 1) + k];
+    strategy_moves(S, &pos, B, k, n, k);
+    free(C);
+    free(B);
+    return 0;
+}
+
+
+static int traverse(const unsigned int *S, int n, long long p, long long q, long long *cost)
+{ // Traversal of sidh.c with the strategy S: returns the largest number of stored points, or -1 if S is not a valid strategy
+    int *pts_index = (int*)calloc(n, sizeof(int));
+    int row, index = 0, npts = 0, ii = 0, max_pts = 0;
+
+    if (pts_index == NULL) return -1;
+    *cost = 0;
+    for (row = 1; row < n; row++) {
+        while (index < n - row) {
+            if (ii == n - 1 || S[ii] == 0) {
+                free(pts_index);
+                return -1;
+            }
+            pts_index[npts++] = index;
+            if (npts > max_pts) max_pts = npts;
+            index += (int)S[ii];
+            *cost += S[ii++]*p;
+        }
+        *cost += npts*q;
+        index = pts_index[--npts];
+    }
+    free(pts_index);
+    return (ii == n - 1) ? max_pts : -1;
+}
+
+
+static void print_strategy(const char *name, const char *len, const unsigned int *S, int n, const char *indent)
+{
+    printf("%sconst unsigned int %s[%s] = {", indent, name, len);
+    for (int i = 0; i < n - 1; i++) printf("%s%u%s", (i % 30 == 0) ? "\n    " : "", S[i], (i < n - 2) ? ", " : "");
+    printf(" };\n\n");
+}
+
+
+static int print_bound(const strategy_params *prm, int k)
+{ // Strategies for the bound k and their cost relative to the shipped ones
+    long long shipped_cost, cost;
+
+    for (int s = 0; s < 2; s++) {
+        unsigned int *S = (unsigned int*)calloc(prm[s].n, sizeof(unsigned int));
+        if (S == NULL || optimal_strategy(S, prm[s].n, k, prm[s].p, prm[s].q, &cost) != 0) {
+            free(S);
+            return 1;
+        }
+        traverse(prm[s].shipped, prm[s].n, prm[s].p, prm[s].q, &shipped_cost);
+        printf("// At most %d points, %+.1f%% operations\n", k, 100.0*(cost - shipped_cost)/shipped_cost);
+        print_strategy(prm[s].name, (s == 0) ? "MAX_Alice-1" : "MAX_Bob-1", S, prm[s].n, "");
+        free(S);
+    }
+    return 0;
+}
+
+
+static int print_strategies(const strategy_params *prm, const int *k, int nk)
+{
+    printf("/********************************************************************************************\n");
+    printf("* SIDH: an efficient supersingular isogeny cryptography library\n");
+    printf("* Copyright (c) Microsoft Corporation\n");
+    printf("*\n");
+    printf("* Website: https://github.com/microsoft/PQCrypto-SIDH\n");
+    printf("* Released under MIT license\n");
+    printf("*\n");
+    printf("* Abstract: isogeny tree traversal strategies storing at most SIKE_MAX_STORED_POINTS points\n");
+    printf("*           Generated by strategies-p%s, do not edit\n", STRATEGY_PRIME);
+    printf("*********************************************************************************************/ \n\n");
+    printf("// Strategies with the fewest operations for the bound, with their number of operations relative to the default strategies\n");
+    printf("// (multiplications in GF(p) of the doublings or triplings and isogeny evaluations)\n\n");
+
+    if (nk == 1) {
+        printf("#if (SIKE_MAX_STORED_POINTS != %d)\n", k[0]);
+        printf("    #error \"The strategies were generated for SIKE_MAX_STORED_POINTS = %d\"\n", k[0]);
+        printf("#endif\n\n");
+        return print_bound(prm, k[0]);
+    }
+    for (int i = 0; i < nk; i++) {
+        printf("%s (SIKE_MAX_STORED_POINTS == %d)\n\n", (i == 0) ? "#if" : "#elif", k[i]);
+        if (print_bound(prm, k[i]) != 0) return 1;
+    }
+    printf("#else\n\n");
+    printf("// Strategies for other bounds, written by \"make strategies_p%s SIKE_MAX_STORED_POINTS=k\"\n", STRATEGY_PRIME);
+    printf("#include \"P%s_strategies_generated.c\"\n\n", STRATEGY_PRIME);
+    printf("#endif\n");
+    return 0;
+}
+
+
+static int verify_strategies(const strategy_params *prm)
+{ // The strategies without bound cost no more than the shipped ones, and the ones with bounds up to MAX_INT_POINTS_XXX respect them
+    long long shipped_cost, cost, traversal_cost;
+    int ok = 1, pts;
+
+    printf("\n\nVERIFYING ISOGENY STRATEGIES FOR %s\n", STRATEGY_PRIME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+    for (int s = 0; s < 2; s++) {
+        unsigned int *S = (unsigned int*)calloc(prm[s].n, sizeof(unsigned int));
+        int passed;
+
+        if (S == NULL) return FAILED;
+        pts = traverse(prm[s].shipped, prm[s].n, prm[s].p, prm[s].q, &shipped_cost);
+        passed = (pts >= 1 && pts <= prm[s].shipped_points);
+        printf("  %-12s shipped, k = %d ............................................ %s\n", prm[s].name, pts, passed ? "PASSED" : "FAILED");
+        ok &= passed;
+
+        optimal_strategy(S, prm[s].n, prm[s].n, prm[s].p, prm[s].q, &cost);
+        passed = (cost <= shipped_cost);
+        printf("  %-12s no bound, %+.2f%% operations ............................... %s\n", prm[s].name, 100.0*(cost - shipped_cost)/shipped_cost, passed ? "PASSED" : "FAILED");
+        ok &= passed;
+
+        for (int k = 1; k <= prm[s].shipped_points; k++) {
+            optimal_strategy(S, prm[s].n, k, prm[s].p, prm[s].q, &cost);
+            pts = traverse(S, prm[s].n, prm[s].p, prm[s].q, &traversal_cost);
+            passed = (pts >= 1 && pts <= k && traversal_cost == cost);
+            printf("  %-12s k = %d, %+6.1f%% operations ................................. %s\n", prm[s].name, k, 100.0*(cost - shipped_cost)/shipped_cost, passed ? "PASSED" : "FAILED");
+            ok &= passed;
+        }
+        free(S);
+    }
+    return ok ? PASSED : FAILED;
+}
+
+
+int main(int argc, char **argv)
+{
+    const strategy_params prm[2] = {
+        {"strat_Alice", MAX_Alice, COST_ALICE_P, COST_ALICE_Q, strat_Alice, MAX_INT_POINTS_ALICE},
+        {"strat_Bob", MAX_Bob, COST_BOB_P, COST_BOB_Q, strat_Bob, MAX_INT_POINTS_BOB}
+    };
+    int k[MAX_BOUNDS], nk = 0, verify = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strncmp(argv[i], "--k=", 4) == 0) {
+            for (char *s = argv[i] + 4; *s != '\0' && nk < MAX_BOUNDS; s++) {
+                k[nk] = (int)strtol(s, &s, 10);
+                if (k[nk] < 1) nk = MAX_BOUNDS + 1;
+                nk++;
+                if (*s != ',') break;
+            }
+        } else if (strcmp(argv[i], "--verify") == 0) {
+            verify = 1;
+        } else {
+            nk = MAX_BOUNDS + 1;
+        }
+    }
+    if ((nk == 0 && !verify) || nk > MAX_BOUNDS) {
+        fprintf(stderr, "Usage: %s --k=n[,n...] [--verify]\n", argv[0]);
+        fprintf(stderr, "       The bounds n are at least 1\n");
+        return FAILED;
+    }
+
+    if (verify) {
+        return verify_strategies(prm);
+    }
+    return (print_strategies(prm, k, nk) == 0) ? PASSED : FAILED;
+}
@@ -9,6 +9,7 @@
 *********************************************************************************************/ 
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include "test_extras.h"
 #include "../src/P751/P751_compressed_api.h"
@@ -22,5 +23,13 @@
 #define EphemeralKeyGeneration_B      EphemeralKeyGeneration_B_SIDHp751_Compressed
 #define EphemeralSecretAgreement_A    EphemeralSecretAgreement_A_SIDHp751_Compressed
 #define EphemeralSecretAgreement_B    EphemeralSecretAgreement_B_SIDHp751_Compressed
+#define EphemeralSecretAgreement_B_Uncompressed  EphemeralSecretAgreement_B_Uncompressed_SIDHp751_Compressed
+#define PublicKeyDecompression_A      PublicKeyDecompression_A_SIDHp751_Compressed
+#define PublicKeyCompression_A        PublicKeyCompression_A_SIDHp751_Compressed
+#define crypto_kem_workspace_size     crypto_kem_workspace_size_SIKEp751_compressed
+#define EphemeralKeyGeneration_A_ws   EphemeralKeyGeneration_A_ws_SIDHp751_Compressed
+#define EphemeralKeyGeneration_B_ws   EphemeralKeyGeneration_B_ws_SIDHp751_Compressed
+#define EphemeralSecretAgreement_A_ws EphemeralSecretAgreement_A_ws_SIDHp751_Compressed
+#define EphemeralSecretAgreement_B_ws EphemeralSecretAgreement_B_ws_SIDHp751_Compressed
 
 #include "test_sidh.c"
\ No newline at end of file
@@ -19,5 +19,19 @@
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp610
 #define crypto_kem_enc                crypto_kem_enc_SIKEp610
 #define crypto_kem_dec                crypto_kem_dec_SIKEp610
+#define crypto_kem_keypair_derand     crypto_kem_keypair_derand_SIKEp610
+#define crypto_kem_enc_derand         crypto_kem_enc_derand_SIKEp610
+#define crypto_kem_expand_pk          crypto_kem_expand_pk_SIKEp610
+#define crypto_kem_enc_expanded       crypto_kem_enc_expanded_SIKEp610
+#define crypto_kem_keystore_write     crypto_kem_keystore_write_SIKEp610
+#define crypto_kem_keystore_open      crypto_kem_keystore_open_SIKEp610
+#define crypto_kem_keystore_take      crypto_kem_keystore_take_SIKEp610
+#define crypto_kem_keystore_remaining crypto_kem_keystore_remaining_SIKEp610
+#define crypto_kem_keystore_close     crypto_kem_keystore_close_SIKEp610
+#define opcount_get                   opcount_get_SIKEp610
+#define opcount_reset                 opcount_reset_SIKEp610
+#define sike_stats_enable             sike_stats_enable_SIKEp610
+#define sike_stats_snapshot           sike_stats_snapshot_SIKEp610
+#define sike_stats_reset              sike_stats_reset_SIKEp610
 
 #include "test_sike.c"
\ No newline at end of file
@@ -19,5 +19,7 @@
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp751_compressed
 #define crypto_kem_enc                crypto_kem_enc_SIKEp751_compressed
 #define crypto_kem_dec                crypto_kem_dec_SIKEp751_compressed
+#define crypto_kem_keypair_derand     crypto_kem_keypair_derand_SIKEp751_compressed
+#define crypto_kem_enc_derand         crypto_kem_enc_derand_SIKEp751_compressed
 
 #include "test_sike.c"
@@ -8,13 +8,20 @@
 * Abstract: utility functions for testing and benchmarking
 *********************************************************************************************/
 
+#if defined(__linux__)
+    #define _GNU_SOURCE
+#endif
 #include "test_extras.h"
 #if (OS_TARGET == OS_WIN)
     #include <intrin.h>
+    #include <windows.h>
 #endif
-#if (OS_TARGET == OS_NIX) && (TARGET == TARGET_ARM || TARGET == TARGET_ARM64)
+#if (OS_TARGET == OS_NIX)
     #include <time.h>
 #endif
+#if defined(__linux__)
+    #include <sched.h>
+#endif
 #include <stdlib.h>
 
 
@@ -55,6 +62,42 @@ int64_t cpucycles(void)
 }
 
 
+int64_t nanoseconds(void)
+{ // Access monotonic clock for benchmarking, in nanoseconds
+#if (OS_TARGET == OS_WIN)
+    LARGE_INTEGER count, freq;
+
+    QueryPerformanceCounter(&count);
+    QueryPerformanceFrequency(&freq);
+    return (int64_t)((double)count.QuadPart*1e9/(double)freq.QuadPart);
+#elif (OS_TARGET == OS_NIX)
+    struct timespec time;
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (int64_t)time.tv_sec*1000000000 + time.tv_nsec;
+#else
+    return 0;
+#endif
+}
+
+
+int pin_to_cpu(int cpu)
+{ // Pin the calling thread to logical CPU "cpu". Returns 0 on success, 1 if not supported or failed
+#if defined(__linux__)
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return (sched_setaffinity(0, sizeof(cpu_set_t), &set) == 0) ? 0 : 1;
+#elif (OS_TARGET == OS_WIN)
+    return (SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << cpu) != 0) ? 0 : 1;
+#else
+    (void)cpu;
+    return 1;
+#endif
+}
+
+
 int compare_words(digit_t* a, digit_t* b, unsigned int nwords)
 { // Comparing "nword" elements, a=b? : (1) a>b, (0) a=b, (-1) a<b
   // SECURITY NOTE: this function does not have constant-time execution. TO BE USED FOR TESTING ONLY.
@@ -27,6 +27,12 @@
 // Access system counter for benchmarking
 int64_t cpucycles(void);
 
+// Access monotonic clock for benchmarking, in nanoseconds
+int64_t nanoseconds(void);
+
+// Pin the calling thread to logical CPU "cpu". Returns 0 on success
+int pin_to_cpu(int cpu);
+
 // Comparing "nword" elements, a=b? : (1) a!=b, (0) a=b
 int compare_words(digit_t* a, digit_t* b, unsigned int nwords);
 
@@ -54,6 +54,90 @@ int cryptotest_kex()
 }
 
 
+#if defined(SIDH_PUBLICKEYBYTES_UNCOMPRESSED)
+
+int cryptotest_transcoding()
+{ // Testing the conversions of Alice's public key: compress(decompress(pk)) = pk, and Bob gets the same shared secret from both encodings
+    unsigned int i;
+    unsigned char PrivateKeyA[SIDH_SECRETKEYBYTES_A], PrivateKeyB[SIDH_SECRETKEYBYTES_B];
+    unsigned char PublicKeyA[SIDH_PUBLICKEYBYTES], PublicKeyA_[SIDH_PUBLICKEYBYTES], PublicKeyB[SIDH_PUBLICKEYBYTES];
+    unsigned char UncompressedPublicKeyA[SIDH_PUBLICKEYBYTES_UNCOMPRESSED];
+    unsigned char SharedSecretA[SIDH_BYTES], SharedSecretB[SIDH_BYTES];
+    bool passed = true;
+
+    for (i = 0; i < TEST_LOOPS; i++) 
+    {
+        random_mod_order_A(PrivateKeyA);
+        random_mod_order_B(PrivateKeyB);
+
+        EphemeralKeyGeneration_A(PrivateKeyA, PublicKeyA);
+        EphemeralKeyGeneration_B(PrivateKeyB, PublicKeyB);
+        PublicKeyDecompression_A(PublicKeyA, UncompressedPublicKeyA);
+        PublicKeyCompression_A(UncompressedPublicKeyA, &PublicKeyA[SIDH_PUBLICKEYBYTES - SIDH_BASISHINTBYTES], PublicKeyA_);
+        EphemeralSecretAgreement_A(PrivateKeyA, PublicKeyB, SharedSecretA);
+        EphemeralSecretAgreement_B_Uncompressed(PrivateKeyB, UncompressedPublicKeyA, SharedSecretB);
+
+        if (memcmp(PublicKeyA, PublicKeyA_, SIDH_PUBLICKEYBYTES) != 0 || memcmp(SharedSecretA, SharedSecretB, SIDH_BYTES) != 0) {
+            passed = false;
+            break;
+        }
+    }
+
+    if (passed == true) printf("  Public key transcoding tests ................................. PASSED");
+    else { printf("  Public key transcoding tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+#endif
+
+
+#if defined(EphemeralKeyGeneration_A_ws)
+
+int cryptotest_kex_workspace()
+{ // Testing key exchange with a workspace of the caller, which gives the same public keys and shared secrets as the stack
+    unsigned int i;
+    unsigned char PrivateKeyA[SIDH_SECRETKEYBYTES_A], PrivateKeyB[SIDH_SECRETKEYBYTES_B];
+    unsigned char PublicKeyA[SIDH_PUBLICKEYBYTES], PublicKeyA_[SIDH_PUBLICKEYBYTES];
+    unsigned char PublicKeyB[SIDH_PUBLICKEYBYTES] = {0}, PublicKeyB_[SIDH_PUBLICKEYBYTES] = {0};    // Bob's compressed keys may be shorter
+    unsigned char SharedSecretA[SIDH_BYTES], SharedSecretB[SIDH_BYTES], SharedSecretA_[SIDH_BYTES];
+    unsigned char *workspace = malloc(crypto_kem_workspace_size() + 1);
+    bool passed = true;
+
+    if (workspace == NULL) return FAILED;
+    for (i = 0; i < TEST_LOOPS; i++) 
+    {
+        random_mod_order_A(PrivateKeyA);
+        random_mod_order_B(PrivateKeyB);
+
+        // Unaligned workspace, reused across calls
+        EphemeralKeyGeneration_A_ws(PrivateKeyA, PublicKeyA, workspace + 1);
+        EphemeralKeyGeneration_B_ws(PrivateKeyB, PublicKeyB, workspace + 1);
+        EphemeralSecretAgreement_A_ws(PrivateKeyA, PublicKeyB, SharedSecretA, workspace + 1);
+        EphemeralSecretAgreement_B_ws(PrivateKeyB, PublicKeyA, SharedSecretB, workspace + 1);
+        EphemeralKeyGeneration_A(PrivateKeyA, PublicKeyA_);
+        EphemeralKeyGeneration_B(PrivateKeyB, PublicKeyB_);
+        EphemeralSecretAgreement_A(PrivateKeyA, PublicKeyB, SharedSecretA_);
+
+        if (memcmp(PublicKeyA, PublicKeyA_, SIDH_PUBLICKEYBYTES) != 0 || memcmp(PublicKeyB, PublicKeyB_, SIDH_PUBLICKEYBYTES) != 0 ||
+            memcmp(SharedSecretA, SharedSecretB, SIDH_BYTES) != 0 || memcmp(SharedSecretA, SharedSecretA_, SIDH_BYTES) != 0) {
+            passed = false;
+            break;
+        }
+    }
+    free(workspace);
+
+    if (passed == true) printf("  Key exchange tests with a workspace .......................... PASSED");
+    else { printf("  Key exchange tests with a workspace ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+#endif
+
+
 int cryptorun_kex()
 { // Benchmarking key exchange
     unsigned int n;
@@ -104,6 +188,36 @@ int cryptorun_kex()
     printf("  Bob's shared key computation runs in ......................... %10lld ", cycles_shared_B/BENCH_LOOPS); print_unit;
     printf("\n");
 
+#if defined(SIDH_PUBLICKEYBYTES_UNCOMPRESSED)
+    unsigned char UncompressedPublicKeyA[SIDH_PUBLICKEYBYTES_UNCOMPRESSED];
+    unsigned long long cycles_decompress = 0, cycles_compress = 0, cycles_shared_B_uncompressed = 0;
+
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        PublicKeyDecompression_A(PublicKeyA, UncompressedPublicKeyA);
+        cycles2 = cpucycles();
+        cycles_decompress = cycles_decompress+(cycles2-cycles1);
+
+        cycles1 = cpucycles();
+        PublicKeyCompression_A(UncompressedPublicKeyA, &PublicKeyA[SIDH_PUBLICKEYBYTES - SIDH_BASISHINTBYTES], PublicKeyA);
+        cycles2 = cpucycles();
+        cycles_compress = cycles_compress+(cycles2-cycles1);
+
+        cycles1 = cpucycles();
+        EphemeralSecretAgreement_B_Uncompressed(PrivateKeyB, UncompressedPublicKeyA, SharedSecretB);
+        cycles2 = cpucycles();
+        cycles_shared_B_uncompressed = cycles_shared_B_uncompressed+(cycles2-cycles1);
+    }
+
+    printf("  Alice's public key decompression runs in ..................... %10lld ", cycles_decompress/BENCH_LOOPS); print_unit;
+    printf("\n");
+    printf("  Alice's public key compression runs in ....................... %10lld ", cycles_compress/BENCH_LOOPS); print_unit;
+    printf("\n");
+    printf("  Bob's shared key computation (uncompressed key) runs in ...... %10lld ", cycles_shared_B_uncompressed/BENCH_LOOPS); print_unit;
+    printf("\n");
+#endif
+
     return PASSED;
 }
 
@@ -117,6 +231,20 @@ int main()
         printf("\n\n   Error detected: KEX_ERROR_SHARED_KEY \n\n");
         return FAILED;
     }
+#if defined(SIDH_PUBLICKEYBYTES_UNCOMPRESSED)
+    Status = cryptotest_transcoding();     // Test public key conversions
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEX_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+#endif
+#if defined(EphemeralKeyGeneration_A_ws)
+    Status = cryptotest_kex_workspace();   // Test key exchange with a workspace
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEX_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+#endif
 
     Status = cryptorun_kex();              // Benchmark key exchange
     if (Status != PASSED) {
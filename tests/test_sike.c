@@ -9,6 +9,16 @@
 *********************************************************************************************/ 
 
 #include "../src/random/random.h"
+#if defined(__NIX__)
+#include "../src/async/kem_async.h"
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/wait.h>
+#endif
+#if defined(_USDT_)
+#include <stdlib.h>
+#include <elf.h>
+#endif
 
 #ifdef DO_VALGRIND_CHECK
 #include <valgrind/memcheck.h>
@@ -93,6 +103,612 @@ int cryptotest_kem()
 }
 
 
+typedef struct {
+    const unsigned char *bytes;
+    unsigned long long len;
+} coin_stream;
+
+static int coin_stream_read(void *state, unsigned char *random_array, unsigned long long nbytes)
+{ // Source of random bytes reading the coins of the derandomized functions
+    coin_stream *stream = (coin_stream*)state;
+
+    if (nbytes > stream->len) return 1;
+    memcpy(random_array, stream->bytes, nbytes);
+    stream->bytes += nbytes;
+    stream->len -= nbytes;
+    return 0;
+}
+
+
+int cryptotest_kem_derand()
+{ // Testing the derandomized KEM functions against the randomized ones reading the same random bytes
+    unsigned char sk[CRYPTO_SECRETKEYBYTES] = {0}, sk_[CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES] = {0}, pk_[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES] = {0}, ct_[CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[CRYPTO_BYTES] = {0}, ss_[CRYPTO_BYTES] = {0};
+    unsigned char coins[CRYPTO_KEYPAIRCOINBYTES + CRYPTO_ENCCOINBYTES];
+    randombytes_source previous, source;
+    coin_stream stream;
+    bool passed = true;
+
+    for (int n = 0; n < TEST_LOOPS && passed == true; n++) {
+        randombytes(coins, sizeof(coins));
+        crypto_kem_keypair_derand(pk, sk, coins);
+        crypto_kem_enc_derand(ct, ss, pk, coins + CRYPTO_KEYPAIRCOINBYTES);
+        crypto_kem_dec(ss_, ct, sk);
+        if (memcmp(ss, ss_, CRYPTO_BYTES) != 0) passed = false;
+
+        stream.bytes = coins;
+        stream.len = sizeof(coins);
+        source.fn = coin_stream_read;
+        source.state = &stream;
+        previous = randombytes_swap_source(source);
+        if (crypto_kem_keypair(pk_, sk_) != 0 || crypto_kem_enc(ct_, ss_, pk_) != 0 || stream.len != 0) passed = false;
+        if (crypto_kem_keypair(pk_, sk_) == 0) passed = false;    // Errors of the source are returned
+        randombytes_swap_source(previous);
+
+        if (memcmp(pk, pk_, CRYPTO_PUBLICKEYBYTES) != 0 || memcmp(sk, sk_, CRYPTO_SECRETKEYBYTES) != 0) passed = false;
+        if (memcmp(ct, ct_, CRYPTO_CIPHERTEXTBYTES) != 0 || memcmp(ss, ss_, CRYPTO_BYTES) != 0) passed = false;
+    }
+
+    if (passed == true) printf("  Derandomized KEM tests ....................................... PASSED");
+    else { printf("  Derandomized KEM tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+
+#if defined(_OPCOUNT_)
+int cryptotest_opcount()
+{ // Testing the field operation counts of the KEM calls
+    unsigned char sk[CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[CRYPTO_BYTES] = {0};
+    opcount_t keypair, enc, dec, keygen_A, keygen_B;
+    bool passed = true;
+
+    opcount_reset();
+    crypto_kem_keypair(pk, sk);
+    opcount_get(OPCOUNT_KEM_KEYPAIR, &keypair);
+    opcount_get(OPCOUNT_KEYGEN_A, &keygen_A);
+    opcount_get(OPCOUNT_KEYGEN_B, &keygen_B);
+    crypto_kem_enc(ct, ss, pk);
+    crypto_kem_dec(ss, ct, sk);
+    opcount_get(OPCOUNT_KEM_ENC, &enc);
+    opcount_get(OPCOUNT_KEM_DEC, &dec);
+
+    if (keypair.calls != 1 || enc.calls != 1 || dec.calls != 1 || keygen_A.calls + keygen_B.calls != 1) passed = false;
+    if (keypair.fp2_mul == 0 || keypair.fp2_sqr == 0 || keypair.fp2_add == 0 || enc.fp2_mul == 0 || dec.fp2_mul == 0) passed = false;
+    // The key pair generation includes the counts of its isogeny computation
+    if (keypair.fp2_mul < keygen_A.fp2_mul + keygen_B.fp2_mul || keypair.fp2_sqr < keygen_A.fp2_sqr + keygen_B.fp2_sqr) passed = false;
+    if (opcount_get(OPCOUNT_NCALLS, &keypair) == 0 || keypair.calls != 0) passed = false;
+
+    opcount_reset();
+    opcount_get(OPCOUNT_KEM_DEC, &dec);
+    if (dec.calls != 0 || dec.fp2_mul != 0) passed = false;
+
+    if (passed == true) printf("  Operation count tests ........................................ PASSED");
+    else { printf("  Operation count tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+#endif
+
+
+#if defined(_USDT_)
+#define USDT_MAX_SEMAPHORES    64    // Copies of the semaphore of a probe, one per library variant linked
+
+static int usdt_inspect(volatile unsigned short **semaphores, unsigned int max, volatile uint64_t **calls)
+{ // Read the program file as a tracer does: the probe notes of provider "sike", whose semaphores must be in the section .probes, and the
+  // symbol table, for the counter of call IDs usdt_calls of the library. Outputs the semaphores of the probes phase_end (at most max)
+  // and the address of usdt_calls. Returns the number of probes, or -1 if the file cannot be read or is not as expected.
+    FILE *file = fopen("/proc/self/exe", "rb");
+    unsigned char *image;
+    const Elf64_Ehdr *eh;
+    const Elf64_Shdr *sh, *notes = NULL, *probes = NULL, *symtab = NULL;
+    const Elf64_Sym *sym;
+    const unsigned char *p, *end;
+    const char *section_names, *symbol_names;
+    uint64_t kem_address = 0, calls_address = 0;
+    uintptr_t bias;
+    unsigned int nsemaphores = 0;
+    long bytes;
+    int count = 0;
+
+    if (file == NULL) return -1;
+    fseek(file, 0, SEEK_END);
+    bytes = ftell(file);
+    rewind(file);
+    image = (unsigned char*)malloc(bytes);
+    if (image == NULL || fread(image, 1, bytes, file) != (size_t)bytes) {
+        free(image);
+        fclose(file);
+        return -1;
+    }
+    fclose(file);
+
+    eh = (const Elf64_Ehdr*)image;
+    sh = (const Elf64_Shdr*)(image + eh->e_shoff);
+    section_names = (const char*)image + sh[eh->e_shstrndx].sh_offset;
+    for (unsigned int s = 0; s < eh->e_shnum; s++) {
+        if (strcmp(section_names + sh[s].sh_name, ".note.stapsdt") == 0) notes = &sh[s];
+        if (strcmp(section_names + sh[s].sh_name, ".probes") == 0) probes = &sh[s];
+        if (sh[s].sh_type == SHT_SYMTAB) symtab = &sh[s];
+    }
+    if (notes == NULL || probes == NULL || symtab == NULL) {
+        free(image);
+        return -1;
+    }
+
+    // Load bias of the program, from the address of cryptotest_kem
+    symbol_names = (const char*)image + sh[symtab->sh_link].sh_offset;
+    sym = (const Elf64_Sym*)(image + symtab->sh_offset);
+    for (size_t i = 0; i < symtab->sh_size/sizeof(Elf64_Sym); i++) {
+        if (strcmp(symbol_names + sym[i].st_name, "cryptotest_kem") == 0) kem_address = sym[i].st_value;
+        if (strcmp(symbol_names + sym[i].st_name, "usdt_calls") == 0) calls_address = sym[i].st_value;
+    }
+    bias = (uintptr_t)cryptotest_kem - (uintptr_t)kem_address;
+    *calls = (volatile uint64_t*)(bias + (uintptr_t)calls_address);
+
+    p = image + notes->sh_offset;
+    end = p + notes->sh_size;
+    while (p < end && count >= 0) {
+        const Elf64_Nhdr *nh = (const Elf64_Nhdr*)p;
+        const char *owner = (const char*)(nh + 1);
+        const uint64_t *desc = (const uint64_t*)(owner + ((nh->n_namesz + 3) & ~3u));    // pc, base, semaphore, provider, name, args
+        const char *provider = (const char*)(desc + 3), *name = provider + strlen(provider) + 1;
+
+        if (nh->n_type == 3 && strcmp(owner, "stapsdt") == 0 && strcmp(provider, "sike") == 0) {
+            if (desc[2] < probes->sh_addr || desc[2] + sizeof(unsigned short) > probes->sh_addr + probes->sh_size) {
+                count = -1;
+            } else {
+                if (strcmp(name, "phase_end") == 0 && nsemaphores < max) {
+                    semaphores[nsemaphores++] = (volatile unsigned short*)(bias + (uintptr_t)desc[2]);
+                }
+                count++;
+            }
+        }
+        p = (const unsigned char*)desc + ((nh->n_descsz + 3) & ~3u);
+    }
+    free(image);
+    if (kem_address == 0 || calls_address == 0 || nsemaphores == 0) return -1;
+    return count;
+}
+
+
+int cryptotest_usdt()
+{ // Testing the tracepoints: their notes, and the call IDs with and without a tracer, which is simulated by setting semaphores
+    unsigned char sk[CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[CRYPTO_BYTES] = {0};
+    unsigned char ss_[CRYPTO_BYTES] = {0};
+    volatile unsigned short *semaphores[USDT_MAX_SEMAPHORES] = {NULL};
+    volatile uint64_t *calls = NULL;
+    uint64_t ncalls;
+    unsigned int i;
+    int nprobes;
+    bool passed = true;
+
+    nprobes = usdt_inspect(semaphores, USDT_MAX_SEMAPHORES, &calls);
+    if (nprobes <= 0) {
+        printf("  Tracepoint tests ... FAILED"); printf("\n"); return FAILED;
+    }
+    ncalls = *calls;
+
+    // Without a tracer, no ID is drawn
+    crypto_kem_keypair(pk, sk);
+    crypto_kem_enc(ct, ss, pk);
+    if (*calls != ncalls) passed = false;
+
+    // With a tracer, each outermost call draws one ID, shared by the calls nested in it (the key generation of crypto_kem_enc)
+    for (i = 0; i < USDT_MAX_SEMAPHORES && semaphores[i] != NULL; i++) (*semaphores[i])++;
+    crypto_kem_enc(ct, ss, pk);
+    crypto_kem_dec(ss_, ct, sk);
+    for (i = 0; i < USDT_MAX_SEMAPHORES && semaphores[i] != NULL; i++) (*semaphores[i])--;
+    if (*calls != ncalls + 2 || memcmp(ss, ss_, CRYPTO_BYTES) != 0) passed = false;
+
+    if (passed == true) printf("  Tracepoint tests ............................................. PASSED");
+    else { printf("  Tracepoint tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+#endif
+
+
+// SHAKE256 calls of each KEM operation, timed as SIKE_PHASE_HASH
+#define KEYPAIR_HASHES    0    // None
+#define ENC_HASHES        3    // G(m||pk), H(j) masking m, H(m||ct)
+#define DEC_HASHES        3    // H(j) unmasking m, G(m||pk) for the re-encryption, H(m||ct) or H(s||ct)
+
+int cryptotest_stats()
+{ // Testing the phase timers
+    unsigned char sk[CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[CRYPTO_BYTES] = {0};
+    sike_stats_t stats;
+    unsigned int i;
+    bool passed = true;
+
+    sike_stats_reset();
+    sike_stats_enable(1);
+    crypto_kem_keypair(pk, sk);
+    sike_stats_snapshot(&stats);
+    if (stats.calls[SIKE_PHASE_HASH] != KEYPAIR_HASHES) passed = false;
+    crypto_kem_enc(ct, ss, pk);
+    sike_stats_snapshot(&stats);
+    if (stats.calls[SIKE_PHASE_HASH] != KEYPAIR_HASHES + ENC_HASHES) passed = false;
+    crypto_kem_dec(ss, ct, sk);
+    sike_stats_snapshot(&stats);
+    if (stats.calls[SIKE_PHASE_HASH] != KEYPAIR_HASHES + ENC_HASHES + DEC_HASHES) passed = false;
+
+    if (stats.calls[SIKE_PHASE_LADDER] == 0 || stats.calls[SIKE_PHASE_TRAVERSAL] == 0 || stats.calls[SIKE_PHASE_JINV] == 0) passed = false;
+    if (stats.ticks[SIKE_PHASE_TRAVERSAL] == 0) passed = false;
+#if defined(COMPRESS)
+    if (stats.calls[SIKE_PHASE_BASIS] == 0 || stats.calls[SIKE_PHASE_PAIRINGS] == 0 || stats.calls[SIKE_PHASE_DLOGS] == 0) passed = false;
+#endif
+
+    // Disabled timers leave the stats unchanged
+    sike_stats_enable(0);
+    sike_stats_reset();
+    crypto_kem_enc(ct, ss, pk);
+    sike_stats_snapshot(&stats);
+    for (i = 0; i < SIKE_PHASE_NPHASES; i++) {
+        if (stats.calls[i] != 0 || stats.ticks[i] != 0) passed = false;
+    }
+
+    if (passed == true) printf("  Phase timer tests ............................................ PASSED");
+    else { printf("  Phase timer tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+
+#if defined(COMPRESS)
+int cryptotest_kem_workspace()
+{ // Testing the key generation, encapsulation and decapsulation with a workspace of the caller
+    unsigned char sk[CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[CRYPTO_BYTES] = {0};
+    unsigned char ss_[CRYPTO_BYTES] = {0};
+    unsigned char *workspace = malloc(crypto_kem_workspace_size() + 1);
+    size_t i;
+    int n;
+    bool passed = true;
+
+    if (workspace == NULL) return FAILED;
+    for (n = 0; n < TEST_LOOPS && passed == true; n++) {
+        // Unaligned workspace, reused across calls
+        crypto_kem_keypair_ws(pk, sk, workspace + 1);
+        crypto_kem_enc_ws(ct, ss, pk, workspace + 1);
+        crypto_kem_dec_ws(ss_, ct, sk, workspace + 1);
+        if (memcmp(ss, ss_, CRYPTO_BYTES) != 0) passed = false;
+        crypto_kem_dec(ss_, ct, sk);
+        if (memcmp(ss, ss_, CRYPTO_BYTES) != 0) passed = false;
+    }
+    for (i = CACHE_LINE_BYTES; i < crypto_kem_workspace_size() - CACHE_LINE_BYTES; i++) {
+        if (workspace[i] != 0) passed = false;    // The workspace is erased
+    }
+    free(workspace);
+
+    if (passed == true) printf("  KEM tests with a workspace ................................... PASSED");
+    else { printf("  KEM tests with a workspace ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+
+int cryptotest_kem_transcoding()
+{ // Testing the conversions of the public key and the encapsulation with the uncompressed key
+    unsigned char sk[CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char pk_[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char pk_uncomp[CRYPTO_PUBLICKEYBYTES_UNCOMPRESSED] = {0};
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[CRYPTO_BYTES] = {0};
+    unsigned char ss_[CRYPTO_BYTES] = {0};
+    bool passed = true;
+
+    for (int i = 0; i < TEST_LOOPS && passed == true; i++) {
+        crypto_kem_keypair(pk, sk);
+        crypto_kem_decompress_pk(pk_uncomp, pk);
+        crypto_kem_compress_pk(pk_, sk);
+        if (memcmp(pk, pk_, CRYPTO_PUBLICKEYBYTES) != 0) passed = false;
+
+        crypto_kem_enc_uncompressed(ct, ss, pk, pk_uncomp);
+        crypto_kem_dec(ss_, ct, sk);
+        if (memcmp(ss, ss_, CRYPTO_BYTES) != 0) passed = false;
+    }
+
+    if (passed == true) printf("  KEM tests with public key transcoding ........................ PASSED");
+    else { printf("  KEM tests with public key transcoding ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+
+#if defined(__NIX__)
+#define DLOG_TEST_THREADS    4
+
+typedef struct {
+    unsigned char coins[CRYPTO_KEYPAIRCOINBYTES + CRYPTO_ENCCOINBYTES];
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES];
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES];
+    bool passed;
+} dlog_test_slot;
+
+
+static void* dlog_test_thread(void *arg)
+{ // Key generation and encapsulation from the coins of a slot, compared with their outputs computed before
+    dlog_test_slot *slot = (dlog_test_slot*)arg;
+    unsigned char sk[CRYPTO_SECRETKEYBYTES], pk[CRYPTO_PUBLICKEYBYTES], ct[CRYPTO_CIPHERTEXTBYTES], ss[CRYPTO_BYTES];
+
+    for (int n = 0; n < TEST_LOOPS; n++) {
+        crypto_kem_keypair_derand(pk, sk, slot->coins);
+        crypto_kem_enc_derand(ct, ss, pk, slot->coins + CRYPTO_KEYPAIRCOINBYTES);
+        if (memcmp(pk, slot->pk, CRYPTO_PUBLICKEYBYTES) != 0 || memcmp(ct, slot->ct, CRYPTO_CIPHERTEXTBYTES) != 0) slot->passed = false;
+    }
+    return NULL;
+}
+
+
+int cryptotest_dlog_threads()
+{ // Testing the discrete logarithms of the key generation from concurrent threads, after stopping their workers and in a child process
+    dlog_test_slot slots[DLOG_TEST_THREADS];
+    pthread_t threads[DLOG_TEST_THREADS];
+    unsigned char sk[CRYPTO_SECRETKEYBYTES], ss[CRYPTO_BYTES];
+    unsigned int i, started;
+    int status;
+    pid_t pid;
+    bool passed = true;
+
+    for (i = 0; i < DLOG_TEST_THREADS; i++) {
+        randombytes(slots[i].coins, sizeof(slots[i].coins));
+        crypto_kem_keypair_derand(slots[i].pk, sk, slots[i].coins);
+        crypto_kem_enc_derand(slots[i].ct, ss, slots[i].pk, slots[i].coins + CRYPTO_KEYPAIRCOINBYTES);
+        slots[i].passed = true;
+    }
+
+    for (started = 0; started < DLOG_TEST_THREADS; started++) {
+        if (pthread_create(&threads[started], NULL, dlog_test_thread, &slots[started]) != 0) {
+            passed = false;
+            break;
+        }
+    }
+    for (i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+        if (slots[i].passed == false) passed = false;
+    }
+
+    sike_threads_shutdown();
+    sike_threads_shutdown();    // Nothing left to stop
+    dlog_test_thread(&slots[0]);    // Starts the workers again
+    sike_threads_shutdown();
+    if (slots[0].passed == false) passed = false;
+
+    dlog_test_thread(&slots[1]);
+    pid = fork();    // The child has none of the workers of the parent and solves the logs itself
+    if (pid == 0) {
+        dlog_test_thread(&slots[2]);
+        _exit(slots[2].passed == true ? 0 : 1);
+    }
+    if (pid < 0 || waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0) passed = false;
+    dlog_test_thread(&slots[3]);
+    if (slots[1].passed == false || slots[3].passed == false) passed = false;
+    sike_threads_shutdown();
+
+    if (passed == true) printf("  Discrete logarithm threads tests ............................. PASSED");
+    else { printf("  Discrete logarithm threads tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+#endif
+#endif
+
+
+#if defined(__NIX__)
+typedef struct {
+    unsigned char sk[CRYPTO_SECRETKEYBYTES];
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES];
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES];
+    unsigned char ss[CRYPTO_BYTES];
+    unsigned char ss_[CRYPTO_BYTES];
+    kem_async_job job;
+} kem_async_slot;
+
+
+static unsigned int kem_async_next(kem_async_queue *queue, kem_async_job *job)
+{ // Chain key generation, encapsulation and decapsulation of a slot. Returns 1 when the slot is done.
+    kem_async_slot *slot = (kem_async_slot*)job->user_data;
+
+    if (job->op == KEM_ASYNC_KEYPAIR) {
+        job->op = KEM_ASYNC_ENC;
+        job->args.enc.ct = slot->ct;
+        job->args.enc.ss = slot->ss;
+        job->args.enc.pk = slot->pk;
+    } else if (job->op == KEM_ASYNC_ENC) {
+        job->op = KEM_ASYNC_DEC;
+        job->args.dec.ss = slot->ss_;
+        job->args.dec.ct = slot->ct;
+        job->args.dec.sk = slot->sk;
+    } else {
+        return 1;
+    }
+    kem_async_submit(queue, job);    // Cannot fail, the job has just left the queue
+    return 0;
+}
+
+
+static void* kem_async_waiter(void *arg)
+{ // Collect completions from a queue shared with another waiter, until no job is in flight
+    kem_async_queue *queue = (kem_async_queue*)arg;
+    kem_async_job *job;
+    uintptr_t count = 0;
+
+    while (kem_async_wait(queue, &job, 1) == 1) {
+        count++;
+    }
+    return (void*)count;
+}
+
+
+int cryptotest_kem_async()
+{ // Testing KEM through the asynchronous queue
+    unsigned int i, n, next = 0, done = 0;
+    kem_async_slot slots[TEST_LOOPS];
+    kem_async_job *completed[TEST_LOOPS];
+    const kem_async_scheme scheme = {crypto_kem_keypair, crypto_kem_enc, crypto_kem_dec};
+    const kem_async_config config = {2, 4, NULL, 0};    // Fewer ring entries than jobs to exercise backpressure
+    kem_async_queue *queue;
+    bool passed = true;
+
+    queue = kem_async_create(&config);
+    if (queue == NULL) {
+        printf("  Asynchronous KEM tests ... FAILED"); printf("\n"); return FAILED;
+    }
+
+    for (i = 0; i < TEST_LOOPS; i++) {
+        memset(&slots[i], 0, sizeof(kem_async_slot));
+        slots[i].job.scheme = &scheme;
+        slots[i].job.op = KEM_ASYNC_KEYPAIR;
+        slots[i].job.args.keypair.pk = slots[i].pk;
+        slots[i].job.args.keypair.sk = slots[i].sk;
+        slots[i].job.user_data = &slots[i];
+    }
+
+    while (done < TEST_LOOPS) {
+        while (next < TEST_LOOPS && kem_async_submit(queue, &slots[next].job) == 0) {
+            next++;
+        }
+        n = kem_async_wait(queue, completed, TEST_LOOPS);
+        for (i = 0; i < n; i++) {
+            if (completed[i]->status != 0) {
+                passed = false;
+            }
+            done += kem_async_next(queue, completed[i]);
+        }
+    }
+    for (i = 0; i < TEST_LOOPS; i++) {
+        if (memcmp(slots[i].ss, slots[i].ss_, CRYPTO_BYTES) != 0) {
+            passed = false;
+        }
+    }
+
+    // Two threads waiting on the same queue both return once the last job has been taken
+    n = (TEST_LOOPS < 4) ? TEST_LOOPS : 4;    // At most "ring_size" jobs
+    for (i = 0; i < n; i++) {
+        slots[i].job.op = KEM_ASYNC_KEYPAIR;
+        slots[i].job.args.keypair.pk = slots[i].pk;
+        slots[i].job.args.keypair.sk = slots[i].sk;
+        kem_async_submit(queue, &slots[i].job);
+    }
+    {
+        pthread_t waiters[2];
+        void *count[2];
+        for (i = 0; i < 2; i++) pthread_create(&waiters[i], NULL, kem_async_waiter, queue);
+        for (i = 0; i < 2; i++) pthread_join(waiters[i], &count[i]);
+        if ((uintptr_t)count[0] + (uintptr_t)count[1] != n) {
+            passed = false;
+        }
+    }
+    kem_async_destroy(queue);
+
+    if (passed == true) printf("  Asynchronous KEM tests ....................................... PASSED");
+    else { printf("  Asynchronous KEM tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+#endif
+
+
+#if defined(CRYPTO_EXPANDEDPKBYTES) && defined(__NIX__)
+#define KEYSTORE_TEST_KEYS    3
+
+static bool keystore_damage(const char *path)
+{ // Flip a bit in the middle of a store of one key pair, which lies in the data of its slot
+    FILE *file = fopen(path, "r+b");
+    long bytes;
+    int c;
+
+    if (file == NULL) return false;
+    fseek(file, 0, SEEK_END);
+    bytes = ftell(file);
+    fseek(file, bytes/2, SEEK_SET);
+    c = fgetc(file);
+    fseek(file, bytes/2, SEEK_SET);
+    fputc(c ^ 0x10, file);
+    return (fclose(file) == 0 && c != EOF);
+}
+
+
+int cryptotest_kem_keystore()
+{ // Testing the key store: key pairs are taken once with their expanded public keys, and wrong keys and damaged slots are rejected
+    unsigned char sks[KEYSTORE_TEST_KEYS*CRYPTO_SECRETKEYBYTES];
+    unsigned char sk[CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char epk[CRYPTO_EXPANDEDPKBYTES] = {0}, epk_[CRYPTO_EXPANDEDPKBYTES] = {0};
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[CRYPTO_BYTES] = {0}, ss_[CRYPTO_BYTES] = {0};
+    unsigned char key[SIKE_KEYSTORE_KEYBYTES], wrong_key[SIKE_KEYSTORE_KEYBYTES];
+    char path[256];
+    sike_keystore store;
+    bool passed = true;
+
+    snprintf(path, sizeof(path), "%s/test_sike_keystore.%d", P_tmpdir, (int)getpid());
+    randombytes(key, sizeof(key));
+    memcpy(wrong_key, key, sizeof(key));
+    wrong_key[0] ^= 1;
+    for (int i = 0; i < KEYSTORE_TEST_KEYS; i++) {
+        crypto_kem_keypair(pk, sks + i*CRYPTO_SECRETKEYBYTES);
+    }
+    if (crypto_kem_keystore_write(path, key, sks, KEYSTORE_TEST_KEYS) != 0) passed = false;
+    if (crypto_kem_keystore_open(&store, path, wrong_key) == 0) passed = false;
+    if (crypto_kem_keystore_open(&store, path, key) != 0 || crypto_kem_keystore_remaining(&store) != KEYSTORE_TEST_KEYS) passed = false;
+
+    // The key pairs are taken in order, with the expanded public keys of crypto_kem_expand_pk
+    for (int i = 0; i < KEYSTORE_TEST_KEYS && passed == true; i++) {
+        if (crypto_kem_keystore_take(&store, pk, sk, epk) != 0 || memcmp(sk, sks + i*CRYPTO_SECRETKEYBYTES, CRYPTO_SECRETKEYBYTES) != 0) passed = false;
+        if (memcmp(pk, sk + CRYPTO_SECRETKEYBYTES - CRYPTO_PUBLICKEYBYTES, CRYPTO_PUBLICKEYBYTES) != 0) passed = false;
+        crypto_kem_expand_pk(epk_, pk);
+        if (memcmp(epk, epk_, CRYPTO_EXPANDEDPKBYTES) != 0) passed = false;
+        crypto_kem_enc_expanded(ct, ss, pk, epk);
+        crypto_kem_dec(ss_, ct, sk);
+        if (memcmp(ss, ss_, CRYPTO_BYTES) != 0) passed = false;
+    }
+    if (crypto_kem_keystore_take(&store, pk, sk, NULL) != SIKE_KEYSTORE_EMPTY || crypto_kem_keystore_remaining(&store) != 0) passed = false;
+    crypto_kem_keystore_close(&store);
+
+    // Taken key pairs are gone from the file
+    if (crypto_kem_keystore_open(&store, path, key) != 0 || crypto_kem_keystore_remaining(&store) != 0) passed = false;
+    crypto_kem_keystore_close(&store);
+
+    // A damaged slot is not taken, and is told apart from an exhausted store
+    if (crypto_kem_keystore_write(path, key, sks, 1) != 0 || keystore_damage(path) == false) passed = false;
+    if (crypto_kem_keystore_open(&store, path, key) != 0 || crypto_kem_keystore_take(&store, pk, sk, epk) != SIKE_KEYSTORE_CORRUPT) passed = false;
+    if (crypto_kem_keystore_take(&store, pk, sk, epk) != SIKE_KEYSTORE_EMPTY) passed = false;
+    crypto_kem_keystore_close(&store);
+    unlink(path);
+
+    if (passed == true) printf("  Key store tests .............................................. PASSED");
+    else { printf("  Key store tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+#endif
+
+
 int cryptorun_kem()
 { // Benchmarking key exchange
     unsigned int n;
@@ -147,6 +763,72 @@ int main(int argc, char **argv)
         printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
         return FAILED;
     }
+
+    Status = cryptotest_kem_derand();    // Test derandomized KEM
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+
+#if defined(_OPCOUNT_)
+    Status = cryptotest_opcount();    // Test field operation counts
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: OPCOUNT_ERROR \n\n");
+        return FAILED;
+    }
+#endif
+
+#if defined(_USDT_)
+    Status = cryptotest_usdt();    // Test tracepoints
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: USDT_ERROR \n\n");
+        return FAILED;
+    }
+#endif
+
+    Status = cryptotest_stats();    // Test phase timers
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: STATS_ERROR \n\n");
+        return FAILED;
+    }
+
+#if defined(COMPRESS)
+    Status = cryptotest_kem_workspace();    // Test KEM with a workspace of the caller
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+
+    Status = cryptotest_kem_transcoding();    // Test KEM with the uncompressed public key
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+
+#if defined(__NIX__)
+    Status = cryptotest_dlog_threads();    // Test the key generation from concurrent threads
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: DLOG_THREADS_ERROR \n\n");
+        return FAILED;
+    }
+#endif
+#endif
+
+#if defined(__NIX__)
+    Status = cryptotest_kem_async();    // Test KEM through the asynchronous queue
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: ASYNC_ERROR \n\n");
+        return FAILED;
+    }
+#endif
+
+#if defined(CRYPTO_EXPANDEDPKBYTES) && defined(__NIX__)
+    Status = cryptotest_kem_keystore();    // Test the key store
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEYSTORE_ERROR \n\n");
+        return FAILED;
+    }
+#endif
     
     if ((argc > 1) && (strcmp("nobench", argv[1]) == 0)) {}
     else {
@@ -0,0 +1,168 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/PQCrypto-SIDH
+* Released under MIT license
+*
+* Abstract: testing the context interface over all the variants of libsike.a
+*********************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include "test_extras.h"
+#include "../src/ctx/sike_ctx.h"
+
+#define TEST_LOOPS        2      // Number of iterations per test
+#define TEST_THREADS      4
+
+static const sike_scheme *schemes[] = {
+    &sike_scheme_SIKEp434, &sike_scheme_SIKEp503, &sike_scheme_SIKEp610, &sike_scheme_SIKEp751,
+    &sike_scheme_SIKEp434_compressed, &sike_scheme_SIKEp503_compressed, &sike_scheme_SIKEp610_compressed, &sike_scheme_SIKEp751_compressed
+};
+#define NSCHEMES    (sizeof(schemes)/sizeof(schemes[0]))
+
+
+static int test_rng(void *rng_state, unsigned char *out, unsigned long long nbytes)
+{ // Deterministic source of random bytes (xorshift64*)
+    uint64_t *x = (uint64_t*)rng_state;
+
+    for (unsigned long long i = 0; i < nbytes; i++) {
+        *x ^= *x >> 12;
+        *x ^= *x << 25;
+        *x ^= *x >> 27;
+        out[i] = (unsigned char)((*x * 0x2545F4914F6CDD1DULL) >> 56);
+    }
+    return 0;
+}
+
+
+static int failing_rng(void *rng_state, unsigned char *out, unsigned long long nbytes)
+{
+    (void)rng_state; (void)out; (void)nbytes;
+    return 1;
+}
+
+
+typedef struct {
+    const sike_scheme *scheme;
+    uint64_t seed;
+    unsigned char *pk;             // Public key derived from "seed"
+    void *workspace;               // NULL or a workspace of the scheme
+    bool passed;
+} keypair_job;
+
+
+static void* keypair_thread(void *arg)
+{ // Key generations with a context of the thread, which must reproduce the public key of the seed
+    keypair_job *job = (keypair_job*)arg;
+    unsigned char *pk = malloc(job->scheme->public_key_bytes), *sk = malloc(job->scheme->secret_key_bytes);
+    uint64_t state;
+    sike_ctx ctx;
+
+    job->passed = (pk != NULL && sk != NULL && sike_ctx_init(&ctx, job->scheme, test_rng, &state, job->workspace) == 0);
+    for (int i = 0; i < TEST_LOOPS && job->passed; i++) {
+        state = job->seed;
+        if (sike_kem_keypair(&ctx, pk, sk) != 0 || memcmp(pk, job->pk, job->scheme->public_key_bytes) != 0) job->passed = false;
+    }
+    free(pk);
+    free(sk);
+    return NULL;
+}
+
+
+static bool test_scheme(const sike_scheme *scheme)
+{ // Testing KEM through contexts with the system generator, deterministic sources, a failing source and a workspace
+    unsigned char *sk = malloc(scheme->secret_key_bytes), *pk = malloc(scheme->public_key_bytes);
+    unsigned char *ct = malloc(scheme->ciphertext_bytes), *ct_ = malloc(scheme->ciphertext_bytes);
+    unsigned char *ss = malloc(scheme->shared_secret_bytes), *ss_ = malloc(scheme->shared_secret_bytes);
+    unsigned char *workspace = malloc(scheme->workspace_bytes + 1), *pks = NULL;
+    keypair_job jobs[TEST_THREADS];
+    pthread_t threads[TEST_THREADS];
+    uint64_t state;
+    sike_ctx ctx, ctx_rng, ctx_ws;
+    bool passed = (sk != NULL && pk != NULL && ct != NULL && ct_ != NULL && ss != NULL && ss_ != NULL && workspace != NULL);
+
+    if (passed) {
+        sike_ctx_init(&ctx, scheme, NULL, NULL, NULL);
+        sike_ctx_init(&ctx_rng, scheme, test_rng, &state, NULL);
+        sike_ctx_init(&ctx_ws, scheme, test_rng, &state, workspace + 1);    // Unaligned workspace
+    }
+    if (sike_ctx_init(&ctx, NULL, NULL, NULL, NULL) == 0) passed = false;
+
+    for (int i = 0; i < TEST_LOOPS && passed; i++) {
+        // System generator
+        if (sike_kem_keypair(&ctx, pk, sk) != 0 || sike_kem_enc(&ctx, ct, ss, pk) != 0 || sike_kem_dec(&ctx, ss_, ct, sk) != 0) passed = false;
+        if (memcmp(ss, ss_, scheme->shared_secret_bytes) != 0) passed = false;
+
+        // The outputs of a deterministic source are reproduced with and without workspace
+        state = 0x9E3779B97F4A7C15ULL + (uint64_t)i;
+        sike_kem_keypair(&ctx_rng, pk, sk);
+        sike_kem_enc(&ctx_rng, ct, ss, pk);
+        state = 0x9E3779B97F4A7C15ULL + (uint64_t)i;
+        sike_kem_keypair(&ctx_ws, pk, sk);
+        sike_kem_enc(&ctx_ws, ct_, ss_, pk);
+        if (memcmp(ct, ct_, scheme->ciphertext_bytes) != 0 || memcmp(ss, ss_, scheme->shared_secret_bytes) != 0) passed = false;
+        sike_kem_dec(&ctx_ws, ss_, ct, sk);
+        if (memcmp(ss, ss_, scheme->shared_secret_bytes) != 0) passed = false;
+    }
+
+    // Errors of the source are returned
+    if (passed) {
+        sike_ctx ctx_fail;
+        sike_ctx_init(&ctx_fail, scheme, failing_rng, NULL, NULL);
+        if (sike_kem_keypair(&ctx_fail, pk, sk) == 0 || sike_kem_enc(&ctx_fail, ct, ss, pk) == 0) passed = false;
+    }
+
+    // Concurrent contexts with distinct sources, half of them with a workspace
+    if (passed) {
+        pks = malloc(TEST_THREADS*scheme->public_key_bytes);
+        passed = (pks != NULL);
+    }
+    for (int t = 0; t < TEST_THREADS && passed; t++) {
+        jobs[t].scheme = scheme;
+        jobs[t].seed = 0x0123456789ABCDEFULL*(uint64_t)(t + 1);
+        jobs[t].pk = pks + t*scheme->public_key_bytes;
+        jobs[t].workspace = NULL;
+        state = jobs[t].seed;
+        sike_kem_keypair(&ctx_rng, jobs[t].pk, sk);
+    }
+    for (int t = 0; t < TEST_THREADS && passed; t++) {
+        if (t % 2 == 1 && scheme->workspace_bytes != 0) {
+            jobs[t].workspace = malloc(scheme->workspace_bytes);
+            if (jobs[t].workspace == NULL) passed = false;
+        }
+    }
+    if (passed) {
+        for (int t = 0; t < TEST_THREADS; t++) pthread_create(&threads[t], NULL, keypair_thread, &jobs[t]);
+        for (int t = 0; t < TEST_THREADS; t++) {
+            pthread_join(threads[t], NULL);
+            if (!jobs[t].passed) passed = false;
+        }
+        for (int t = 0; t < TEST_THREADS; t++) free(jobs[t].workspace);
+    }
+
+    free(sk); free(pk); free(ct); free(ct_); free(ss); free(ss_); free(workspace); free(pks);
+    return passed;
+}
+
+
+int main(void)
+{
+    int Status = PASSED;
+
+    printf("\n\nTESTING THE CONTEXT INTERFACE OF THE KEM\n");
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    for (size_t i = 0; i < NSCHEMES; i++) {
+        if (test_scheme(schemes[i]) == true) printf("  KEM tests with contexts, %-20s ............................... PASSED\n", schemes[i]->name);
+        else { printf("  KEM tests with contexts, %s ... FAILED\n", schemes[i]->name); Status = FAILED; }
+    }
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+    }
+    return Status;
+}